@@ -0,0 +1,216 @@
+#include "GameUtil/Math/Core/GameMathCore.h"
+#include "GameUtil/Spline/Core/MySplineCore.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+	constexpr float DELTA_TIME = 0.016F;
+
+	std::vector<float> MakeRandomFloats(std::int32_t const InNum, std::uint32_t const InSeed)
+	{
+		std::mt19937 Random { InSeed };
+		std::uniform_real_distribution<float> Distribution { -100.0F, 100.0F };
+		std::vector<float> Values(static_cast<size_t>(InNum));
+		for(float& Value : Values)
+		{
+			Value = Distribution(Random);
+		}
+		return Values;
+	}
+
+	/**
+	* Minimal 3D vector: the value type of the vector kernels (as FVector in the engine).
+	*/
+	struct FBenchVector
+	{
+		float X, Y, Z;
+
+		FBenchVector operator+(const FBenchVector& InOther) const { return FBenchVector { X + InOther.X, Y + InOther.Y, Z + InOther.Z }; }
+		FBenchVector operator-(const FBenchVector& InOther) const { return FBenchVector { X - InOther.X, Y - InOther.Y, Z - InOther.Z }; }
+		FBenchVector operator*(float const InScale) const { return FBenchVector { X * InScale, Y * InScale, Z * InScale }; }
+	};
+
+	/**
+	* Distances along the spline at its points (increasing by the random segment lengths).
+	*/
+	std::vector<float> MakePointDistances(std::int32_t const InNumPoints, float& OutSplineLength)
+	{
+		std::vector<float> const SegmentLengths = MakeRandomFloats(InNumPoints, 4);
+		std::vector<float> Distances(static_cast<size_t>(InNumPoints));
+		float Distance = 0.0F;
+		for(std::int32_t PointIndex = 0; PointIndex < InNumPoints; ++PointIndex)
+		{
+			Distances[PointIndex] = Distance;
+			Distance += 100.0F + SegmentLengths[PointIndex];
+		}
+		OutSplineLength = Distance;
+		return Distances;
+	}
+} // anonymous
+
+// ~GameMathCore Begin
+static void BM_UpdateFloatsToTarget(benchmark::State& State)
+{
+	std::int32_t const NumValues = static_cast<std::int32_t>(State.range(0));
+	std::vector<float> const Targets = MakeRandomFloats(NumValues, 1);
+	std::vector<float> Values = MakeRandomFloats(NumValues, 2);
+	for(auto _ : State)
+	{
+		GameMathCore::UpdateFloatsToTarget(DELTA_TIME, Values.data(), Targets.data(), NumValues, 3.0F, 5.0F, 1.0e-8F);
+		benchmark::DoNotOptimize(Values.data());
+		benchmark::ClobberMemory();
+	}
+	State.SetItemsProcessed(State.iterations() * NumValues);
+}
+BENCHMARK(BM_UpdateFloatsToTarget)->RangeMultiplier(8)->Range(64, 16384);
+
+static void BM_UpdateFloatsExpSmoothed(benchmark::State& State)
+{
+	std::int32_t const NumValues = static_cast<std::int32_t>(State.range(0));
+	std::vector<float> const Targets = MakeRandomFloats(NumValues, 1);
+	std::vector<float> Values = MakeRandomFloats(NumValues, 2);
+	for(auto _ : State)
+	{
+		GameMathCore::UpdateFloatsExpSmoothed(DELTA_TIME, Values.data(), Targets.data(), NumValues, 3.0F);
+		benchmark::DoNotOptimize(Values.data());
+		benchmark::ClobberMemory();
+	}
+	State.SetItemsProcessed(State.iterations() * NumValues);
+}
+BENCHMARK(BM_UpdateFloatsExpSmoothed)->RangeMultiplier(8)->Range(64, 16384);
+
+static void BM_UpdateFloatsCriticallyDampedSpring(benchmark::State& State)
+{
+	std::int32_t const NumValues = static_cast<std::int32_t>(State.range(0));
+	std::vector<float> const Targets = MakeRandomFloats(NumValues, 1);
+	std::vector<float> Values = MakeRandomFloats(NumValues, 2);
+	std::vector<float> Velocities = MakeRandomFloats(NumValues, 3);
+	for(auto _ : State)
+	{
+		GameMathCore::UpdateFloatsCriticallyDampedSpring(DELTA_TIME, Values.data(), Velocities.data(), Targets.data(), NumValues, 6.0F);
+		benchmark::DoNotOptimize(Values.data());
+		benchmark::DoNotOptimize(Velocities.data());
+		benchmark::ClobberMemory();
+	}
+	State.SetItemsProcessed(State.iterations() * NumValues);
+}
+BENCHMARK(BM_UpdateFloatsCriticallyDampedSpring)->RangeMultiplier(8)->Range(64, 16384);
+
+static void BM_GetFloatUpdatedToTarget(benchmark::State& State)
+{
+	float Value = 0.0F;
+	float Target = 100.0F;
+	for(auto _ : State)
+	{
+		Value = GameMathCore::GetFloatUpdatedToTarget(DELTA_TIME, Value, Target, 3.0F, 5.0F, 1.0e-8F);
+		benchmark::DoNotOptimize(Value);
+		benchmark::DoNotOptimize(Target);
+	}
+}
+BENCHMARK(BM_GetFloatUpdatedToTarget);
+
+static void BM_GetFloatExpSmoothed(benchmark::State& State)
+{
+	float Value = 0.0F;
+	float Target = 100.0F;
+	for(auto _ : State)
+	{
+		Value = GameMathCore::GetFloatExpSmoothed(DELTA_TIME, Value, Target, 3.0F);
+		benchmark::DoNotOptimize(Value);
+		benchmark::DoNotOptimize(Target);
+	}
+}
+BENCHMARK(BM_GetFloatExpSmoothed);
+
+static void BM_GetVectorExpSmoothed(benchmark::State& State)
+{
+	FBenchVector Value { 0.0F, 0.0F, 0.0F };
+	FBenchVector Target { 100.0F, -50.0F, 25.0F };
+	for(auto _ : State)
+	{
+		Value = GameMathCore::GetExpSmoothed(DELTA_TIME, Value, Target, 3.0F);
+		benchmark::DoNotOptimize(Value);
+		benchmark::DoNotOptimize(Target);
+	}
+}
+BENCHMARK(BM_GetVectorExpSmoothed);
+
+static void BM_UpdateFloatCriticallyDampedSpring(benchmark::State& State)
+{
+	float Value = 0.0F;
+	float Velocity = 0.0F;
+	float Target = 100.0F;
+	for(auto _ : State)
+	{
+		GameMathCore::UpdateFloatCriticallyDampedSpring(DELTA_TIME, Value, Velocity, Target, 6.0F);
+		benchmark::DoNotOptimize(Value);
+		benchmark::DoNotOptimize(Velocity);
+		benchmark::DoNotOptimize(Target);
+	}
+}
+BENCHMARK(BM_UpdateFloatCriticallyDampedSpring);
+
+static void BM_UpdateVectorCriticallyDampedSpring(benchmark::State& State)
+{
+	FBenchVector Value { 0.0F, 0.0F, 0.0F };
+	FBenchVector Velocity { 0.0F, 0.0F, 0.0F };
+	FBenchVector Target { 100.0F, -50.0F, 25.0F };
+	for(auto _ : State)
+	{
+		GameMathCore::UpdateCriticallyDampedSpring(DELTA_TIME, Value, Velocity, Target, 6.0F);
+		benchmark::DoNotOptimize(Value);
+		benchmark::DoNotOptimize(Velocity);
+		benchmark::DoNotOptimize(Target);
+	}
+}
+BENCHMARK(BM_UpdateVectorCriticallyDampedSpring);
+// ~GameMathCore End
+
+// ~MySplineCore Begin
+static void BM_GetSegmentEndPointIndex(benchmark::State& State)
+{
+	std::int32_t const NumPoints = static_cast<std::int32_t>(State.range(0));
+	bool const bClosedLoop = true;
+	for(auto _ : State)
+	{
+		std::int32_t const NumSegments = MySplineCore::GetNumberOfSegments(NumPoints, bClosedLoop);
+		std::int32_t Sum = 0;
+		for(std::int32_t SegmentIndex = 0; SegmentIndex < NumSegments; ++SegmentIndex)
+		{
+			Sum += MySplineCore::GetSegmentEndPointIndex(SegmentIndex, NumPoints);
+		}
+		benchmark::DoNotOptimize(Sum);
+	}
+	State.SetItemsProcessed(State.iterations() * NumPoints);
+}
+BENCHMARK(BM_GetSegmentEndPointIndex)->RangeMultiplier(8)->Range(8, 4096);
+
+static void BM_GetDistanceAlongSplineAtInputKey(benchmark::State& State)
+{
+	constexpr std::int32_t NUM_KEYS = 1024;
+	std::int32_t const NumPoints = static_cast<std::int32_t>(State.range(0));
+	float SplineLength = 0.0F;
+	std::vector<float> const Distances = MakePointDistances(NumPoints, SplineLength);
+	// Keys over the whole closed loop (including the last segment, that wraps to the first point)
+	std::vector<float> Keys(NUM_KEYS);
+	for(std::int32_t KeyIndex = 0; KeyIndex < NUM_KEYS; ++KeyIndex)
+	{
+		Keys[KeyIndex] = static_cast<float>(NumPoints) * static_cast<float>(KeyIndex) / static_cast<float>(NUM_KEYS);
+	}
+	for(auto _ : State)
+	{
+		float Sum = 0.0F;
+		for(float const Key : Keys)
+		{
+			Sum += MySplineCore::GetDistanceAlongSplineAtInputKey(Key, Distances.data(), NumPoints, SplineLength);
+		}
+		benchmark::DoNotOptimize(Sum);
+	}
+	State.SetItemsProcessed(State.iterations() * NUM_KEYS);
+}
+BENCHMARK(BM_GetDistanceAlongSplineAtInputKey)->RangeMultiplier(8)->Range(8, 4096);
+// ~MySplineCore End
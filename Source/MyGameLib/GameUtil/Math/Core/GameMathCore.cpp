@@ -0,0 +1,30 @@
+#include "GameMathCore.h"
+
+namespace GameMathCore
+{
+	void UpdateFloatsToTarget(float const InDeltaTime, float* const InOutValues, const float* const InTargetValues, std::int32_t const InNumValues, float const InAcceleration, float const InDeceleration, float const InErrorTolerance)
+	{
+		for(std::int32_t Index = 0; Index < InNumValues; ++Index)
+		{
+			InOutValues[Index] = GetFloatUpdatedToTarget(InDeltaTime, InOutValues[Index], InTargetValues[Index], InAcceleration, InDeceleration, InErrorTolerance);
+		}
+	}
+
+	void UpdateFloatsExpSmoothed(float const InDeltaTime, float* const InOutValues, const float* const InTargetValues, std::int32_t const InNumValues, float const InSmoothingSpeed)
+	{
+		float const Decay = GetExpDecay(InDeltaTime, InSmoothingSpeed);
+		for(std::int32_t Index = 0; Index < InNumValues; ++Index)
+		{
+			InOutValues[Index] = InTargetValues[Index] + (InOutValues[Index] - InTargetValues[Index]) * Decay;
+		}
+	}
+
+	void UpdateFloatsCriticallyDampedSpring(float const InDeltaTime, float* const InOutValues, float* const InOutVelocities, const float* const InTargetValues, std::int32_t const InNumValues, float const InAngularFrequency)
+	{
+		float const Decay = GetExpDecay(InDeltaTime, InAngularFrequency);
+		for(std::int32_t Index = 0; Index < InNumValues; ++Index)
+		{
+			StepCriticallyDampedSpring(InDeltaTime, Decay, InAngularFrequency, InOutValues[Index], InOutVelocities[Index], InTargetValues[Index]);
+		}
+	}
+} // GameMathCore
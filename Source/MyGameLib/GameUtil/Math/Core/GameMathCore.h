@@ -0,0 +1,107 @@
+#pragma once
+
+/**
+* Computational core of UGameMath.
+*
+* Plain C++ (standard library only): no UObject, no engine headers,
+* so it can be compiled and profiled without the engine.
+* UGameMath functions are thin forwards to these functions.
+* The value kernels are templates over the value type (float, or any vector with +, - and * by float, e.g. FVector).
+*/
+
+#include <cmath>
+#include <cstdint>
+
+namespace GameMathCore
+{
+	/**
+	* @see UGameMath::GetFloatUpdatedToTarget
+	*/
+	inline float GetFloatUpdatedToTarget(float const InDeltaTime, float const InCurrValue, float const InTargetValue, float const InAcceleration, float const InDeceleration, float const InErrorTolerance)
+	{
+		float const DeltaToTarget = InTargetValue - InCurrValue;
+		if(std::fabs(DeltaToTarget) <= InErrorTolerance)
+		{
+			return InTargetValue;
+		}
+		if(DeltaToTarget < 0.0F)
+		{
+			float const UpdatedValue = InCurrValue - InDeltaTime * InDeceleration;
+			return (UpdatedValue < InTargetValue) ? InTargetValue : UpdatedValue;
+		}
+		float const UpdatedValue = InCurrValue + InDeltaTime * InAcceleration;
+		return (UpdatedValue > InTargetValue) ? InTargetValue : UpdatedValue;
+	}
+
+	/**
+	* Part of the distance to the target that remains after the exponential decay with the given rate.
+	*/
+	inline float GetExpDecay(float const InDeltaTime, float const InRate)
+	{
+		return std::exp(-InRate * InDeltaTime);
+	}
+
+	/**
+	* @see UGameMath::GetFloatExpSmoothed, UGameMath::GetVectorExpSmoothed
+	*/
+	template<class ValueT>
+	ValueT GetExpSmoothed(float const InDeltaTime, const ValueT& InCurrValue, const ValueT& InTargetValue, float const InSmoothingSpeed)
+	{
+		return InTargetValue + (InCurrValue - InTargetValue) * GetExpDecay(InDeltaTime, InSmoothingSpeed);
+	}
+
+	/**
+	* @see UGameMath::GetFloatExpSmoothed
+	*/
+	inline float GetFloatExpSmoothed(float const InDeltaTime, float const InCurrValue, float const InTargetValue, float const InSmoothingSpeed)
+	{
+		return GetExpSmoothed(InDeltaTime, InCurrValue, InTargetValue, InSmoothingSpeed);
+	}
+
+	/**
+	* Exact solution of x'' = -2*w*x' - w*w*(x - Target) for the given time:
+	* x(t) = Target + (Y0 + (V0 + w*Y0)*t) * exp(-w*t), where Y0 = x(0) - Target.
+	*
+	* @param InDecay: exp(-w*t) (@see GetExpDecay), passed to calculate it once for the batch.
+	*/
+	template<class ValueT>
+	void StepCriticallyDampedSpring(float const InDeltaTime, float const InDecay, float const InAngularFrequency, ValueT& InOutValue, ValueT& InOutVelocity, const ValueT& InTargetValue)
+	{
+		ValueT const Offset = InOutValue - InTargetValue;
+		ValueT const Temp = InOutVelocity + Offset * InAngularFrequency;
+		InOutValue = InTargetValue + (Offset + Temp * InDeltaTime) * InDecay;
+		InOutVelocity = (InOutVelocity - Temp * (InAngularFrequency * InDeltaTime)) * InDecay;
+	}
+
+	/**
+	* @see UGameMath::UpdateFloatCriticallyDampedSpring, UGameMath::UpdateVectorCriticallyDampedSpring
+	*/
+	template<class ValueT>
+	void UpdateCriticallyDampedSpring(float const InDeltaTime, ValueT& InOutValue, ValueT& InOutVelocity, const ValueT& InTargetValue, float const InAngularFrequency)
+	{
+		StepCriticallyDampedSpring(InDeltaTime, GetExpDecay(InDeltaTime, InAngularFrequency), InAngularFrequency, InOutValue, InOutVelocity, InTargetValue);
+	}
+
+	/**
+	* @see UGameMath::UpdateFloatCriticallyDampedSpring
+	*/
+	inline void UpdateFloatCriticallyDampedSpring(float const InDeltaTime, float& InOutValue, float& InOutVelocity, float const InTargetValue, float const InAngularFrequency)
+	{
+		UpdateCriticallyDampedSpring(InDeltaTime, InOutValue, InOutVelocity, InTargetValue, InAngularFrequency);
+	}
+
+	/**
+	* Batched GetFloatUpdatedToTarget with the same parameters for all values.
+	*/
+	void UpdateFloatsToTarget(float InDeltaTime, float* InOutValues, const float* InTargetValues, std::int32_t InNumValues, float InAcceleration, float InDeceleration, float InErrorTolerance);
+
+	/**
+	* Plain-loop version of UGameMath::UpdateFloatsExpSmoothed (written to be auto-vectorized).
+	*/
+	void UpdateFloatsExpSmoothed(float InDeltaTime, float* InOutValues, const float* InTargetValues, std::int32_t InNumValues, float InSmoothingSpeed);
+
+	/**
+	* Plain-loop version of UGameMath::UpdateFloatsCriticallyDampedSpring (written to be auto-vectorized).
+	*/
+	void UpdateFloatsCriticallyDampedSpring(float InDeltaTime, float* InOutValues, float* InOutVelocities, const float* InTargetValues, std::int32_t InNumValues, float InAngularFrequency);
+} // GameMathCore
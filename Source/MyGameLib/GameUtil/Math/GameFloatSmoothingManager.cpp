@@ -0,0 +1,336 @@
+#include "GameFloatSmoothingManager.h"
+#include "GameMath.h"
+#include "Util/Core/LogUtilLib.h"
+
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	/** Count of channels updated by one parallel task*/
+	constexpr int32 PARALLEL_BATCH_SIZE = 1024;
+
+	TAutoConsoleVariable<int32> CVarSmoothingParallelMinChannels
+	(
+		TEXT("GameMath.Smoothing.ParallelMinChannels"),
+		4096,
+		TEXT("Minimal count of channels for which UGameFloatSmoothingManager updates channels in parallel (0 means never)"),
+		ECVF_Default
+	);
+
+	TMap<const UWorld*, UGameFloatSmoothingManager*>& GetWorldManagers()
+	{
+		static TMap<const UWorld*, UGameFloatSmoothingManager*> Managers;
+		return Managers;
+	}
+}
+
+UGameFloatSmoothingManager::UGameFloatSmoothingManager()
+{
+}
+
+UGameFloatSmoothingManager* UGameFloatSmoothingManager::Get(const UObject* const InWorldContextObject)
+{
+	checkf(IsInGameThread(), TEXT("%s must be called on the game thread"), TEXT(__FUNCTION__));
+	checkf(GEngine, TEXT("GEngine must be valid when calling %s"), TEXT(__FUNCTION__));
+	UWorld* const W = GEngine->GetWorldFromContextObject(InWorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if(W == nullptr)
+	{
+		M_LOG_ERROR(TEXT("World is NOT found for the context object {%s}"), *ULogUtilLib::GetNameAndClassSafe(InWorldContextObject));
+		return nullptr;
+	}
+
+	if(UGameFloatSmoothingManager* const ExistingManager = Find(W))
+	{
+		return ExistingManager;
+	}
+
+	static FDelegateHandle const WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddStatic(&UGameFloatSmoothingManager::HandleWorldCleanup);
+
+	UGameFloatSmoothingManager* const Manager = NewObject<UGameFloatSmoothingManager>(W);
+	Manager->World = W;
+	// The world does NOT reference the manager, so we keep it alive until the world is cleaned up
+	Manager->AddToRoot();
+	GetWorldManagers().Add(W, Manager);
+	M_LOG(TEXT("Float smoothing manager created for %s"), *ULogUtilLib::GetNameAndClassSafe(W));
+	return Manager;
+}
+
+UGameFloatSmoothingManager* UGameFloatSmoothingManager::Find(const UWorld* const InWorld)
+{
+	UGameFloatSmoothingManager* const* const ppManager = GetWorldManagers().Find(InWorld);
+	return ppManager ? *ppManager : nullptr;
+}
+
+void UGameFloatSmoothingManager::HandleWorldCleanup(UWorld* const InWorld, bool const bInSessionEnded, bool const bInCleanupResources)
+{
+	UGameFloatSmoothingManager* Manager = nullptr;
+	if( ! GetWorldManagers().RemoveAndCopyValue(InWorld, Manager) )
+	{
+		return;
+	}
+	M_LOG(TEXT("Releasing float smoothing manager (%d channels) of %s"), Manager->NumChannels(), *ULogUtilLib::GetNameAndClassSafe(InWorld));
+	Manager->World = nullptr;
+	Manager->RemoveFromRoot();
+}
+
+FGameFloatSmoothingHandle UGameFloatSmoothingManager::K2_RegisterChannel(float const InCurrValue, float const InTargetValue, const FGameFloatUpdate& InUpdate)
+{
+	return RegisterChannel(InCurrValue, InTargetValue, InUpdate);
+}
+
+FGameFloatSmoothingHandle UGameFloatSmoothingManager::RegisterChannel
+(
+	float const InCurrValue, float const InTargetValue, const FGameFloatUpdate& InUpdate,
+	float* const InOutput,
+	FGameFloatSmoothingCallback InCallback,
+	float const InErrorTolerance
+)
+{
+	checkf(IsInGameThread(), TEXT("%s must be called on the game thread"), TEXT(__FUNCTION__));
+
+	int32 Slot = INDEX_NONE;
+	if(FreeSlots.Num() > 0)
+	{
+		Slot = FreeSlots.Pop(/*bAllowShrinking*/false);
+	}
+	else
+	{
+		Slot = SlotChannelIndices.Add(INDEX_NONE);
+		SlotSerials.Add(0);
+	}
+	SlotSerials[Slot]++;
+
+	int32 const ChannelIndex = CurrValues.Add(InCurrValue);
+	TargetValues.Add(InTargetValue);
+	Updates.Add(InUpdate);
+	ErrorTolerances.Add(InErrorTolerance);
+	Outputs.Add(InOutput);
+	Callbacks.Add(MoveTemp(InCallback));
+	ChangedFlags.Add(0);
+	ChannelSlots.Add(Slot);
+	SlotChannelIndices[Slot] = ChannelIndex;
+
+	if(InOutput)
+	{
+		*InOutput = InCurrValue;
+	}
+
+	return FGameFloatSmoothingHandle{Slot, SlotSerials[Slot]};
+}
+
+void UGameFloatSmoothingManager::UnregisterChannel(FGameFloatSmoothingHandle& InOutHandle)
+{
+	int32 const ChannelIndex = GetChannelIndex(InOutHandle);
+	if(ChannelIndex != INDEX_NONE)
+	{
+		int32 const Slot = InOutHandle.Slot;
+		// Invalidating all copies of the handle
+		SlotSerials[Slot]++;
+		if(bWritingBack)
+		{
+			// Channel arrays must NOT be reordered while we iterate them
+			// (the callback being called is moved out of the array by WriteBack, so resetting it here is safe)
+			Outputs[ChannelIndex] = nullptr;
+			Callbacks[ChannelIndex] = nullptr;
+			PendingRemoveSlots.Add(Slot);
+		}
+		else
+		{
+			RemoveChannelAt(ChannelIndex);
+		}
+	}
+	InOutHandle.Reset();
+}
+
+void UGameFloatSmoothingManager::RemoveChannelAt(int32 const InChannelIndex)
+{
+	int32 const Slot = ChannelSlots[InChannelIndex];
+	int32 const LastIndex = CurrValues.Num() - 1;
+	if(InChannelIndex != LastIndex)
+	{
+		// Moving the last channel into the hole, so the arrays stay contiguous
+		CurrValues[InChannelIndex] = CurrValues[LastIndex];
+		TargetValues[InChannelIndex] = TargetValues[LastIndex];
+		Updates[InChannelIndex] = Updates[LastIndex];
+		ErrorTolerances[InChannelIndex] = ErrorTolerances[LastIndex];
+		Outputs[InChannelIndex] = Outputs[LastIndex];
+		Callbacks[InChannelIndex] = MoveTemp(Callbacks[LastIndex]);
+		ChangedFlags[InChannelIndex] = ChangedFlags[LastIndex];
+		ChannelSlots[InChannelIndex] = ChannelSlots[LastIndex];
+		SlotChannelIndices[ChannelSlots[InChannelIndex]] = InChannelIndex;
+	}
+	CurrValues.Pop(/*bAllowShrinking*/false);
+	TargetValues.Pop(false);
+	Updates.Pop(false);
+	ErrorTolerances.Pop(false);
+	Outputs.Pop(false);
+	Callbacks.Pop(false);
+	ChangedFlags.Pop(false);
+	ChannelSlots.Pop(false);
+
+	SlotChannelIndices[Slot] = INDEX_NONE;
+	FreeSlots.Add(Slot);
+}
+
+bool UGameFloatSmoothingManager::IsChannelValid(const FGameFloatSmoothingHandle& InHandle) const
+{
+	return GetChannelIndex(InHandle) != INDEX_NONE;
+}
+
+int32 UGameFloatSmoothingManager::GetChannelIndex(const FGameFloatSmoothingHandle& InHandle) const
+{
+	if( ! SlotChannelIndices.IsValidIndex(InHandle.Slot) )
+	{
+		return INDEX_NONE;
+	}
+	if(SlotSerials[InHandle.Slot] != InHandle.Serial)
+	{
+		return INDEX_NONE;
+	}
+	return SlotChannelIndices[InHandle.Slot];
+}
+
+int32 UGameFloatSmoothingManager::GetChannelIndexChecked(const FGameFloatSmoothingHandle& InHandle, const TCHAR* const InFunctionName) const
+{
+	int32 const ChannelIndex = GetChannelIndex(InHandle);
+	checkf(ChannelIndex != INDEX_NONE, TEXT("When calling %s the channel handle must be valid"), InFunctionName);
+	return ChannelIndex;
+}
+
+void UGameFloatSmoothingManager::SetTargetValue(const FGameFloatSmoothingHandle& InHandle, float const InTargetValue)
+{
+	TargetValues[GetChannelIndexChecked(InHandle, TEXT(__FUNCTION__))] = InTargetValue;
+}
+
+void UGameFloatSmoothingManager::SetCurrValue(const FGameFloatSmoothingHandle& InHandle, float const InCurrValue)
+{
+	int32 const ChannelIndex = GetChannelIndexChecked(InHandle, TEXT(__FUNCTION__));
+	CurrValues[ChannelIndex] = InCurrValue;
+	if(Outputs[ChannelIndex])
+	{
+		*Outputs[ChannelIndex] = InCurrValue;
+	}
+}
+
+void UGameFloatSmoothingManager::SetUpdate(const FGameFloatSmoothingHandle& InHandle, const FGameFloatUpdate& InUpdate)
+{
+	Updates[GetChannelIndexChecked(InHandle, TEXT(__FUNCTION__))] = InUpdate;
+}
+
+float UGameFloatSmoothingManager::GetCurrValue(const FGameFloatSmoothingHandle& InHandle) const
+{
+	return CurrValues[GetChannelIndexChecked(InHandle, TEXT(__FUNCTION__))];
+}
+
+float UGameFloatSmoothingManager::GetTargetValue(const FGameFloatSmoothingHandle& InHandle) const
+{
+	return TargetValues[GetChannelIndexChecked(InHandle, TEXT(__FUNCTION__))];
+}
+
+void UGameFloatSmoothingManager::UpdateChannels(float const InDeltaTime)
+{
+	checkf(IsInGameThread(), TEXT("%s must be called on the game thread"), TEXT(__FUNCTION__));
+
+	int32 const NumToUpdate = CurrValues.Num();
+	if(NumToUpdate == 0)
+	{
+		return;
+	}
+
+	int32 const ParallelMinChannels = CVarSmoothingParallelMinChannels.GetValueOnGameThread();
+	if(ParallelMinChannels > 0 && NumToUpdate >= ParallelMinChannels)
+	{
+		int32 const NumBatches = FMath::DivideAndRoundUp(NumToUpdate, PARALLEL_BATCH_SIZE);
+		ParallelFor(NumBatches, [this, InDeltaTime, NumToUpdate](int32 const InBatchIndex)
+		{
+			int32 const First = InBatchIndex * PARALLEL_BATCH_SIZE;
+			UpdateChannelRange(InDeltaTime, First, FMath::Min(First + PARALLEL_BATCH_SIZE, NumToUpdate));
+		});
+	}
+	else
+	{
+		UpdateChannelRange(InDeltaTime, 0, NumToUpdate);
+	}
+
+	WriteBack();
+}
+
+void UGameFloatSmoothingManager::UpdateChannelRange(float const InDeltaTime, int32 const InFirst, int32 const InEnd)
+{
+	float* const pCurrValues = CurrValues.GetData();
+	const float* const pTargetValues = TargetValues.GetData();
+	const FGameFloatUpdate* const pUpdates = Updates.GetData();
+	const float* const pErrorTolerances = ErrorTolerances.GetData();
+	uint8* const pChangedFlags = ChangedFlags.GetData();
+	for(int32 ChannelIndex = InFirst; ChannelIndex < InEnd; ++ChannelIndex)
+	{
+		float const OldValue = pCurrValues[ChannelIndex];
+		float const NewValue = UGameMath::GetFloatUpdatedToTarget(InDeltaTime, OldValue, pTargetValues[ChannelIndex], pUpdates[ChannelIndex], pErrorTolerances[ChannelIndex]);
+		pCurrValues[ChannelIndex] = NewValue;
+		pChangedFlags[ChannelIndex] = (NewValue != OldValue) ? 1 : 0;
+	}
+}
+
+void UGameFloatSmoothingManager::WriteBack()
+{
+	{
+		TGuardValue<bool> WritingBackGuard { bWritingBack, true };
+		int32 const NumToWrite = CurrValues.Num();
+		for(int32 ChannelIndex = 0; ChannelIndex < NumToWrite; ++ChannelIndex)
+		{
+			if(ChangedFlags[ChannelIndex] == 0)
+			{
+				continue;
+			}
+			float const Value = CurrValues[ChannelIndex];
+			if(float* const Output = Outputs[ChannelIndex])
+			{
+				*Output = Value;
+			}
+			if(Callbacks[ChannelIndex])
+			{
+				// The callback may register (reallocating the arrays) or unregister (resetting the callback) channels,
+				// so it's moved out of the array while called, and moved back unless its channel is unregistered.
+				// Channel indices do NOT change during the write-back (removals are pending, new channels are appended).
+				int32 const Slot = ChannelSlots[ChannelIndex];
+				int32 const Serial = SlotSerials[Slot];
+				FGameFloatSmoothingCallback Callback = MoveTemp(Callbacks[ChannelIndex]);
+				Callback(Value);
+				if(SlotSerials[Slot] == Serial)
+				{
+					Callbacks[ChannelIndex] = MoveTemp(Callback);
+				}
+			}
+		}
+	}
+
+	for(int32 const Slot : PendingRemoveSlots)
+	{
+		RemoveChannelAt(SlotChannelIndices[Slot]);
+	}
+	PendingRemoveSlots.Reset();
+}
+
+void UGameFloatSmoothingManager::Tick(float const InDeltaTime)
+{
+	UpdateChannels(InDeltaTime);
+}
+
+bool UGameFloatSmoothingManager::IsTickable() const
+{
+	// Class default object is also registered as a tickable object, so we must skip it
+	return World != nullptr && ! HasAnyFlags(RF_ClassDefaultObject);
+}
+
+TStatId UGameFloatSmoothingManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGameFloatSmoothingManager, STATGROUP_Tickables);
+}
+
+UWorld* UGameFloatSmoothingManager::GetTickableGameObjectWorld() const
+{
+	return World;
+}
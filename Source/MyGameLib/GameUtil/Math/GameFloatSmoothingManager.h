@@ -0,0 +1,143 @@
+#pragma once
+
+#include "GameMathTypes.h"
+#include "GameFloatSmoothingTypes.h"
+#include "Tickable.h"
+#include "UObject/Object.h"
+#include "Math/UnrealMathUtility.h"
+#include "GameFloatSmoothingManager.generated.h"
+
+class UWorld;
+
+/**
+* Owns the float smoothing channels of the world and updates all of them in a single batched tick,
+* so actors do NOT need to tick only to call UGameMath::GetFloatUpdatedToTarget.
+*
+* Channel state (current/target/update) is kept in contiguous arrays;
+* large batches are updated in parallel (see GameMath.Smoothing.ParallelMinChannels).
+* Results are written back after the batch on the game thread through direct pointers or callbacks.
+*
+* One manager is created lazily per world (see Get) and released when the world is cleaned up.
+*/
+UCLASS()
+class UGameFloatSmoothingManager : public UObject, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	UGameFloatSmoothingManager();
+
+	/**
+	* Returns manager of the world of the given context object (creates it if necessary).
+	* @returns: nullptr if the world cannot be found for the given context object.
+	*/
+	UFUNCTION(BlueprintPure, Category=GameMath, Meta=(WorldContext="InWorldContextObject"))
+	static UGameFloatSmoothingManager* Get(const UObject* InWorldContextObject);
+
+	/**
+	* Returns manager of the given world (does NOT create it).
+	*/
+	static UGameFloatSmoothingManager* Find(const UWorld* InWorld);
+
+	// ~Channels Begin
+	/** RegisterChannel*/
+	UFUNCTION(BlueprintCallable, Category=GameMath, Meta=(DisplayName="RegisterChannel"))
+	FGameFloatSmoothingHandle K2_RegisterChannel(float InCurrValue, float InTargetValue, const FGameFloatUpdate& InUpdate);
+
+	/**
+	* Registers a new channel.
+	*
+	* @param InOutput: if non-NULL, the current value is written to it each time it's changed
+	* (the pointed float must outlive the channel!).
+	* @param InCallback: if bound, called each time the current value is changed.
+	*/
+	FGameFloatSmoothingHandle RegisterChannel
+	(
+		float InCurrValue, float InTargetValue, const FGameFloatUpdate& InUpdate,
+		float* InOutput = nullptr,
+		FGameFloatSmoothingCallback InCallback = FGameFloatSmoothingCallback(),
+		float InErrorTolerance = SMALL_NUMBER
+	);
+
+	/**
+	* Unregisters the channel and resets the handle.
+	* @note: works correctly ever if the handle is not valid.
+	*/
+	UFUNCTION(BlueprintCallable, Category=GameMath)
+	void UnregisterChannel(UPARAM(ref) FGameFloatSmoothingHandle& InOutHandle);
+
+	UFUNCTION(BlueprintPure, Category=GameMath)
+	bool IsChannelValid(const FGameFloatSmoothingHandle& InHandle) const;
+
+	UFUNCTION(BlueprintCallable, Category=GameMath)
+	void SetTargetValue(const FGameFloatSmoothingHandle& InHandle, float InTargetValue);
+
+	/**
+	* Sets current value immediately (without smoothing).
+	*/
+	UFUNCTION(BlueprintCallable, Category=GameMath)
+	void SetCurrValue(const FGameFloatSmoothingHandle& InHandle, float InCurrValue);
+
+	UFUNCTION(BlueprintCallable, Category=GameMath)
+	void SetUpdate(const FGameFloatSmoothingHandle& InHandle, const FGameFloatUpdate& InUpdate);
+
+	UFUNCTION(BlueprintPure, Category=GameMath)
+	float GetCurrValue(const FGameFloatSmoothingHandle& InHandle) const;
+
+	UFUNCTION(BlueprintPure, Category=GameMath)
+	float GetTargetValue(const FGameFloatSmoothingHandle& InHandle) const;
+
+	/**
+	* @returns: count of registered channels.
+	*/
+	UFUNCTION(BlueprintPure, Category=GameMath)
+	int32 NumChannels() const { return CurrValues.Num(); }
+
+	/**
+	* Updates all channels by the given time and writes results back.
+	* Called automatically each tick of the world.
+	*/
+	void UpdateChannels(float InDeltaTime);
+	// ~Channels End
+
+	// ~FTickableGameObject Begin
+	virtual void Tick(float InDeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override;
+	// ~FTickableGameObject End
+
+private:
+	static void HandleWorldCleanup(UWorld* InWorld, bool bInSessionEnded, bool bInCleanupResources);
+
+	/** @returns: index in the channel arrays or INDEX_NONE if handle is not valid*/
+	int32 GetChannelIndex(const FGameFloatSmoothingHandle& InHandle) const;
+	int32 GetChannelIndexChecked(const FGameFloatSmoothingHandle& InHandle, const TCHAR* InFunctionName) const;
+
+	void UpdateChannelRange(float InDeltaTime, int32 InFirst, int32 InEnd);
+	void WriteBack();
+	void RemoveChannelAt(int32 InChannelIndex);
+
+	UWorld* World = nullptr;
+
+	// ~Channel arrays Begin (all have the same length, indexed by channel index)
+	TArray<float> CurrValues;
+	TArray<float> TargetValues;
+	TArray<FGameFloatUpdate> Updates;
+	TArray<float> ErrorTolerances;
+	TArray<float*> Outputs;
+	TArray<FGameFloatSmoothingCallback> Callbacks;
+	TArray<uint8> ChangedFlags;
+	TArray<int32> ChannelSlots;
+	// ~Channel arrays End
+
+	// ~Slots Begin (handles point to slots, slots point to channels)
+	TArray<int32> SlotChannelIndices;
+	TArray<int32> SlotSerials;
+	TArray<int32> FreeSlots;
+	// ~Slots End
+
+	/** Channels unregistered from inside the write-back callbacks (removed after the write-back)*/
+	TArray<int32> PendingRemoveSlots;
+	bool bWritingBack = false;
+};
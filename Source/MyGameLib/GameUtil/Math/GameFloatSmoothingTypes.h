@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Templates/Function.h"
+#include "GameFloatSmoothingTypes.generated.h"
+
+/**
+* Called with the new current value of the channel (after the batched update, only if the value changed).
+*/
+using FGameFloatSmoothingCallback = TFunction<void(float)>;
+
+/** Handle of the float channel registered inside UGameFloatSmoothingManager*/
+USTRUCT(BlueprintType, Category=GameMath)
+struct FGameFloatSmoothingHandle
+{
+	GENERATED_BODY()
+
+	/** Slot of the channel inside the manager (INDEX_NONE if the handle is not bound)*/
+	UPROPERTY()
+	int32 Slot = INDEX_NONE;
+
+	/** Serial number of the slot: protects from reusing handles of already unregistered channels*/
+	UPROPERTY()
+	int32 Serial = 0;
+
+	FGameFloatSmoothingHandle() {}
+	FGameFloatSmoothingHandle(int32 InSlot, int32 InSerial) :
+		Slot ( InSlot )
+	,	Serial ( InSerial )
+	{
+	}
+
+	/**
+	* @returns: true if the handle was ever bound to a channel
+	* (the channel may be already unregistered, use UGameFloatSmoothingManager::IsChannelValid to be sure).
+	*/
+	bool IsBound() const { return Slot != INDEX_NONE; }
+
+	void Reset()
+	{
+		Slot = INDEX_NONE;
+		Serial = 0;
+	}
+
+	bool operator==(const FGameFloatSmoothingHandle& InOther) const
+	{
+		return Slot == InOther.Slot && Serial == InOther.Serial;
+	}
+
+	bool operator!=(const FGameFloatSmoothingHandle& InOther) const
+	{
+		return ! (*this == InOther);
+	}
+};
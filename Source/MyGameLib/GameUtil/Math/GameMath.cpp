@@ -1,4 +1,6 @@
 #include "GameMath.h"
+#include "Core/GameMathCore.h"
+#include "Math/VectorRegister.h"
 
 float UGameMath::K2_GetFloatUpdatedToTarget(float const InDeltaTime, float const InCurrValue, float const InTargetValue, const FGameFloatUpdate& InUpdate)
 {
@@ -7,24 +9,112 @@ float UGameMath::K2_GetFloatUpdatedToTarget(float const InDeltaTime, float const
 
 float UGameMath::GetFloatUpdatedToTarget(float const InDeltaTime, float const InCurrValue, float const InTargetValue, const FGameFloatUpdate& InUpdate, float InErrorTolerance)
 {
-	float UpdatedValue = InCurrValue;
-	if(FMath::IsNearlyEqual(InTargetValue, InCurrValue, InErrorTolerance))
+	return GameMathCore::GetFloatUpdatedToTarget(InDeltaTime, InCurrValue, InTargetValue, InUpdate.Acceleration, InUpdate.Deceleration, InErrorTolerance);
+}
+
+// ~Frame-rate independent smoothing Begin
+namespace
+{
+	/** Number of floats in one vector register*/
+	constexpr int32 NUM_FLOATS_PER_REGISTER = 4;
+
+	/** Part of the distance to the target that remains after the exponential smoothing*/
+	FORCEINLINE float GetExpDecay(float const InDeltaTime, float const InSpeed)
 	{
-		UpdatedValue = InTargetValue;
+		checkf(InSpeed >= 0.0F, TEXT("Smoothing speed must be non-negative in %s"), TEXT(__FUNCTION__));
+		return GameMathCore::GetExpDecay(InDeltaTime, InSpeed);
+	}
+} // anonymous
+
+float UGameMath::K2_GetFloatExpSmoothed(float const InDeltaTime, float const InCurrValue, float const InTargetValue, float const InSmoothingSpeed)
+{
+	return GetFloatExpSmoothed(InDeltaTime, InCurrValue, InTargetValue, InSmoothingSpeed);
+}
+
+float UGameMath::GetFloatExpSmoothed(float const InDeltaTime, float const InCurrValue, float const InTargetValue, float const InSmoothingSpeed)
+{
+	checkf(InSmoothingSpeed >= 0.0F, TEXT("Smoothing speed must be non-negative in %s"), TEXT(__FUNCTION__));
+	return GameMathCore::GetFloatExpSmoothed(InDeltaTime, InCurrValue, InTargetValue, InSmoothingSpeed);
+}
+
+FVector UGameMath::GetVectorExpSmoothed(float const InDeltaTime, const FVector& InCurrValue, const FVector& InTargetValue, float const InSmoothingSpeed)
+{
+	checkf(InSmoothingSpeed >= 0.0F, TEXT("Smoothing speed must be non-negative in %s"), TEXT(__FUNCTION__));
+	return GameMathCore::GetExpSmoothed(InDeltaTime, InCurrValue, InTargetValue, InSmoothingSpeed);
+}
+
+void UGameMath::UpdateFloatsExpSmoothed(float const InDeltaTime, TArrayView<float> InOutValues, TArrayView<const float> InTargetValues, float const InSmoothingSpeed)
+{
+	checkf(InOutValues.Num() == InTargetValues.Num(), TEXT("Number of values and targets must match in %s"), TEXT(__FUNCTION__));
+	float const Decay = GetExpDecay(InDeltaTime, InSmoothingSpeed);
+	int32 const NumValues = InOutValues.Num();
+	int32 const NumVectorized = NumValues - (NumValues % NUM_FLOATS_PER_REGISTER);
+	float* const pValues = InOutValues.GetData();
+	const float* const pTargets = InTargetValues.GetData();
+
+	VectorRegister const DecayRegister = VectorSetFloat1(Decay);
+	for(int32 Index = 0; Index < NumVectorized; Index += NUM_FLOATS_PER_REGISTER)
+	{
+		VectorRegister const Values = VectorLoad(pValues + Index);
+		VectorRegister const Targets = VectorLoad(pTargets + Index);
+		VectorStore(VectorMultiplyAdd(VectorSubtract(Values, Targets), DecayRegister, Targets), pValues + Index);
+	}
+	for(int32 Index = NumVectorized; Index < NumValues; ++Index)
+	{
+		pValues[Index] = pTargets[Index] + (pValues[Index] - pTargets[Index]) * Decay;
+	}
+}
+
+float UGameMath::K2_UpdateFloatCriticallyDampedSpring(float const InDeltaTime, float const InCurrValue, float& InOutVelocity, float const InTargetValue, float const InAngularFrequency)
+{
+	float Value = InCurrValue;
+	UpdateFloatCriticallyDampedSpring(InDeltaTime, Value, InOutVelocity, InTargetValue, InAngularFrequency);
+	return Value;
+}
+
+void UGameMath::UpdateFloatCriticallyDampedSpring(float const InDeltaTime, float& InOutValue, float& InOutVelocity, float const InTargetValue, float const InAngularFrequency)
+{
+	checkf(InAngularFrequency >= 0.0F, TEXT("Angular frequency must be non-negative in %s"), TEXT(__FUNCTION__));
+	GameMathCore::UpdateFloatCriticallyDampedSpring(InDeltaTime, InOutValue, InOutVelocity, InTargetValue, InAngularFrequency);
+}
+
+void UGameMath::UpdateVectorCriticallyDampedSpring(float const InDeltaTime, FVector& InOutValue, FVector& InOutVelocity, const FVector& InTargetValue, float const InAngularFrequency)
+{
+	checkf(InAngularFrequency >= 0.0F, TEXT("Angular frequency must be non-negative in %s"), TEXT(__FUNCTION__));
+	GameMathCore::UpdateCriticallyDampedSpring(InDeltaTime, InOutValue, InOutVelocity, InTargetValue, InAngularFrequency);
+}
+
+void UGameMath::UpdateFloatsCriticallyDampedSpring(float const InDeltaTime, TArrayView<float> InOutValues, TArrayView<float> InOutVelocities, TArrayView<const float> InTargetValues, float const InAngularFrequency)
+{
+	checkf(InOutValues.Num() == InTargetValues.Num() && InOutValues.Num() == InOutVelocities.Num(), TEXT("Number of values, velocities and targets must match in %s"), TEXT(__FUNCTION__));
+	float const Decay = GetExpDecay(InDeltaTime, InAngularFrequency);
+	int32 const NumValues = InOutValues.Num();
+	int32 const NumVectorized = NumValues - (NumValues % NUM_FLOATS_PER_REGISTER);
+	float* const pValues = InOutValues.GetData();
+	float* const pVelocities = InOutVelocities.GetData();
+	const float* const pTargets = InTargetValues.GetData();
+
+	VectorRegister const DecayRegister = VectorSetFloat1(Decay);
+	VectorRegister const FrequencyRegister = VectorSetFloat1(InAngularFrequency);
+	VectorRegister const DeltaTimeRegister = VectorSetFloat1(InDeltaTime);
+	VectorRegister const NegFrequencyDeltaTimeRegister = VectorSetFloat1(-InAngularFrequency * InDeltaTime);
+	for(int32 Index = 0; Index < NumVectorized; Index += NUM_FLOATS_PER_REGISTER)
+	{
+		VectorRegister const Values = VectorLoad(pValues + Index);
+		VectorRegister const Velocities = VectorLoad(pVelocities + Index);
+		VectorRegister const Targets = VectorLoad(pTargets + Index);
+
+		VectorRegister const Offsets = VectorSubtract(Values, Targets);
+		VectorRegister const Temps = VectorMultiplyAdd(FrequencyRegister, Offsets, Velocities);
+		VectorRegister const NewOffsets = VectorMultiply(VectorMultiplyAdd(Temps, DeltaTimeRegister, Offsets), DecayRegister);
+		VectorRegister const NewVelocities = VectorMultiply(VectorMultiplyAdd(Temps, NegFrequencyDeltaTimeRegister, Velocities), DecayRegister);
+
+		VectorStore(VectorAdd(Targets, NewOffsets), pValues + Index);
+		VectorStore(NewVelocities, pVelocities + Index);
 	}
-	else
+	for(int32 Index = NumVectorized; Index < NumValues; ++Index)
 	{
-		float const DeltaToTarget = InTargetValue - InCurrValue;
-		if(DeltaToTarget < 0)
-		{
-			UpdatedValue -= InDeltaTime * InUpdate.Deceleration;
-			UpdatedValue = FMath::Max(InTargetValue, UpdatedValue);
-		}	
-		else
-		{
-			UpdatedValue += InDeltaTime * InUpdate.Acceleration;
-			UpdatedValue = FMath::Min(InTargetValue, UpdatedValue);
-		}
+		GameMathCore::StepCriticallyDampedSpring(InDeltaTime, Decay, InAngularFrequency, pValues[Index], pVelocities[Index], pTargets[Index]);
 	}
-	return UpdatedValue;
 }
+// ~Frame-rate independent smoothing End
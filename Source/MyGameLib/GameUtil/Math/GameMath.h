@@ -1,8 +1,10 @@
 #pragma once
 
 #include "GameMathTypes.h"
+#include "GameMathPolicies.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Math/UnrealMathUtility.h"
+#include "Containers/ArrayView.h"
 #include "GameMath.generated.h"
 
 UCLASS()
@@ -17,4 +19,71 @@ public:
 
 	/** GetFloatUpdatedToTarget*/
 	static float GetFloatUpdatedToTarget(float InDeltaTime, float InCurrValue, float InTargetValue, const FGameFloatUpdate& InUpdate, float InErrorTolerance = SMALL_NUMBER);
+
+	/**
+	* GetFloatUpdatedToTarget specialized by the policies known at compile time.
+	*
+	* @param RatePolicyT: FGameFloatRate_Asymmetric (generic behaviour), FGameFloatRate_Symmetric, FGameFloatRate_AccelerateOnly, FGameFloatRate_DecelerateOnly
+	* @param TolerancePolicyT: FGameFloatTolerance_Runtime (generic behaviour), FGameFloatTolerance_Zero
+	*
+	* @see GameMathPolicies.h, TGameFloatUpdater
+	*/
+	template<class RatePolicyT, class TolerancePolicyT = FGameFloatTolerance_Runtime>
+	static FORCEINLINE float GetFloatUpdatedToTargetT(float const InDeltaTime, float const InCurrValue, float const InTargetValue, const FGameFloatUpdate& InUpdate, float const InErrorTolerance = SMALL_NUMBER)
+	{
+		float const SteppedValue = RatePolicyT::Step(InDeltaTime, InCurrValue, InTargetValue, InUpdate.Acceleration, InUpdate.Deceleration);
+		return TolerancePolicyT::Snap(InCurrValue, InTargetValue, SteppedValue, InErrorTolerance);
+	}
+
+	// ~Frame-rate independent smoothing Begin
+	/**
+	* Exponential smoothing towards the target: the distance to the target decays as exp(-SmoothingSpeed * t).
+	* Integrated exactly, so the result does NOT depend on how the time is split into frames.
+	*
+	* @param InSmoothingSpeed: decay rate in 1/seconds (must be non-negative, zero means no movement).
+	*/
+	UFUNCTION(BlueprintPure, Category=GameMath, Meta=(DisplayName="GetFloatExpSmoothed"))
+	static float K2_GetFloatExpSmoothed(float InDeltaTime, float InCurrValue, float InTargetValue, float InSmoothingSpeed);
+
+	/** @see K2_GetFloatExpSmoothed*/
+	static float GetFloatExpSmoothed(float InDeltaTime, float InCurrValue, float InTargetValue, float InSmoothingSpeed);
+
+	/** @see K2_GetFloatExpSmoothed*/
+	UFUNCTION(BlueprintPure, Category=GameMath)
+	static FVector GetVectorExpSmoothed(float InDeltaTime, const FVector& InCurrValue, const FVector& InTargetValue, float InSmoothingSpeed);
+
+	/**
+	* Exponential smoothing of the batch of values with the same speed (@see K2_GetFloatExpSmoothed).
+	* Decay is calculated once for the batch, values are updated with SIMD.
+	*/
+	static void UpdateFloatsExpSmoothed(float InDeltaTime, TArrayView<float> InOutValues, TArrayView<const float> InTargetValues, float InSmoothingSpeed);
+
+	/**
+	* Critically damped spring towards the target (fastest approach without overshoot).
+	* Integrated exactly (closed form), so the result does NOT depend on how the time is split into frames.
+	*
+	* @param InOutVelocity: state of the spring, must be kept between the updates (zero when at rest).
+	* @param InAngularFrequency: stiffness of the spring in radians/second (must be non-negative);
+	* approximately 2/SmoothTime, where SmoothTime is the time to reach the target.
+	*/
+	UFUNCTION(BlueprintCallable, Category=GameMath, Meta=(DisplayName="UpdateFloatCriticallyDampedSpring"))
+	static float K2_UpdateFloatCriticallyDampedSpring(float InDeltaTime, float InCurrValue, UPARAM(ref) float& InOutVelocity, float InTargetValue, float InAngularFrequency);
+
+	/**
+	* @see K2_UpdateFloatCriticallyDampedSpring
+	*/
+	static void UpdateFloatCriticallyDampedSpring(float InDeltaTime, float& InOutValue, float& InOutVelocity, float InTargetValue, float InAngularFrequency);
+
+	/**
+	* @see K2_UpdateFloatCriticallyDampedSpring
+	*/
+	UFUNCTION(BlueprintCallable, Category=GameMath)
+	static void UpdateVectorCriticallyDampedSpring(float InDeltaTime, UPARAM(ref) FVector& InOutValue, UPARAM(ref) FVector& InOutVelocity, const FVector& InTargetValue, float InAngularFrequency);
+
+	/**
+	* Critically damped spring for the batch of values with the same frequency (@see K2_UpdateFloatCriticallyDampedSpring).
+	* Decay is calculated once for the batch, values are updated with SIMD.
+	*/
+	static void UpdateFloatsCriticallyDampedSpring(float InDeltaTime, TArrayView<float> InOutValues, TArrayView<float> InOutVelocities, TArrayView<const float> InTargetValues, float InAngularFrequency);
+	// ~Frame-rate independent smoothing End
 };
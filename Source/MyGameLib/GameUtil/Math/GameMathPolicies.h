@@ -0,0 +1,152 @@
+#pragma once
+
+/**
+* Compile-time policies of the UGameMath::GetFloatUpdatedToTargetT family.
+*
+* Rate policy tells how the value moves towards the target,
+* tolerance policy tells when the value is snapped to the target.
+* Each combination compiles to a short branchless sequence (min/max/select).
+*
+* @warning: rates must be non-negative (see GameMathPolicy::ValidatedRate).
+*/
+
+#include "GameMathTypes.h"
+#include "Math/UnrealMathUtility.h"
+#include "Misc/AssertionMacros.h"
+
+namespace GameMathPolicy
+{
+	/**
+	* Called when invalid parameter is passed to the validating functions.
+	* @note: NOT constexpr, so passing invalid parameter inside the constant expression breaks the compilation.
+	*/
+	inline void OnInvalidParameter(const TCHAR* const InParameterName)
+	{
+		checkf(false, TEXT("GameMath policy parameter \"%s\" is invalid"), InParameterName);
+	}
+
+	constexpr bool IsValidRate(float const InRate)
+	{
+		return InRate >= 0.0F;
+	}
+
+	constexpr bool IsValidErrorTolerance(float const InErrorTolerance)
+	{
+		return InErrorTolerance >= 0.0F;
+	}
+
+	/**
+	* Returns the given rate if it's valid.
+	* Compile error when used in constant expression with invalid value, assertion at runtime.
+	*/
+	constexpr float ValidatedRate(float const InRate)
+	{
+		return IsValidRate(InRate) ? InRate : (OnInvalidParameter(TEXT("Rate")), InRate);
+	}
+
+	/**
+	* @see ValidatedRate
+	*/
+	constexpr float ValidatedErrorTolerance(float const InErrorTolerance)
+	{
+		return IsValidErrorTolerance(InErrorTolerance) ? InErrorTolerance : (OnInvalidParameter(TEXT("ErrorTolerance")), InErrorTolerance);
+	}
+} // GameMathPolicy
+
+// ~Rate policies Begin
+/**
+* Accelerates towards greater target, decelerates towards smaller target
+* (the same as the generic UGameMath::GetFloatUpdatedToTarget).
+*/
+struct FGameFloatRate_Asymmetric
+{
+	static FORCEINLINE float Step(float const InDeltaTime, float const InCurrValue, float const InTargetValue, float const InAcceleration, float const InDeceleration)
+	{
+		return FMath::Clamp(InTargetValue, InCurrValue - InDeltaTime * InDeceleration, InCurrValue + InDeltaTime * InAcceleration);
+	}
+};
+
+/**
+* Uses FGameFloatUpdate::Acceleration in both directions (Deceleration is ignored).
+*/
+struct FGameFloatRate_Symmetric
+{
+	static FORCEINLINE float Step(float const InDeltaTime, float const InCurrValue, float const InTargetValue, float const InAcceleration, float const /*InDeceleration*/)
+	{
+		float const MaxDelta = InDeltaTime * InAcceleration;
+		return FMath::Clamp(InTargetValue, InCurrValue - MaxDelta, InCurrValue + MaxDelta);
+	}
+};
+
+/**
+* Only accelerates: smaller target is reached immediately (Deceleration is ignored).
+*/
+struct FGameFloatRate_AccelerateOnly
+{
+	static FORCEINLINE float Step(float const InDeltaTime, float const InCurrValue, float const InTargetValue, float const InAcceleration, float const /*InDeceleration*/)
+	{
+		return FMath::Min(InTargetValue, InCurrValue + InDeltaTime * InAcceleration);
+	}
+};
+
+/**
+* Only decelerates: greater target is reached immediately (Acceleration is ignored).
+*/
+struct FGameFloatRate_DecelerateOnly
+{
+	static FORCEINLINE float Step(float const InDeltaTime, float const InCurrValue, float const InTargetValue, float const /*InAcceleration*/, float const InDeceleration)
+	{
+		return FMath::Max(InTargetValue, InCurrValue - InDeltaTime * InDeceleration);
+	}
+};
+// ~Rate policies End
+
+// ~Tolerance policies Begin
+/**
+* Snaps to the target when the value is nearly equal to it with the runtime tolerance
+* (the same as the generic UGameMath::GetFloatUpdatedToTarget).
+*/
+struct FGameFloatTolerance_Runtime
+{
+	static FORCEINLINE float Snap(float const InCurrValue, float const InTargetValue, float const InSteppedValue, float const InErrorTolerance)
+	{
+		return (FMath::Abs(InTargetValue - InCurrValue) <= InErrorTolerance) ? InTargetValue : InSteppedValue;
+	}
+};
+
+/**
+* No snapping: the target is reached exactly by the rate policy itself, tolerance is ignored.
+*/
+struct FGameFloatTolerance_Zero
+{
+	static FORCEINLINE float Snap(float const /*InCurrValue*/, float const /*InTargetValue*/, float const InSteppedValue, float const /*InErrorTolerance*/)
+	{
+		return InSteppedValue;
+	}
+};
+// ~Tolerance policies End
+
+/**
+* Updater with the policies and the parameters fixed.
+* Parameters are validated at compile time when the updater is constexpr.
+*/
+template<class RatePolicyT, class TolerancePolicyT = FGameFloatTolerance_Runtime>
+struct TGameFloatUpdater
+{
+	float Acceleration;
+	float Deceleration;
+	float ErrorTolerance;
+
+	constexpr TGameFloatUpdater(float const InAcceleration, float const InDeceleration, float const InErrorTolerance = SMALL_NUMBER) :
+		Acceleration ( GameMathPolicy::ValidatedRate(InAcceleration) )
+	,	Deceleration ( GameMathPolicy::ValidatedRate(InDeceleration) )
+	,	ErrorTolerance ( GameMathPolicy::ValidatedErrorTolerance(InErrorTolerance) )
+	{
+	}
+
+	FORCEINLINE float Update(float const InDeltaTime, float const InCurrValue, float const InTargetValue) const
+	{
+		float const SteppedValue = RatePolicyT::Step(InDeltaTime, InCurrValue, InTargetValue, Acceleration, Deceleration);
+		return TolerancePolicyT::Snap(InCurrValue, InTargetValue, SteppedValue, ErrorTolerance);
+	}
+};
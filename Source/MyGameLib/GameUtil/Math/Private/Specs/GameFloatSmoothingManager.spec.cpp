@@ -0,0 +1,109 @@
+#include "GameUtil/Math/GameFloatSmoothingManager.h"
+#include "GameUtil/Math/GameMath.h"
+#include "Util/Core/WorldUtilLib.h"
+
+#include "AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(GameFloatSmoothingManagerSpec, "MyGameUtil.Math.GameFloatSmoothingManagerSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+	UWorld* W = nullptr;
+	UGameFloatSmoothingManager* Manager = nullptr;
+END_DEFINE_SPEC(GameFloatSmoothingManagerSpec)
+
+void GameFloatSmoothingManagerSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		W = UWorldUtilLib::NewGameWorldAndContext();
+		TestNotNull(TEXT("NewGameWorldAndContext should NOT fail"), W);
+
+		Manager = UGameFloatSmoothingManager::Get(W);
+		TestNotNull(TEXT("Manager must be created for the world"), Manager);
+	});
+
+	Describe("UpdateChannels", [this]()
+	{
+		It("should produce the same values as UGameMath::GetFloatUpdatedToTarget", [this]()
+		{
+			FGameFloatUpdate const Update { 2.0F, 3.0F };
+			float Output = 0.0F;
+			FGameFloatSmoothingHandle const Handle = Manager->RegisterChannel(0.0F, 10.0F, Update, &Output);
+
+			float Expected = 0.0F;
+			for(int32 StepIndex = 0; StepIndex < 10; ++StepIndex)
+			{
+				Manager->UpdateChannels(0.5F);
+				Expected = UGameMath::GetFloatUpdatedToTarget(0.5F, Expected, 10.0F, Update);
+			}
+			TestEqual(TEXT("Current value must match the generic update"), Manager->GetCurrValue(Handle), Expected);
+			TestEqual(TEXT("Output pointer must be written back"), Output, Expected);
+		});
+
+		It("should call the callback only when value is changed", [this]()
+		{
+			int32 NumCalls = 0;
+			Manager->RegisterChannel(5.0F, 5.0F, FGameFloatUpdate{1.0F, 1.0F}, nullptr, [&NumCalls](float) { NumCalls++; });
+			Manager->UpdateChannels(0.1F);
+			TestEqual(TEXT("Settled channel must NOT call the callback"), NumCalls, 0);
+		});
+	});
+
+	Describe("UnregisterChannel", [this]()
+	{
+		It("should invalidate the handle and keep other channels valid", [this]()
+		{
+			FGameFloatSmoothingHandle First = Manager->RegisterChannel(0.0F, 1.0F, FGameFloatUpdate{1.0F, 1.0F});
+			FGameFloatSmoothingHandle const FirstCopy = First;
+			FGameFloatSmoothingHandle const Second = Manager->RegisterChannel(7.0F, 7.0F, FGameFloatUpdate{1.0F, 1.0F});
+
+			Manager->UnregisterChannel(First);
+			TestFalse(TEXT("Unregistered handle must be reset"), First.IsBound());
+			TestFalse(TEXT("Copy of the unregistered handle must be invalid"), Manager->IsChannelValid(FirstCopy));
+			TestTrue(TEXT("Other channel must stay valid"), Manager->IsChannelValid(Second));
+			TestEqual(TEXT("Other channel must keep its value"), Manager->GetCurrValue(Second), 7.0F);
+
+			FGameFloatSmoothingHandle const Reused = Manager->RegisterChannel(1.0F, 1.0F, FGameFloatUpdate{1.0F, 1.0F});
+			TestFalse(TEXT("Reused slot must NOT validate the stale handle"), Manager->IsChannelValid(FirstCopy));
+			TestTrue(TEXT("New handle must be valid"), Manager->IsChannelValid(Reused));
+		});
+
+		It("should allow to register and unregister channels from inside the callback", [this]()
+		{
+			FGameFloatSmoothingHandle Self;
+			TArray<FGameFloatSmoothingHandle> Registered;
+			int32 NumSelfCalls = 0;
+			int32 NumOtherCalls = 0;
+			FGameFloatSmoothingHandle const Other = Manager->RegisterChannel(0.0F, 100.0F, FGameFloatUpdate{1.0F, 1.0F}, nullptr, [&NumOtherCalls](float) { NumOtherCalls++; });
+			Self = Manager->RegisterChannel(0.0F, 1.0F, FGameFloatUpdate{1.0F, 1.0F}, nullptr, [this, &Self, &Registered, &NumSelfCalls](float)
+			{
+				NumSelfCalls++;
+				// Enough channels to reallocate the channel arrays
+				for(int32 ChannelIndex = 0; ChannelIndex < 64; ++ChannelIndex)
+				{
+					Registered.Add(Manager->RegisterChannel(0.0F, 1.0F, FGameFloatUpdate{1.0F, 1.0F}, nullptr, [](float) {}));
+				}
+				Manager->UnregisterChannel(Self);
+			});
+
+			Manager->UpdateChannels(0.1F);
+			TestEqual(TEXT("Callback of the unregistered channel calls"), NumSelfCalls, 1);
+			TestEqual(TEXT("Other callback calls"), NumOtherCalls, 1);
+			TestFalse(TEXT("Unregistered from the callback"), Manager->IsChannelValid(Self));
+			TestEqual(TEXT("Number of the channels"), Manager->NumChannels(), 1 + Registered.Num());
+
+			Manager->UpdateChannels(0.1F);
+			TestEqual(TEXT("Unregistered callback must NOT be called again"), NumSelfCalls, 1);
+			TestEqual(TEXT("Other callback calls after the update"), NumOtherCalls, 2);
+			for(const FGameFloatSmoothingHandle& Handle : Registered)
+			{
+				TestTrue(TEXT("Registered from the callback"), Manager->IsChannelValid(Handle));
+			}
+		});
+	});
+
+	AfterEach([this]()
+	{
+		Manager = nullptr;
+		UWorldUtilLib::DestroyWorldSafe(&W);
+		TestNull(TEXT("DestroyWorldSafe must succeed"), W);
+	});
+}
@@ -0,0 +1,143 @@
+#include "GameUtil/Math/GameMath.h"
+#include "GameUtil/Math/Core/GameMathCore.h"
+#include "GameUtil/Spline/Core/MySplineCore.h"
+
+#include "AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+	TArray<float> MakeRandomFloats(int32 const InNum, int32 const InSeed)
+	{
+		FRandomStream Random { InSeed };
+		TArray<float> Values;
+		Values.Reserve(InNum);
+		for(int32 Index = 0; Index < InNum; ++Index)
+		{
+			Values.Add(Random.FRandRange(-100.0F, 100.0F));
+		}
+		return Values;
+	}
+
+	/**
+	* @returns: nanoseconds per one value updated.
+	*/
+	template<class UpdateFuncT>
+	double MeasureNsPerValue(int32 const InNumValues, int32 const InNumPasses, UpdateFuncT InUpdateFunc)
+	{
+		double const StartSeconds = FPlatformTime::Seconds();
+		for(int32 PassIndex = 0; PassIndex < InNumPasses; ++PassIndex)
+		{
+			InUpdateFunc();
+		}
+		double const ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+		return ElapsedSeconds * 1.0e9 / (static_cast<double>(InNumValues) * InNumPasses);
+	}
+}
+
+DEFINE_SPEC(GameMathCoreSpec, "MyGameUtil.Math.GameMathCoreSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void GameMathCoreSpec::Define()
+{
+	Describe("GameMathCore", [this]()
+	{
+		It("should match the batched SIMD versions of UGameMath", [this]()
+		{
+			TArray<float> const Targets = MakeRandomFloats(37, 1);
+			TArray<float> CoreValues = MakeRandomFloats(37, 2);
+			TArray<float> CoreVelocities = MakeRandomFloats(37, 3);
+			TArray<float> Values = CoreValues;
+			TArray<float> Velocities = CoreVelocities;
+
+			GameMathCore::UpdateFloatsCriticallyDampedSpring(0.05F, CoreValues.GetData(), CoreVelocities.GetData(), Targets.GetData(), Targets.Num(), 6.0F);
+			UGameMath::UpdateFloatsCriticallyDampedSpring(0.05F, Values, Velocities, Targets, 6.0F);
+			for(int32 Index = 0; Index < Targets.Num(); ++Index)
+			{
+				TestEqual(TEXT("Value must match"), CoreValues[Index], Values[Index], KINDA_SMALL_NUMBER);
+				TestEqual(TEXT("Velocity must match"), CoreVelocities[Index], Velocities[Index], KINDA_SMALL_NUMBER);
+			}
+		});
+
+		It("should update the vector as the floats of its components", [this]()
+		{
+			FVector const Target { 10.0F, -20.0F, 30.0F };
+			FVector Value { -5.0F, 4.0F, 1.0F };
+			FVector Velocity { 1.0F, 2.0F, -3.0F };
+			FVector const Smoothed = UGameMath::GetVectorExpSmoothed(0.05F, Value, Target, 3.0F);
+			FVector const ValueBefore = Value;
+			FVector const VelocityBefore = Velocity;
+			UGameMath::UpdateVectorCriticallyDampedSpring(0.05F, Value, Velocity, Target, 6.0F);
+			for(int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				TestEqual(TEXT("Smoothed component"), Smoothed[Axis], GameMathCore::GetFloatExpSmoothed(0.05F, ValueBefore[Axis], Target[Axis], 3.0F), KINDA_SMALL_NUMBER);
+				float FloatValue = ValueBefore[Axis];
+				float FloatVelocity = VelocityBefore[Axis];
+				GameMathCore::UpdateFloatCriticallyDampedSpring(0.05F, FloatValue, FloatVelocity, Target[Axis], 6.0F);
+				TestEqual(TEXT("Spring value component"), Value[Axis], FloatValue, KINDA_SMALL_NUMBER);
+				TestEqual(TEXT("Spring velocity component"), Velocity[Axis], FloatVelocity, KINDA_SMALL_NUMBER);
+			}
+		});
+	});
+
+	Describe("MySplineCore", [this]()
+	{
+		It("should count the segments of the open and closed splines", [this]()
+		{
+			TestEqual(TEXT("Open spline"), MySplineCore::GetNumberOfSegments(4, false), 3);
+			TestEqual(TEXT("Closed spline"), MySplineCore::GetNumberOfSegments(4, true), 4);
+			TestEqual(TEXT("Empty spline"), MySplineCore::GetNumberOfSegments(0, true), 0);
+			TestEqual(TEXT("Last segment must end at the first point"), MySplineCore::GetSegmentEndPointIndex(3, 4), 0);
+			TestEqual(TEXT("End point of the empty spline"), MySplineCore::GetSegmentEndPointIndex(0, 0), 0);
+		});
+
+		It("should interpolate the distance and wrap at the last point", [this]()
+		{
+			float const PointDistances[] { 0.0F, 10.0F, 25.0F };
+			TestEqual(TEXT("Inside the segment"), MySplineCore::GetDistanceAlongSplineAtInputKey(0.5F, PointDistances, 3, 30.0F), 5.0F);
+			TestEqual(TEXT("Last segment of the loop"), MySplineCore::GetDistanceAlongSplineAtInputKey(2.5F, PointDistances, 3, 30.0F), 27.5F);
+			TestEqual(TEXT("Empty spline"), MySplineCore::GetDistanceAlongSplineAtInputKey(0.5F, PointDistances, 0, 0.0F), 0.0F);
+		});
+	});
+}
+
+DEFINE_SPEC(GameMathCoreBenchmark, "MyGameUtil.Math.GameMathCoreBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void GameMathCoreBenchmark::Define()
+{
+	It("should report ns per value for the batched kernels", [this]()
+	{
+		constexpr int32 NUM_VALUES = 16384;
+		constexpr int32 NUM_PASSES = 256;
+		TArray<float> const Targets = MakeRandomFloats(NUM_VALUES, 1);
+		TArray<float> Values = MakeRandomFloats(NUM_VALUES, 2);
+		TArray<float> Velocities = MakeRandomFloats(NUM_VALUES, 3);
+
+		double const ToTargetNs = MeasureNsPerValue(NUM_VALUES, NUM_PASSES, [&]()
+		{
+			GameMathCore::UpdateFloatsToTarget(0.016F, Values.GetData(), Targets.GetData(), NUM_VALUES, 3.0F, 5.0F, SMALL_NUMBER);
+		});
+		double const CoreExpNs = MeasureNsPerValue(NUM_VALUES, NUM_PASSES, [&]()
+		{
+			GameMathCore::UpdateFloatsExpSmoothed(0.016F, Values.GetData(), Targets.GetData(), NUM_VALUES, 3.0F);
+		});
+		double const SimdExpNs = MeasureNsPerValue(NUM_VALUES, NUM_PASSES, [&]()
+		{
+			UGameMath::UpdateFloatsExpSmoothed(0.016F, Values, Targets, 3.0F);
+		});
+		double const CoreSpringNs = MeasureNsPerValue(NUM_VALUES, NUM_PASSES, [&]()
+		{
+			GameMathCore::UpdateFloatsCriticallyDampedSpring(0.016F, Values.GetData(), Velocities.GetData(), Targets.GetData(), NUM_VALUES, 6.0F);
+		});
+		double const SimdSpringNs = MeasureNsPerValue(NUM_VALUES, NUM_PASSES, [&]()
+		{
+			UGameMath::UpdateFloatsCriticallyDampedSpring(0.016F, Values, Velocities, Targets, 6.0F);
+		});
+
+		AddInfo(FString::Printf(TEXT("Core UpdateFloatsToTarget: %.3f ns/value"), ToTargetNs));
+		AddInfo(FString::Printf(TEXT("Core UpdateFloatsExpSmoothed (plain loop): %.3f ns/value"), CoreExpNs));
+		AddInfo(FString::Printf(TEXT("UGameMath::UpdateFloatsExpSmoothed (SIMD): %.3f ns/value"), SimdExpNs));
+		AddInfo(FString::Printf(TEXT("Core UpdateFloatsCriticallyDampedSpring (plain loop): %.3f ns/value"), CoreSpringNs));
+		AddInfo(FString::Printf(TEXT("UGameMath::UpdateFloatsCriticallyDampedSpring (SIMD): %.3f ns/value"), SimdSpringNs));
+	});
+}
@@ -0,0 +1,206 @@
+#include "GameUtil/Math/GameMath.h"
+#include "GameUtil/Math/GameMathPolicies.h"
+
+#include "AutomationTest.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+	/** Input of one update call*/
+	struct FGameFloatUpdateSample
+	{
+		float DeltaTime;
+		float CurrValue;
+		float TargetValue;
+	};
+
+	/** Direction of the targets of the samples relative to the current values*/
+	enum class EGameFloatUpdateTargets
+	{
+		Any,
+		Greater,
+		Smaller
+	};
+
+	TArray<FGameFloatUpdateSample> MakeSamples(int32 const InNumSamples, EGameFloatUpdateTargets const InTargets)
+	{
+		FRandomStream Random { 1234 };
+		TArray<FGameFloatUpdateSample> Samples;
+		Samples.Reserve(InNumSamples);
+		for(int32 SampleIndex = 0; SampleIndex < InNumSamples; ++SampleIndex)
+		{
+			float const Curr = Random.FRandRange(-100.0F, 100.0F);
+			float Target = Random.FRandRange(-100.0F, 100.0F);
+			if(InTargets == EGameFloatUpdateTargets::Greater)
+			{
+				Target = Curr + FMath::Abs(Target);
+			}
+			else if(InTargets == EGameFloatUpdateTargets::Smaller)
+			{
+				Target = Curr - FMath::Abs(Target);
+			}
+			// Some of the samples are already at the target
+			if(SampleIndex % 7 == 0)
+			{
+				Target = Curr;
+			}
+			Samples.Add(FGameFloatUpdateSample{ Random.FRandRange(0.001F, 0.1F), Curr, Target });
+		}
+		return Samples;
+	}
+
+	/**
+	* @returns: nanoseconds per one update.
+	*/
+	template<class UpdateFuncT>
+	double MeasureNsPerUpdate(const TArray<FGameFloatUpdateSample>& InSamples, int32 const InNumPasses, UpdateFuncT InUpdateFunc)
+	{
+		volatile float Sink = 0.0F;
+		double const StartSeconds = FPlatformTime::Seconds();
+		for(int32 PassIndex = 0; PassIndex < InNumPasses; ++PassIndex)
+		{
+			float Sum = 0.0F;
+			for(const FGameFloatUpdateSample& S : InSamples)
+			{
+				Sum += InUpdateFunc(S);
+			}
+			Sink = Sink + Sum;
+		}
+		double const ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+		return ElapsedSeconds * 1.0e9 / (static_cast<double>(InSamples.Num()) * InNumPasses);
+	}
+
+	// Invalid parameters inside these expressions will break the compilation
+	static_assert(GameMathPolicy::ValidatedRate(2.0F) == 2.0F, "Valid rate must be returned as is");
+	constexpr TGameFloatUpdater<FGameFloatRate_Symmetric, FGameFloatTolerance_Zero> ConstexprUpdater { 2.0F, 2.0F, 0.0F };
+	static_assert(ConstexprUpdater.Acceleration == 2.0F, "Constexpr updater must keep the rates");
+}
+
+DEFINE_SPEC(GameMathPoliciesSpec, "MyGameUtil.Math.GameMathPoliciesSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void GameMathPoliciesSpec::Define()
+{
+	Describe("GetFloatUpdatedToTargetT", [this]()
+	{
+		It("should match the generic function for the asymmetric rate and runtime tolerance", [this]()
+		{
+			FGameFloatUpdate const Update { 3.0F, 5.0F };
+			for(const FGameFloatUpdateSample& S : MakeSamples(1000, EGameFloatUpdateTargets::Any))
+			{
+				float const Generic = UGameMath::GetFloatUpdatedToTarget(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+				float const Specialized = UGameMath::GetFloatUpdatedToTargetT<FGameFloatRate_Asymmetric>(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+				if( ! TestEqual(TEXT("Specialized value must be the same as generic"), Specialized, Generic) )
+				{
+					break;
+				}
+			}
+		});
+
+		It("should match the generic function for the symmetric rate", [this]()
+		{
+			FGameFloatUpdate const Update { 4.0F, 4.0F };
+			for(const FGameFloatUpdateSample& S : MakeSamples(1000, EGameFloatUpdateTargets::Any))
+			{
+				float const Generic = UGameMath::GetFloatUpdatedToTarget(S.DeltaTime, S.CurrValue, S.TargetValue, Update, 0.0F);
+				float const Specialized = UGameMath::GetFloatUpdatedToTargetT<FGameFloatRate_Symmetric, FGameFloatTolerance_Zero>(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+				if( ! TestEqual(TEXT("Specialized value must be the same as generic"), Specialized, Generic) )
+				{
+					break;
+				}
+			}
+		});
+
+		It("should match the generic function for the accelerate-only rate when target is greater", [this]()
+		{
+			FGameFloatUpdate const Update { 4.0F, 0.0F };
+			for(const FGameFloatUpdateSample& S : MakeSamples(1000, EGameFloatUpdateTargets::Greater))
+			{
+				float const Generic = UGameMath::GetFloatUpdatedToTarget(S.DeltaTime, S.CurrValue, S.TargetValue, Update, 0.0F);
+				float const Specialized = UGameMath::GetFloatUpdatedToTargetT<FGameFloatRate_AccelerateOnly, FGameFloatTolerance_Zero>(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+				if( ! TestEqual(TEXT("Specialized value must be the same as generic"), Specialized, Generic) )
+				{
+					break;
+				}
+			}
+		});
+
+		It("should match the generic function for the decelerate-only rate when target is smaller", [this]()
+		{
+			FGameFloatUpdate const Update { 0.0F, 4.0F };
+			for(const FGameFloatUpdateSample& S : MakeSamples(1000, EGameFloatUpdateTargets::Smaller))
+			{
+				float const Generic = UGameMath::GetFloatUpdatedToTarget(S.DeltaTime, S.CurrValue, S.TargetValue, Update, 0.0F);
+				float const Specialized = UGameMath::GetFloatUpdatedToTargetT<FGameFloatRate_DecelerateOnly, FGameFloatTolerance_Zero>(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+				if( ! TestEqual(TEXT("Specialized value must be the same as generic"), Specialized, Generic) )
+				{
+					break;
+				}
+			}
+		});
+
+		It("should reach the target exactly", [this]()
+		{
+			TGameFloatUpdater<FGameFloatRate_Asymmetric, FGameFloatTolerance_Zero> const Updater { 1.0F, 1.0F };
+			TestEqual(TEXT("Target within the step must be reached exactly"), Updater.Update(1.0F, 0.1F, 0.7F), 0.7F);
+			TestEqual(TEXT("Target out of the step must be approached by the step"), Updater.Update(1.0F, 0.0F, 3.0F), 1.0F);
+		});
+	});
+}
+
+DEFINE_SPEC(GameMathPoliciesBenchmark, "MyGameUtil.Math.GameMathPoliciesBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void GameMathPoliciesBenchmark::Define()
+{
+	It("should report ns per update for each specialization and the generic function", [this]()
+	{
+		constexpr int32 NUM_SAMPLES = 4096;
+		constexpr int32 NUM_PASSES = 256;
+		TArray<FGameFloatUpdateSample> const Samples = MakeSamples(NUM_SAMPLES, EGameFloatUpdateTargets::Any);
+		TArray<FGameFloatUpdateSample> const GreaterSamples = MakeSamples(NUM_SAMPLES, EGameFloatUpdateTargets::Greater);
+		TArray<FGameFloatUpdateSample> const SmallerSamples = MakeSamples(NUM_SAMPLES, EGameFloatUpdateTargets::Smaller);
+		FGameFloatUpdate const Update { 3.0F, 5.0F };
+
+		double const GenericNs = MeasureNsPerUpdate(Samples, NUM_PASSES, [&Update](const FGameFloatUpdateSample& S)
+		{
+			return UGameMath::GetFloatUpdatedToTarget(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+		});
+		double const AsymmetricNs = MeasureNsPerUpdate(Samples, NUM_PASSES, [&Update](const FGameFloatUpdateSample& S)
+		{
+			return UGameMath::GetFloatUpdatedToTargetT<FGameFloatRate_Asymmetric>(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+		});
+		double const AsymmetricZeroToleranceNs = MeasureNsPerUpdate(Samples, NUM_PASSES, [&Update](const FGameFloatUpdateSample& S)
+		{
+			return UGameMath::GetFloatUpdatedToTargetT<FGameFloatRate_Asymmetric, FGameFloatTolerance_Zero>(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+		});
+		double const SymmetricNs = MeasureNsPerUpdate(Samples, NUM_PASSES, [&Update](const FGameFloatUpdateSample& S)
+		{
+			return UGameMath::GetFloatUpdatedToTargetT<FGameFloatRate_Symmetric, FGameFloatTolerance_Zero>(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+		});
+		double const GenericGreaterNs = MeasureNsPerUpdate(GreaterSamples, NUM_PASSES, [&Update](const FGameFloatUpdateSample& S)
+		{
+			return UGameMath::GetFloatUpdatedToTarget(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+		});
+		double const AccelerateOnlyNs = MeasureNsPerUpdate(GreaterSamples, NUM_PASSES, [&Update](const FGameFloatUpdateSample& S)
+		{
+			return UGameMath::GetFloatUpdatedToTargetT<FGameFloatRate_AccelerateOnly, FGameFloatTolerance_Zero>(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+		});
+		double const GenericSmallerNs = MeasureNsPerUpdate(SmallerSamples, NUM_PASSES, [&Update](const FGameFloatUpdateSample& S)
+		{
+			return UGameMath::GetFloatUpdatedToTarget(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+		});
+		double const DecelerateOnlyNs = MeasureNsPerUpdate(SmallerSamples, NUM_PASSES, [&Update](const FGameFloatUpdateSample& S)
+		{
+			return UGameMath::GetFloatUpdatedToTargetT<FGameFloatRate_DecelerateOnly, FGameFloatTolerance_Zero>(S.DeltaTime, S.CurrValue, S.TargetValue, Update);
+		});
+
+		AddInfo(FString::Printf(TEXT("Generic: %.3f ns/update"), GenericNs));
+		AddInfo(FString::Printf(TEXT("Asymmetric (runtime tolerance): %.3f ns/update"), AsymmetricNs));
+		AddInfo(FString::Printf(TEXT("Asymmetric (zero tolerance): %.3f ns/update"), AsymmetricZeroToleranceNs));
+		AddInfo(FString::Printf(TEXT("Symmetric (zero tolerance): %.3f ns/update"), SymmetricNs));
+		AddInfo(FString::Printf(TEXT("Generic (greater targets): %.3f ns/update"), GenericGreaterNs));
+		AddInfo(FString::Printf(TEXT("AccelerateOnly (zero tolerance): %.3f ns/update"), AccelerateOnlyNs));
+		AddInfo(FString::Printf(TEXT("Generic (smaller targets): %.3f ns/update"), GenericSmallerNs));
+		AddInfo(FString::Printf(TEXT("DecelerateOnly (zero tolerance): %.3f ns/update"), DecelerateOnlyNs));
+	});
+}
@@ -0,0 +1,100 @@
+#include "GameUtil/Math/GameMath.h"
+
+#include "AutomationTest.h"
+
+namespace
+{
+	constexpr float SMOOTHING_TOLERANCE = 1.0e-3F;
+}
+
+DEFINE_SPEC(GameMathSmoothingSpec, "MyGameUtil.Math.GameMathSmoothingSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void GameMathSmoothingSpec::Define()
+{
+	Describe("GetFloatExpSmoothed", [this]()
+	{
+		It("should NOT depend on the frame rate", [this]()
+		{
+			float const OneStep = UGameMath::GetFloatExpSmoothed(1.0F, 0.0F, 10.0F, 3.0F);
+			float ManySteps = 0.0F;
+			for(int32 StepIndex = 0; StepIndex < 60; ++StepIndex)
+			{
+				ManySteps = UGameMath::GetFloatExpSmoothed(1.0F / 60.0F, ManySteps, 10.0F, 3.0F);
+			}
+			TestEqual(TEXT("One long step must match many short steps"), ManySteps, OneStep, SMOOTHING_TOLERANCE);
+		});
+
+		It("should match the scalar version in the batched version", [this]()
+		{
+			TArray<float> Values { 0.0F, 1.0F, -2.0F, 3.0F, 4.0F, -5.0F, 6.0F };
+			TArray<float> const Targets { 1.0F, 1.0F, 2.0F, -3.0F, 0.0F, 5.0F, 7.0F };
+			TArray<float> const Initial = Values;
+			UGameMath::UpdateFloatsExpSmoothed(0.1F, Values, Targets, 2.0F);
+			for(int32 Index = 0; Index < Values.Num(); ++Index)
+			{
+				TestEqual(TEXT("Batched value must match the scalar one"), Values[Index], UGameMath::GetFloatExpSmoothed(0.1F, Initial[Index], Targets[Index], 2.0F), KINDA_SMALL_NUMBER);
+			}
+		});
+	});
+
+	Describe("UpdateFloatCriticallyDampedSpring", [this]()
+	{
+		It("should NOT depend on the frame rate", [this]()
+		{
+			float OneStepValue = 0.0F;
+			float OneStepVelocity = 0.0F;
+			UGameMath::UpdateFloatCriticallyDampedSpring(0.5F, OneStepValue, OneStepVelocity, 10.0F, 4.0F);
+
+			float ManyStepsValue = 0.0F;
+			float ManyStepsVelocity = 0.0F;
+			for(int32 StepIndex = 0; StepIndex < 30; ++StepIndex)
+			{
+				UGameMath::UpdateFloatCriticallyDampedSpring(0.5F / 30.0F, ManyStepsValue, ManyStepsVelocity, 10.0F, 4.0F);
+			}
+			TestEqual(TEXT("Value must match"), ManyStepsValue, OneStepValue, SMOOTHING_TOLERANCE);
+			TestEqual(TEXT("Velocity must match"), ManyStepsVelocity, OneStepVelocity, SMOOTHING_TOLERANCE);
+		});
+
+		It("should NOT overshoot the target", [this]()
+		{
+			float Value = 0.0F;
+			float Velocity = 0.0F;
+			for(int32 StepIndex = 0; StepIndex < 100; ++StepIndex)
+			{
+				UGameMath::UpdateFloatCriticallyDampedSpring(0.25F, Value, Velocity, 10.0F, 8.0F);
+				if( ! TestTrue(TEXT("Value must stay below the target"), Value <= 10.0F) )
+				{
+					break;
+				}
+			}
+			TestEqual(TEXT("Value must reach the target"), Value, 10.0F, SMOOTHING_TOLERANCE);
+		});
+
+		It("should match the scalar version in the vector and batched versions", [this]()
+		{
+			FVector Value { 1.0F, -2.0F, 3.0F };
+			FVector Velocity { 0.5F, 0.0F, -1.0F };
+			FVector const Target { -4.0F, 5.0F, 6.0F };
+
+			TArray<float> Values { Value.X, Value.Y, Value.Z, 0.0F, 1.0F };
+			TArray<float> Velocities { Velocity.X, Velocity.Y, Velocity.Z, 2.0F, -2.0F };
+			TArray<float> const Targets { Target.X, Target.Y, Target.Z, 1.0F, 0.0F };
+			TArray<float> ScalarValues = Values;
+			TArray<float> ScalarVelocities = Velocities;
+
+			UGameMath::UpdateVectorCriticallyDampedSpring(0.1F, Value, Velocity, Target, 5.0F);
+			UGameMath::UpdateFloatsCriticallyDampedSpring(0.1F, Values, Velocities, Targets, 5.0F);
+			for(int32 Index = 0; Index < Values.Num(); ++Index)
+			{
+				UGameMath::UpdateFloatCriticallyDampedSpring(0.1F, ScalarValues[Index], ScalarVelocities[Index], Targets[Index], 5.0F);
+				TestEqual(TEXT("Batched value must match the scalar one"), Values[Index], ScalarValues[Index], KINDA_SMALL_NUMBER);
+				TestEqual(TEXT("Batched velocity must match the scalar one"), Velocities[Index], ScalarVelocities[Index], KINDA_SMALL_NUMBER);
+			}
+			for(int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				TestEqual(TEXT("Vector value must match the scalar one"), Value[Axis], ScalarValues[Axis], KINDA_SMALL_NUMBER);
+				TestEqual(TEXT("Vector velocity must match the scalar one"), Velocity[Axis], ScalarVelocities[Axis], KINDA_SMALL_NUMBER);
+			}
+		});
+	});
+}
@@ -0,0 +1,12 @@
+#include "MySplineCore.h"
+
+namespace MySplineCore
+{
+	float GetDistanceAlongSplineAtInputKey(float const InInputKey, const float* const InPointDistances, std::int32_t const InNumPoints, float const InSplineLength)
+	{
+		return GetDistanceAlongSplineAtInputKey(InInputKey, InNumPoints, InSplineLength, [InPointDistances](std::int32_t const InPointIndex)
+		{
+			return InPointDistances[InPointIndex];
+		});
+	}
+} // MySplineCore
@@ -0,0 +1,73 @@
+#pragma once
+
+/**
+* Computational core of UMySplineUtil and the spline segment math of USplineTrackGeneratorLib.
+*
+* Plain C++ (standard library only): no UObject, no engine headers,
+* so it can be compiled and profiled without the engine.
+* Spline data is passed as plain numbers (or as callable returning them).
+*/
+
+#include <cmath>
+#include <cstdint>
+
+namespace MySplineCore
+{
+	/**
+	* Number of segments of the spline track (the closed loop has additional segment from the last point to the first).
+	*/
+	inline std::int32_t GetNumberOfSegments(std::int32_t const InNumPoints, bool const bInClosedLoop)
+	{
+		if(InNumPoints <= 0)
+		{
+			return 0;
+		}
+		return bInClosedLoop ? InNumPoints : (InNumPoints - 1);
+	}
+
+	/**
+	* Index of the end point of the segment starting from the given point (wraps to the first point).
+	* @returns: 0 if the spline has no points.
+	*/
+	inline std::int32_t GetSegmentEndPointIndex(std::int32_t const InSegmentIndex, std::int32_t const InNumPoints)
+	{
+		if(InNumPoints <= 0)
+		{
+			return 0;
+		}
+		return (InSegmentIndex + 1) % InNumPoints;
+	}
+
+	/**
+	* Distance along the spline at the given input key,
+	* linearly interpolated between the distances at the spline points.
+	*
+	* @param InDistanceAtPoint: callable (int32 PointIndex) -> float, returns distance along the spline at the given point.
+	* @returns: 0 if the spline has no points.
+	*/
+	template<class DistanceAtPointFuncT>
+	float GetDistanceAlongSplineAtInputKey(float const InInputKey, std::int32_t const InNumPoints, float const InSplineLength, DistanceAtPointFuncT&& InDistanceAtPoint)
+	{
+		if(InNumPoints <= 0)
+		{
+			return 0.0F;
+		}
+		std::int32_t const PointIndex = static_cast<std::int32_t>(InInputKey);
+		std::int32_t const NextPointIndex = GetSegmentEndPointIndex(PointIndex, InNumPoints);
+		float const PointDistance = InDistanceAtPoint(PointIndex);
+		float NextPointDistance = InDistanceAtPoint(NextPointIndex);
+		if(PointIndex == (InNumPoints - 1))
+		{
+			NextPointDistance += InSplineLength;
+		}
+		float const Alpha = InInputKey - static_cast<float>(PointIndex);
+		return PointDistance + Alpha * (NextPointDistance - PointDistance);
+	}
+
+	/**
+	* @see GetDistanceAlongSplineAtInputKey
+	*
+	* @param InPointDistances: distance along the spline at each of the InNumPoints points.
+	*/
+	float GetDistanceAlongSplineAtInputKey(float InInputKey, const float* InPointDistances, std::int32_t InNumPoints, float InSplineLength);
+} // MySplineCore
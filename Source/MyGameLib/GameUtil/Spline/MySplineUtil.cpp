@@ -1,5 +1,5 @@
 #include "MySplineUtil.h"
-#include "Math/UnrealMathUtility.h"
+#include "Core/MySplineCore.h"
 #include "Components/SplineComponent.h"
 
 float UMySplineUtil::GetDistanceAlongSplineClosestToPoint(USplineComponent* Spline, const FVector& P)
@@ -9,15 +9,8 @@ float UMySplineUtil::GetDistanceAlongSplineClosestToPoint(USplineComponent* Spli
 		return 0.0F;
 	}
 	float const InputKey = Spline->FindInputKeyClosestToWorldLocation(P);
-	int32 const InputPointIndex = FMath::TruncToInt(InputKey);
-	float const PointDistance = Spline->GetDistanceAlongSplineAtSplinePoint(InputPointIndex);
-	int32 const NumPoints = Spline->GetNumberOfSplinePoints();
-	int32 const NextPointIndex = (InputPointIndex + 1) % NumPoints;
-	float NextPointDistance = Spline->GetDistanceAlongSplineAtSplinePoint(NextPointIndex);
-	if(InputPointIndex == (NumPoints - 1))
+	return MySplineCore::GetDistanceAlongSplineAtInputKey(InputKey, Spline->GetNumberOfSplinePoints(), Spline->GetSplineLength(), [Spline](int32 const InPointIndex)
 	{
-		NextPointDistance += Spline->GetSplineLength();
-	}
-	float const DistanceAlongSpline = FMath::Lerp(PointDistance, NextPointDistance, (InputKey - InputPointIndex) );
-	return DistanceAlongSpline;
+		return Spline->GetDistanceAlongSplineAtSplinePoint(InPointIndex);
+	});
 }
@@ -12,6 +12,17 @@ public class MyGameLib : ModuleRules
 
 		PrivateDependencyModuleNames.AddRange(new string[] {  });
 
+		// Most verbose level of the M_LOG* macros compiled in (name of the ELogVerbosity value):
+		// macros of the more verbose levels compile to nothing, M_LOGFUNC*/M_LOGBLOCK* helpers are of the Log level (see MyDebugMacros.h)
+		if (Target.Configuration == UnrealTargetConfiguration.Shipping)
+		{
+			PublicDefinitions.Add("MY_LOG_COMPILED_IN_VERBOSITY=Warning");
+		}
+		else
+		{
+			PublicDefinitions.Add("MY_LOG_COMPILED_IN_VERBOSITY=VeryVerbose");
+		}
+
 		// Uncomment if you are using Slate UI
 		PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore", "UMG" });
 		
@@ -1,5 +1,6 @@
 #include "SplineTrackGeneratorLib.h"
 #include "Util/Core/LogUtilLib.h"
+#include "GameUtil/Spline/Core/MySplineCore.h"
 
 #include "Components/SplineComponent.h"
 #include "Components/SplineMeshComponent.h"
@@ -66,7 +67,7 @@ USplineMeshComponent* USplineTrackGeneratorLib::CreateAttachedSplineSegmentMesh
 	checkf(OwnerActor, TEXT("When calling \"%s\" owner actor of the passed spline component must be valid NON-null pointer"), TEXT(__FUNCTION__));
 
 	int32 const StartIndex = SegmentIndex;
-	int32 const EndIndex = (SegmentIndex < Spline->GetNumberOfSplinePoints()) ? (SegmentIndex + 1) : 0;
+	int32 const EndIndex = MySplineCore::GetSegmentEndPointIndex(SegmentIndex, Spline->GetNumberOfSplinePoints());
 
 	USplineMeshComponent* SplineMesh = nullptr;
 	bool const bDynamicObject = (CreationFlags & EMyObjectCreationFlags::Dynamic) != EMyObjectCreationFlags::None;
@@ -165,7 +166,7 @@ bool USplineTrackGeneratorLib::CreateUniformSplineTrack_Validate
 int32 USplineTrackGeneratorLib::GetNumberOfSplineTrackSegments(USplineComponent* Spline)
 {
 	checkf(Spline, TEXT("When calling \"%s\" passed spline component pointer must be valid NON-null pointer"), TEXT(__FUNCTION__));
-	return Spline->IsClosedLoop() ? (Spline->GetNumberOfSplinePoints()) : (Spline->GetNumberOfSplinePoints() - 1);
+	return MySplineCore::GetNumberOfSegments(Spline->GetNumberOfSplinePoints(), Spline->IsClosedLoop());
 }
 
 bool USplineTrackGeneratorLib::GetNumberOfSplineTrackSegments_Validate(USplineComponent* Spline)
@@ -0,0 +1,824 @@
+#include "MyBinaryLog.h"
+#include "MyFloatFormat.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/Paths.h"
+#include "Misc/App.h"
+#include "Misc/Crc.h"
+#include "Misc/CoreDelegates.h"
+#include "Serialization/Archive.h"
+#include "UObject/Object.h"
+#include "UObject/Class.h"
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarMyLogBinary
+	(
+		TEXT("MyLog.Binary"),
+		0,
+		TEXT("Write M_LOG_DEFERRED lines (ULogUtilLib::LogFloatC, LogVectorC, LogRotatorC...) to the binary log instead of the text (0 - text, 1 - binary)"),
+		ECVF_Default
+	);
+
+	/** "MYBL"*/
+	constexpr uint32 FILE_MAGIC = 0x4C42594D;
+	constexpr uint32 FILE_VERSION = 2;
+
+	/** Buffered bytes of the stream that are written to the archive at once*/
+	constexpr int32 FLUSH_THRESHOLD = 16 * 1024;
+
+	/** Strings interned by each stream (the others are written inline)*/
+	constexpr int32 MAX_INTERNED_STRINGS = 1024;
+
+	/** Longer strings are written inline (they are unlikely to repeat)*/
+	constexpr int32 MAX_INTERNED_STRING_LEN = 128;
+
+	/** String id of the string that is written inline*/
+	constexpr uint32 INLINE_STRING_ID = MAX_uint32;
+
+	/** Length of the formatted argument (the longer arguments are written without the conversion specification)*/
+	constexpr int32 MAX_FORMATTED_ARG_LEN = 256;
+
+	/** How many times crash path tries to take the lock (the crash may happen while it's taken)*/
+	constexpr int32 CRASH_FLUSH_NUM_ATTEMPTS = 100;
+
+	/** Tags of the records in the stream*/
+	enum class EMyBinaryLogTag : uint8
+	{
+		Format = 'F',
+		String = 'S',
+		Name = 'N',
+		Record = 'R',
+		/** Buffered records of the stream: StreamId, Size, records*/
+		Chunk = 'C'
+	};
+
+	std::atomic<uint32> GNextFormatId { 0 };
+
+	/** @see FMyBinaryLogWriter::Serial*/
+	std::atomic<uint64> GNextWriterSerial { 1 };
+
+	/** Writer of the session, once it's created*/
+	std::atomic<FMyBinaryLogWriter*> GSessionWriter { nullptr };
+
+	// ~Buffer helpers Begin
+	template<class T>
+	void AppendValue(TArray<uint8>& InOutBuffer, const T& InValue)
+	{
+		InOutBuffer.Append(reinterpret_cast<const uint8*>(&InValue), sizeof(T));
+	}
+
+	/** Length (int32) + UTF-16 characters*/
+	void AppendString(TArray<uint8>& InOutBuffer, const TCHAR* const InString)
+	{
+		FTCHARToUTF16 const Converted { InString };
+		int32 const Len = Converted.Length();
+		AppendValue(InOutBuffer, Len);
+		InOutBuffer.Append(reinterpret_cast<const uint8*>(Converted.Get()), Len * sizeof(UTF16CHAR));
+	}
+	// ~Buffer helpers End
+
+	/**
+	* Sequential reader of the binary log data.
+	*/
+	class FMyBinaryLogReader
+	{
+	public:
+		FMyBinaryLogReader(const uint8* const InData, int32 const InNumBytes) :
+			Data ( InData )
+		,	NumBytes ( InNumBytes )
+		{
+		}
+
+		bool IsAtEnd() const { return Offset >= NumBytes; }
+		bool HasError() const { return bError; }
+
+		template<class T>
+		T Read()
+		{
+			T Value {};
+			if(const uint8* const Bytes = ReadBytes(sizeof(T)))
+			{
+				FMemory::Memcpy(&Value, Bytes, sizeof(T));
+			}
+			return Value;
+		}
+
+		/** @returns: the next bytes, or nullptr if there're fewer left*/
+		const uint8* ReadBytes(int32 const InNumBytes)
+		{
+			if(bError || InNumBytes < 0 || Offset + InNumBytes > NumBytes)
+			{
+				bError = true;
+				return nullptr;
+			}
+			const uint8* const Bytes = Data + Offset;
+			Offset += InNumBytes;
+			return Bytes;
+		}
+
+		FString ReadString()
+		{
+			int32 const Len = Read<int32>();
+			const uint8* const Bytes = ReadBytes(Len * static_cast<int32>(sizeof(UTF16CHAR)));
+			if(Bytes == nullptr)
+			{
+				return FString();
+			}
+			TArray<UTF16CHAR> Chars;
+			Chars.SetNumUninitialized(Len + 1);
+			FMemory::Memcpy(Chars.GetData(), Bytes, Len * sizeof(UTF16CHAR));
+			Chars[Len] = 0;
+			return FString(UTF16_TO_TCHAR(Chars.GetData()));
+		}
+
+	private:
+		const uint8* Data = nullptr;
+		int32 NumBytes = 0;
+		int32 Offset = 0;
+		bool bError = false;
+	};
+
+	struct FDecodedFormat
+	{
+		FString Category;
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+		FString Prefix;
+		FString Postfix;
+		FString Format;
+		TArray<EMyBinaryLogArgType> ArgTypes;
+	};
+
+	/** Argument value converted to the string for %s, or the number*/
+	struct FDecodedArg
+	{
+		EMyBinaryLogArgType Type = EMyBinaryLogArgType::None;
+		/** Int32 or Int64*/
+		int64 IntValue = 0;
+		double FloatValue = 0.0;
+		FString StringValue;
+	};
+
+	/**
+	* Formats the argument by the conversion specification (the same as the text log formats it).
+	* @returns: false if the result does NOT fit.
+	*/
+	bool AppendFormattedArg(FString& InOut, const TCHAR* InSpec, ...)
+	{
+		TCHAR Formatted[MAX_FORMATTED_ARG_LEN];
+		va_list Args;
+		va_start(Args, InSpec);
+		int32 const Len = FCString::GetVarArgs(Formatted, ARRAY_COUNT(Formatted), InSpec, Args);
+		va_end(Args);
+		if(Len < 0)
+		{
+			return false;
+		}
+		InOut.Append(Formatted, Len);
+		return true;
+	}
+
+	/**
+	* Appends the argument formatted by the conversion specification (e.g. "%.2f", "%-8s").
+	*/
+	void AppendDecodedArg(FString& InOut, const FString& InSpec, const FDecodedArg& InArg)
+	{
+		TCHAR const Conversion = InSpec[InSpec.Len() - 1];
+		switch(InArg.Type)
+		{
+		case EMyBinaryLogArgType::Int32:
+			if(FCString::Strchr(TEXT("diuxXoc"), Conversion) && AppendFormattedArg(InOut, *InSpec, static_cast<int32>(InArg.IntValue)))
+			{
+				return;
+			}
+			InOut.AppendInt(static_cast<int32>(InArg.IntValue));
+			return;
+
+		case EMyBinaryLogArgType::Int64:
+			// Only the 64-bit length reads the whole vararg
+			if(FCString::Strchr(TEXT("diuxXo"), Conversion) && InSpec.Contains(TEXT("ll")) && AppendFormattedArg(InOut, *InSpec, InArg.IntValue))
+			{
+				return;
+			}
+			InOut.Append(FString::Printf(TEXT("%lld"), InArg.IntValue));
+			return;
+
+		case EMyBinaryLogArgType::Float:
+		case EMyBinaryLogArgType::Double:
+			if(FCString::Strchr(TEXT("fFeEgGaA"), Conversion) && AppendFormattedArg(InOut, *InSpec, InArg.FloatValue))
+			{
+				return;
+			}
+			InOut.Append(FString::Printf(TEXT("%f"), InArg.FloatValue));
+			return;
+
+		default:
+			if(Conversion == TEXT('s') && AppendFormattedArg(InOut, *InSpec, *InArg.StringValue))
+			{
+				return;
+			}
+			InOut.Append(InArg.StringValue);
+			return;
+		}
+	}
+
+	/**
+	* Substitutes the arguments into the format (@see supported specifiers in MyBinaryLog.h).
+	*/
+	FString FormatDecoded(const FString& InFormat, const TArray<FDecodedArg>& InArgs)
+	{
+		FString Result;
+		Result.Reserve(InFormat.Len() * 2);
+		int32 ArgIndex = 0;
+		for(int32 CharIndex = 0; CharIndex < InFormat.Len(); ++CharIndex)
+		{
+			TCHAR const Char = InFormat[CharIndex];
+			if(Char != TEXT('%') || CharIndex + 1 >= InFormat.Len())
+			{
+				Result.AppendChar(Char);
+				continue;
+			}
+			if(InFormat[CharIndex + 1] == TEXT('%'))
+			{
+				Result.AppendChar(TEXT('%'));
+				++CharIndex;
+				continue;
+			}
+			// Flags, width, precision and length up to the conversion character
+			int32 SpecEnd = CharIndex + 1;
+			while(SpecEnd < InFormat.Len() && ! FChar::IsAlpha(InFormat[SpecEnd]) )
+			{
+				++SpecEnd;
+			}
+			while(SpecEnd < InFormat.Len() && (InFormat[SpecEnd] == TEXT('l') || InFormat[SpecEnd] == TEXT('h')))
+			{
+				++SpecEnd;
+			}
+			FString const Spec = InFormat.Mid(CharIndex, FMath::Min(SpecEnd, InFormat.Len() - 1) - CharIndex + 1);
+			CharIndex = SpecEnd;
+			if( ! InArgs.IsValidIndex(ArgIndex) )
+			{
+				Result.Append(TEXT("<missing>"));
+				continue;
+			}
+			AppendDecodedArg(Result, Spec, InArgs[ArgIndex++]);
+		}
+		return Result;
+	}
+
+	/**
+	* Interned strings and names of the stream (formats are the same for all the streams).
+	*/
+	struct FDecodedStream
+	{
+		TMap<uint32, FString> Strings;
+		TMap<int32, FString> Names;
+	};
+
+	/** Lines of the streams are merged by the time*/
+	struct FDecodedLine
+	{
+		uint64 Cycles = 0;
+		FString Text;
+	};
+
+	/**
+	* Decodes the records of the chunk of the stream.
+	* @returns: false if the data is corrupted (lines decoded before the error are still added).
+	*/
+	bool DecodeChunk(FMyBinaryLogReader& InReader, uint64 const InStartCycles, double const InSecondsPerCycle, TMap<uint32, FDecodedFormat>& InOutFormats, FDecodedStream& InOutStream, TArray<FDecodedLine>& OutLines, FString& OutError)
+	{
+		auto Fail = [&OutError](const FString& InError)
+		{
+			OutError = InError;
+			return false;
+		};
+
+		auto ReadName = [&InReader, &InOutStream](FString& OutName)
+		{
+			int32 const Index = InReader.Read<int32>();
+			int32 const Number = InReader.Read<int32>();
+			const FString* const PlainName = InOutStream.Names.Find(Index);
+			OutName.Append(PlainName ? **PlainName : TEXT("<unknown name>"));
+			if(Number != NAME_NO_NUMBER_INTERNAL)
+			{
+				OutName.Append(FString::Printf(TEXT("_%d"), NAME_INTERNAL_TO_EXTERNAL(Number)));
+			}
+		};
+
+		TArray<FDecodedArg> Args;
+		while( ! InReader.IsAtEnd() && ! InReader.HasError() )
+		{
+			EMyBinaryLogTag const Tag = InReader.Read<EMyBinaryLogTag>();
+			switch(Tag)
+			{
+			case EMyBinaryLogTag::Format:
+			{
+				uint32 const Id = InReader.Read<uint32>();
+				FDecodedFormat& Format = InOutFormats.Add(Id);
+				Format.Category = InReader.ReadString();
+				Format.Verbosity = static_cast<ELogVerbosity::Type>(InReader.Read<uint8>());
+				Format.Prefix = InReader.ReadString();
+				Format.Postfix = InReader.ReadString();
+				Format.Format = InReader.ReadString();
+				int32 const NumArgs = InReader.Read<uint8>();
+				for(int32 ArgIndex = 0; ArgIndex < NumArgs; ++ArgIndex)
+				{
+					Format.ArgTypes.Add(InReader.Read<EMyBinaryLogArgType>());
+				}
+				break;
+			}
+
+			case EMyBinaryLogTag::String:
+			{
+				uint32 const Id = InReader.Read<uint32>();
+				InOutStream.Strings.Add(Id, InReader.ReadString());
+				break;
+			}
+
+			case EMyBinaryLogTag::Name:
+			{
+				int32 const Index = InReader.Read<int32>();
+				InOutStream.Names.Add(Index, InReader.ReadString());
+				break;
+			}
+
+			case EMyBinaryLogTag::Record:
+			{
+				uint32 const Id = InReader.Read<uint32>();
+				uint64 const Cycles = InReader.Read<uint64>();
+				const FDecodedFormat* const Format = InOutFormats.Find(Id);
+				if(Format == nullptr)
+				{
+					return Fail(FString::Printf(TEXT("Record references unknown format %u"), Id));
+				}
+				Args.Reset();
+				for(EMyBinaryLogArgType const ArgType : Format->ArgTypes)
+				{
+					FDecodedArg& Arg = Args.AddDefaulted_GetRef();
+					Arg.Type = ArgType;
+					switch(ArgType)
+					{
+					case EMyBinaryLogArgType::Int32:
+						Arg.IntValue = InReader.Read<int32>();
+						break;
+
+					case EMyBinaryLogArgType::Float:
+						Arg.FloatValue = InReader.Read<float>();
+						break;
+
+					case EMyBinaryLogArgType::Double:
+						Arg.FloatValue = InReader.Read<double>();
+						break;
+
+					case EMyBinaryLogArgType::String:
+					{
+						uint32 const StringId = InReader.Read<uint32>();
+						if(StringId == INLINE_STRING_ID)
+						{
+							Arg.StringValue = InReader.ReadString();
+							break;
+						}
+						const FString* const String = InOutStream.Strings.Find(StringId);
+						Arg.StringValue = String ? *String : FString(TEXT("<unknown string>"));
+						break;
+					}
+
+					case EMyBinaryLogArgType::Int64:
+						Arg.IntValue = InReader.Read<int64>();
+						break;
+
+					case EMyBinaryLogArgType::Name:
+						ReadName(Arg.StringValue);
+						break;
+
+					case EMyBinaryLogArgType::Object:
+						// The same text as ULogUtilLib::AppendNameAndClassScoped
+						if(InReader.Read<uint8>() == 0)
+						{
+							Arg.StringValue = TEXT("(nullptr)");
+							break;
+						}
+						Arg.StringValue = TEXT("(name=\"");
+						ReadName(Arg.StringValue);
+						Arg.StringValue += TEXT("\" class=\"");
+						ReadName(Arg.StringValue);
+						Arg.StringValue += TEXT("\")");
+						break;
+
+					case EMyBinaryLogArgType::Vector:
+					{
+						FVector Value;
+						Value.X = InReader.Read<float>();
+						Value.Y = InReader.Read<float>();
+						Value.Z = InReader.Read<float>();
+						Arg.StringValue = *MyFloatFormat::ToText(Value);
+						break;
+					}
+
+					case EMyBinaryLogArgType::Rotator:
+					{
+						FRotator Value;
+						Value.Pitch = InReader.Read<float>();
+						Value.Yaw = InReader.Read<float>();
+						Value.Roll = InReader.Read<float>();
+						Arg.StringValue = *MyFloatFormat::ToText(Value);
+						break;
+					}
+
+					default:
+						return Fail(FString::Printf(TEXT("Unknown argument type %d in format %u"), static_cast<int32>(ArgType), Id));
+					}
+				}
+
+				double const Seconds = static_cast<double>(Cycles - InStartCycles) * InSecondsPerCycle;
+				FString const Message = Format->Prefix + FormatDecoded(Format->Format, Args) + Format->Postfix;
+				// The same layout as the text log: "Category: Verbosity: Message" (verbosity is omitted for Log)
+				if((Format->Verbosity & ELogVerbosity::VerbosityMask) == ELogVerbosity::Log)
+				{
+					OutLines.Add(FDecodedLine { Cycles, FString::Printf(TEXT("[%.6f] %s: %s"), Seconds, *Format->Category, *Message) });
+				}
+				else
+				{
+					OutLines.Add(FDecodedLine { Cycles, FString::Printf(TEXT("[%.6f] %s: %s: %s"), Seconds, *Format->Category, ::ToString(Format->Verbosity), *Message) });
+				}
+				break;
+			}
+
+			default:
+				return Fail(FString::Printf(TEXT("Unknown record tag %d"), static_cast<int32>(Tag)));
+			}
+		}
+		if(InReader.HasError())
+		{
+			return Fail(TEXT("Unexpected end of data (the last record is truncated)"));
+		}
+		return true;
+	}
+}
+
+// ~FMyBinaryLogFormat Begin
+FMyBinaryLogFormat::FMyBinaryLogFormat(const ANSICHAR* const InFunction, const ANSICHAR* const InFile, int32 const InLine, const FLogCategoryBase& InCategory, ELogVerbosity::Type const InVerbosity, const TCHAR* const InFormat) :
+	Id ( GNextFormatId.fetch_add(1, std::memory_order_relaxed) )
+,	Site ( InFunction, InFile, InLine, InVerbosity )
+,	Category ( &InCategory )
+,	Verbosity ( InVerbosity )
+,	Format ( InFormat )
+{
+}
+// ~FMyBinaryLogFormat End
+
+// ~FMyBinaryLogStream Begin
+FMyBinaryLogStream::FMyBinaryLogStream(uint32 const InId, uint32 const InThreadId) :
+	Id ( InId )
+,	ThreadId ( InThreadId )
+{
+	Buffer.Reserve(FLUSH_THRESHOLD * 2);
+}
+
+void FMyBinaryLogStream::BeginRecord(const FMyBinaryLogFormat& InFormat, const EMyBinaryLogArgType* const InArgTypes, int32 const InNumArgs)
+{
+	int32 const FormatIndex = static_cast<int32>(InFormat.Id);
+	if(FormatIndex >= WrittenFormats.Num())
+	{
+		WrittenFormats.Add(false, FormatIndex + 1 - WrittenFormats.Num());
+	}
+	if( ! WrittenFormats[FormatIndex] )
+	{
+		WrittenFormats[FormatIndex] = true;
+		AppendValue(Buffer, EMyBinaryLogTag::Format);
+		AppendValue(Buffer, InFormat.Id);
+		AppendString(Buffer, *InFormat.Category->GetCategoryName().ToString());
+		AppendValue(Buffer, static_cast<uint8>(InFormat.Verbosity));
+		AppendString(Buffer, *InFormat.Site.Prefix);
+		AppendString(Buffer, *InFormat.Site.Postfix);
+		AppendString(Buffer, InFormat.Format);
+		AppendValue(Buffer, static_cast<uint8>(InNumArgs));
+		Buffer.Append(reinterpret_cast<const uint8*>(InArgTypes), InNumArgs);
+	}
+	RecordStart = Buffer.Num();
+	AppendValue(Buffer, EMyBinaryLogTag::Record);
+	AppendValue(Buffer, InFormat.Id);
+	AppendValue(Buffer, FPlatformTime::Cycles64());
+}
+
+bool FMyBinaryLogStream::EndRecord()
+{
+	// Strings and names first seen in the record must be defined before the record
+	if(PendingDefinitions.Num() > 0)
+	{
+		Buffer.Insert(PendingDefinitions, RecordStart);
+		PendingDefinitions.Reset();
+	}
+	return Buffer.Num() >= FLUSH_THRESHOLD;
+}
+
+void FMyBinaryLogStream::WriteRaw(const void* const InData, int32 const InNumBytes)
+{
+	Buffer.Append(static_cast<const uint8*>(InData), InNumBytes);
+}
+
+void FMyBinaryLogStream::WriteString(const TCHAR* const InString)
+{
+	const TCHAR* const String = InString ? InString : TEXT("nullptr");
+	int32 const Len = FCString::Strlen(String);
+	uint32 const Crc = FCrc::StrCrc32(String);
+	uint32 StringId = INLINE_STRING_ID;
+	if(Len <= MAX_INTERNED_STRING_LEN)
+	{
+		for(auto It = StringIdsByCrc.CreateConstKeyIterator(Crc); It; ++It)
+		{
+			if(Strings[It.Value()].Equals(String, ESearchCase::CaseSensitive))
+			{
+				StringId = It.Value();
+				break;
+			}
+		}
+		if(StringId == INLINE_STRING_ID && Strings.Num() < MAX_INTERNED_STRINGS)
+		{
+			StringId = static_cast<uint32>(Strings.Add(String));
+			StringIdsByCrc.Add(Crc, StringId);
+			AppendValue(PendingDefinitions, EMyBinaryLogTag::String);
+			AppendValue(PendingDefinitions, StringId);
+			AppendString(PendingDefinitions, String);
+		}
+	}
+	AppendValue(Buffer, StringId);
+	if(StringId == INLINE_STRING_ID)
+	{
+		AppendString(Buffer, String);
+	}
+}
+
+void FMyBinaryLogStream::WriteName(const FName& InName)
+{
+	int32 const Index = static_cast<int32>(InName.GetComparisonIndex());
+	if( ! WrittenNames.Contains(Index) )
+	{
+		WrittenNames.Add(Index);
+		AppendValue(PendingDefinitions, EMyBinaryLogTag::Name);
+		AppendValue(PendingDefinitions, Index);
+		AppendString(PendingDefinitions, *InName.GetPlainNameString());
+	}
+	AppendValue(Buffer, Index);
+	AppendValue(Buffer, static_cast<int32>(InName.GetNumber()));
+}
+
+void FMyBinaryLogStream::WriteObject(const UObject* const InObject)
+{
+	AppendValue(Buffer, static_cast<uint8>(InObject != nullptr));
+	if(InObject)
+	{
+		WriteName(InObject->GetFName());
+		WriteName(InObject->GetClass()->GetFName());
+	}
+}
+// ~FMyBinaryLogStream End
+
+// ~FMyBinaryLogWriter Begin
+FMyBinaryLogWriter::FMyBinaryLogWriter(FArchive* const InArchive, bool const bInOwnsArchive) :
+	Archive ( InArchive )
+,	bOwnsArchive ( bInOwnsArchive )
+,	Serial ( GNextWriterSerial.fetch_add(1, std::memory_order_relaxed) )
+{
+	checkf(Archive, TEXT("Archive must be valid in %s"), TEXT(__FUNCTION__));
+	TArray<uint8> Header;
+	AppendValue(Header, FILE_MAGIC);
+	AppendValue(Header, FILE_VERSION);
+	AppendValue(Header, FPlatformTime::Cycles64());
+	AppendValue(Header, FPlatformTime::GetSecondsPerCycle64());
+	Archive->Serialize(Header.GetData(), Header.Num());
+}
+
+FMyBinaryLogWriter::~FMyBinaryLogWriter()
+{
+	Flush();
+	if(bOwnsArchive)
+	{
+		Archive->Close();
+		delete Archive;
+	}
+}
+
+void FMyBinaryLogWriter::Flush()
+{
+	for(FMyBinaryLogStream* const Stream : GetStreams())
+	{
+		FScopeLock const Lock { &Stream->Mutex };
+		WriteChunk(*Stream);
+	}
+	FScopeLock const Lock { &Mutex };
+	Archive->Flush();
+}
+
+void FMyBinaryLogWriter::TryFlush()
+{
+	// The crash may happen while any of the locks is taken
+	auto TryLock = [](FCriticalSection& InMutex)
+	{
+		for(int32 Attempt = 0; Attempt < CRASH_FLUSH_NUM_ATTEMPTS; ++Attempt)
+		{
+			if(InMutex.TryLock())
+			{
+				return true;
+			}
+			FPlatformProcess::SleepNoStats(0.001F);
+		}
+		return false;
+	};
+
+	if( ! TryLock(Mutex) )
+	{
+		return;
+	}
+	TArray<FMyBinaryLogStream*> StreamsToFlush;
+	for(const TUniquePtr<FMyBinaryLogStream>& Stream : Streams)
+	{
+		StreamsToFlush.Add(Stream.Get());
+	}
+	Mutex.Unlock();
+
+	for(FMyBinaryLogStream* const Stream : StreamsToFlush)
+	{
+		if( ! TryLock(Stream->Mutex) )
+		{
+			continue;
+		}
+		if(TryLock(Mutex))
+		{
+			WriteChunkLocked(*Stream);
+			Mutex.Unlock();
+		}
+		Stream->Mutex.Unlock();
+	}
+	if(TryLock(Mutex))
+	{
+		Archive->Flush();
+		Mutex.Unlock();
+	}
+}
+
+FMyBinaryLogStream& FMyBinaryLogWriter::GetThreadStream()
+{
+	// Stream of the writer the thread used last
+	static thread_local uint64 CachedWriterSerial = 0;
+	static thread_local FMyBinaryLogStream* CachedStream = nullptr;
+	if(CachedWriterSerial == Serial)
+	{
+		return *CachedStream;
+	}
+
+	uint32 const ThreadId = FPlatformTLS::GetCurrentThreadId();
+	FScopeLock const Lock { &Mutex };
+	FMyBinaryLogStream* Stream = nullptr;
+	for(const TUniquePtr<FMyBinaryLogStream>& ExistingStream : Streams)
+	{
+		// The stream of the exited thread is reused by the thread that gets its id
+		if(ExistingStream->ThreadId == ThreadId)
+		{
+			Stream = ExistingStream.Get();
+			break;
+		}
+	}
+	if(Stream == nullptr)
+	{
+		Stream = Streams.Add_GetRef(MakeUnique<FMyBinaryLogStream>(static_cast<uint32>(Streams.Num()), ThreadId)).Get();
+	}
+	CachedWriterSerial = Serial;
+	CachedStream = Stream;
+	return *Stream;
+}
+
+TArray<FMyBinaryLogStream*> FMyBinaryLogWriter::GetStreams()
+{
+	FScopeLock const Lock { &Mutex };
+	TArray<FMyBinaryLogStream*> Result;
+	for(const TUniquePtr<FMyBinaryLogStream>& Stream : Streams)
+	{
+		Result.Add(Stream.Get());
+	}
+	return Result;
+}
+
+void FMyBinaryLogWriter::WriteChunk(FMyBinaryLogStream& InStream)
+{
+	if(InStream.Buffer.Num() == 0)
+	{
+		return;
+	}
+	FScopeLock const Lock { &Mutex };
+	WriteChunkLocked(InStream);
+}
+
+void FMyBinaryLogWriter::WriteChunkLocked(FMyBinaryLogStream& InStream)
+{
+	if(InStream.Buffer.Num() == 0)
+	{
+		return;
+	}
+	TArray<uint8> ChunkHeader;
+	AppendValue(ChunkHeader, EMyBinaryLogTag::Chunk);
+	AppendValue(ChunkHeader, InStream.Id);
+	AppendValue(ChunkHeader, InStream.Buffer.Num());
+	Archive->Serialize(ChunkHeader.GetData(), ChunkHeader.Num());
+	Archive->Serialize(InStream.Buffer.GetData(), InStream.Buffer.Num());
+	InStream.Buffer.Reset();
+}
+// ~FMyBinaryLogWriter End
+
+namespace MyBinaryLog
+{
+	bool IsEnabled()
+	{
+		return CVarMyLogBinary.GetValueOnAnyThread() != 0;
+	}
+
+	FMyBinaryLogWriter& GetWriter()
+	{
+		static FMyBinaryLogWriter* const Writer = []()
+		{
+			FString const Path = FPaths::Combine(FPaths::ProjectLogDir(), FString(FApp::GetProjectName()) + TEXT(".mybinlog"));
+			FArchive* Archive = IFileManager::Get().CreateFileWriter(*Path, FILEWRITE_AllowRead);
+			if(Archive == nullptr)
+			{
+				M_LOG_ERROR(TEXT("Unable to create the binary log file \"%s\": records will be discarded"), *Path);
+				// Base archive discards everything
+				Archive = new FArchive();
+			}
+			// Never destroyed: flushed on exit instead (static destruction order is unknown)
+			FMyBinaryLogWriter* const NewWriter = new FMyBinaryLogWriter(Archive, /*bInOwnsArchive*/true);
+			GSessionWriter.store(NewWriter, std::memory_order_release);
+			FCoreDelegates::OnHandleSystemError.AddStatic(&MyBinaryLog::FlushIfStarted);
+			FCoreDelegates::OnHandleSystemEnsure.AddStatic(&MyBinaryLog::FlushIfStarted);
+			FCoreDelegates::OnExit.AddStatic(&MyBinaryLog::FlushIfStarted);
+			return NewWriter;
+		}();
+		return *Writer;
+	}
+
+	void FlushIfStarted()
+	{
+		if(FMyBinaryLogWriter* const Writer = GSessionWriter.load(std::memory_order_acquire))
+		{
+			Writer->TryFlush();
+		}
+	}
+
+	bool Decode(const TArray<uint8>& InData, TArray<FString>& OutLines, FString* const OutError)
+	{
+		auto Fail = [OutError](const FString& InError)
+		{
+			if(OutError)
+			{
+				*OutError = InError;
+			}
+			return false;
+		};
+
+		FMyBinaryLogReader Reader { InData.GetData(), InData.Num() };
+		if(Reader.Read<uint32>() != FILE_MAGIC)
+		{
+			return Fail(TEXT("NOT a binary log (wrong magic)"));
+		}
+		uint32 const Version = Reader.Read<uint32>();
+		if(Version != FILE_VERSION)
+		{
+			return Fail(FString::Printf(TEXT("Unsupported version %u"), Version));
+		}
+		uint64 const StartCycles = Reader.Read<uint64>();
+		double const SecondsPerCycle = Reader.Read<double>();
+
+		TMap<uint32, FDecodedFormat> Formats;
+		TMap<uint32, FDecodedStream> Streams;
+		TArray<FDecodedLine> Lines;
+		FString Error;
+		bool bDecoded = true;
+		while(bDecoded && ! Reader.IsAtEnd() )
+		{
+			EMyBinaryLogTag const Tag = Reader.Read<EMyBinaryLogTag>();
+			uint32 const StreamId = Reader.Read<uint32>();
+			int32 const ChunkSize = Reader.Read<int32>();
+			const uint8* const ChunkData = Reader.ReadBytes(ChunkSize);
+			if(Tag != EMyBinaryLogTag::Chunk || ChunkData == nullptr)
+			{
+				Error = Tag != EMyBinaryLogTag::Chunk ? FString::Printf(TEXT("Unknown chunk tag %d"), static_cast<int32>(Tag)) : FString(TEXT("Unexpected end of data (the last chunk is truncated)"));
+				bDecoded = false;
+				break;
+			}
+			FMyBinaryLogReader ChunkReader { ChunkData, ChunkSize };
+			bDecoded = DecodeChunk(ChunkReader, StartCycles, SecondsPerCycle, Formats, Streams.FindOrAdd(StreamId), Lines, Error);
+		}
+
+		// Chunks of the streams are written as they fill up: restoring the order of the records
+		Lines.StableSort([](const FDecodedLine& A, const FDecodedLine& B) { return A.Cycles < B.Cycles; });
+		for(FDecodedLine& Line : Lines)
+		{
+			OutLines.Add(MoveTemp(Line.Text));
+		}
+		return bDecoded || Fail(Error);
+	}
+} // MyBinaryLog
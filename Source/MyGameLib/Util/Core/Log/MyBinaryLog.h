@@ -0,0 +1,329 @@
+#pragma once
+
+/**
+* Binary (deferred formatting) log.
+*
+* Each call site registers the static format descriptor once (FMyBinaryLogFormat),
+* at runtime only the descriptor id and the raw argument bytes are written;
+* strings and names are interned (written once, then referenced by id).
+* Each thread writes to its own stream (@see FMyBinaryLogStream), so the records of the different threads never contend.
+* Text is reconstructed offline by MyBinaryLog::Decode (@see UMyBinaryLogDecodeCommandlet):
+* the conversion specifications (e.g. %.2f, %5d) are applied as the text log does.
+*
+* Enabled by the MyLog.Binary console variable, written to <ProjectLogDir>/<ProjectName>.mybinlog.
+*
+* Format strings may use: %d %i %u (int32), %lld (int64), %f %lf (float, double),
+* %s (strings, FName, FVector, FRotator, UObject pointers - name and class), %%.
+* Values are written in the native byte order.
+*/
+
+#include "MyLogCallSite.h"
+#include "MyFloatFormat.h"
+#include "Util/Core/MyDebugMacros.h"
+#include "Containers/BitArray.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Decay.h"
+#include "Templates/UniquePtr.h"
+#include "Math/Vector.h"
+#include "Math/Rotator.h"
+#include "UObject/NameTypes.h"
+#include <atomic>
+
+class FArchive;
+class UObject;
+
+/** Type of the binary log argument (stored in the descriptor)*/
+enum class EMyBinaryLogArgType : uint8
+{
+	None = 0,
+	Int32,
+	Float,
+	Double,
+	String,
+	Name,
+	Vector,
+	Rotator,
+	Int64,
+	Object
+};
+
+/**
+* Static format descriptor of the call site.
+*/
+struct FMyBinaryLogFormat
+{
+	/** Unique id of the descriptor (assigned at construction)*/
+	uint32 Id = 0;
+
+	FMyLogCallSite Site;
+	const FLogCategoryBase* Category = nullptr;
+	ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+	const TCHAR* Format = nullptr;
+
+	FMyBinaryLogFormat(const ANSICHAR* InFunction, const ANSICHAR* InFile, int32 InLine, const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const TCHAR* InFormat);
+};
+
+/**
+* Records of one thread (the stream of the thread in FMyBinaryLogWriter).
+*
+* Format descriptors, strings and names are interned per stream (the decoder keeps the tables per stream),
+* so the record is written under the lock of the stream, that only the flush contends for.
+* Interning is bounded: the strings above the limit (or too long) are written inline.
+*/
+class FMyBinaryLogStream
+{
+public:
+	explicit FMyBinaryLogStream(uint32 InId, uint32 InThreadId);
+
+	FMyBinaryLogStream(const FMyBinaryLogStream&) = delete;
+	FMyBinaryLogStream& operator=(const FMyBinaryLogStream&) = delete;
+
+	// ~Argument writers (used by TMyBinaryLogArg) Begin
+	void WriteRaw(const void* InData, int32 InNumBytes);
+	void WriteString(const TCHAR* InString);
+	void WriteName(const FName& InName);
+	/** Name and class of the object (as the names), or nothing but the null flag*/
+	void WriteObject(const UObject* InObject);
+	// ~Argument writers End
+
+private:
+	friend class FMyBinaryLogWriter;
+
+	void BeginRecord(const FMyBinaryLogFormat& InFormat, const EMyBinaryLogArgType* InArgTypes, int32 InNumArgs);
+
+	/** @returns: true if the buffer is to be written to the archive*/
+	bool EndRecord();
+
+	uint32 Id = 0;
+	uint32 ThreadId = 0;
+	FCriticalSection Mutex;
+	TArray<uint8> Buffer;
+
+	/** Descriptors written to this stream (by descriptor id)*/
+	TBitArray<> WrittenFormats;
+
+	/** Interned strings: CRC -> ids of the strings with the CRC*/
+	TMultiMap<uint32, uint32> StringIdsByCrc;
+	TArray<FString> Strings;
+
+	/** Names written to this stream (by comparison index)*/
+	TSet<int32> WrittenNames;
+
+	/** Definitions of the strings and names first seen in the current record*/
+	TArray<uint8> PendingDefinitions;
+
+	/** Offset of the current record in the buffer*/
+	int32 RecordStart = 0;
+};
+
+/**
+* Writes binary records to the archive (thread-safe).
+* Records are buffered by the stream of the calling thread and written as the chunk of the stream
+* when the buffer is full or flushed.
+*/
+class FMyBinaryLogWriter
+{
+public:
+	/**
+	* @param InArchive: archive to write to (must outlive the writer unless bInOwnsArchive).
+	*/
+	FMyBinaryLogWriter(FArchive* InArchive, bool bInOwnsArchive);
+	~FMyBinaryLogWriter();
+
+	FMyBinaryLogWriter(const FMyBinaryLogWriter&) = delete;
+	FMyBinaryLogWriter& operator=(const FMyBinaryLogWriter&) = delete;
+
+	template<class... Types>
+	void Write(const FMyBinaryLogFormat& InFormat, const Types&... InArgs);
+
+	/** Writes the buffered records of all the streams to the archive*/
+	void Flush();
+
+	/**
+	* Flush that gives up if the locks are NOT released in time (for crash paths).
+	*/
+	void TryFlush();
+
+private:
+	/** Stream of the calling thread (created on the first record of the thread)*/
+	FMyBinaryLogStream& GetThreadStream();
+
+	/** Snapshot of the streams (streams are never removed while the writer lives)*/
+	TArray<FMyBinaryLogStream*> GetStreams();
+
+	/**
+	* Writes the buffered records of the stream as the chunk.
+	* @note: the lock of the stream must be taken (the lock of the stream is always taken before the lock of the writer).
+	*/
+	void WriteChunk(FMyBinaryLogStream& InStream);
+
+	/** @see WriteChunk (the lock of the writer must be taken too)*/
+	void WriteChunkLocked(FMyBinaryLogStream& InStream);
+
+	FArchive* Archive = nullptr;
+	bool bOwnsArchive = false;
+
+	/** Unique id of the writer (the threads cache their streams by it: the address of the writer may be reused)*/
+	uint64 Serial = 0;
+
+	/** Guards the archive and the list of the streams*/
+	FCriticalSection Mutex;
+	TArray<TUniquePtr<FMyBinaryLogStream>> Streams;
+};
+
+/**
+* Binary representation of the argument type (undefined for unsupported types - compile error).
+*/
+template<class T> struct TMyBinaryLogArg;
+
+template<> struct TMyBinaryLogArg<int32>
+{
+	static constexpr EMyBinaryLogArgType Type = EMyBinaryLogArgType::Int32;
+	static void Write(FMyBinaryLogStream& InStream, int32 const InValue) { InStream.WriteRaw(&InValue, sizeof(InValue)); }
+};
+
+template<> struct TMyBinaryLogArg<int64>
+{
+	static constexpr EMyBinaryLogArgType Type = EMyBinaryLogArgType::Int64;
+	static void Write(FMyBinaryLogStream& InStream, int64 const InValue) { InStream.WriteRaw(&InValue, sizeof(InValue)); }
+};
+
+template<> struct TMyBinaryLogArg<float>
+{
+	static constexpr EMyBinaryLogArgType Type = EMyBinaryLogArgType::Float;
+	static void Write(FMyBinaryLogStream& InStream, float const InValue) { InStream.WriteRaw(&InValue, sizeof(InValue)); }
+};
+
+template<> struct TMyBinaryLogArg<double>
+{
+	static constexpr EMyBinaryLogArgType Type = EMyBinaryLogArgType::Double;
+	static void Write(FMyBinaryLogStream& InStream, double const InValue) { InStream.WriteRaw(&InValue, sizeof(InValue)); }
+};
+
+template<> struct TMyBinaryLogArg<const TCHAR*>
+{
+	static constexpr EMyBinaryLogArgType Type = EMyBinaryLogArgType::String;
+	static void Write(FMyBinaryLogStream& InStream, const TCHAR* const InValue) { InStream.WriteString(InValue); }
+};
+
+template<> struct TMyBinaryLogArg<TCHAR*> : TMyBinaryLogArg<const TCHAR*> {};
+
+template<> struct TMyBinaryLogArg<FString>
+{
+	static constexpr EMyBinaryLogArgType Type = EMyBinaryLogArgType::String;
+	static void Write(FMyBinaryLogStream& InStream, const FString& InValue) { InStream.WriteString(*InValue); }
+};
+
+template<> struct TMyBinaryLogArg<FName>
+{
+	static constexpr EMyBinaryLogArgType Type = EMyBinaryLogArgType::Name;
+	static void Write(FMyBinaryLogStream& InStream, const FName& InValue) { InStream.WriteName(InValue); }
+};
+
+template<> struct TMyBinaryLogArg<FVector>
+{
+	static constexpr EMyBinaryLogArgType Type = EMyBinaryLogArgType::Vector;
+	static void Write(FMyBinaryLogStream& InStream, const FVector& InValue) { InStream.WriteRaw(&InValue.X, 3 * sizeof(float)); }
+};
+
+template<> struct TMyBinaryLogArg<FRotator>
+{
+	static constexpr EMyBinaryLogArgType Type = EMyBinaryLogArgType::Rotator;
+	static void Write(FMyBinaryLogStream& InStream, const FRotator& InValue) { InStream.WriteRaw(&InValue.Pitch, 3 * sizeof(float)); }
+};
+
+template<> struct TMyBinaryLogArg<const UObject*>
+{
+	static constexpr EMyBinaryLogArgType Type = EMyBinaryLogArgType::Object;
+	static void Write(FMyBinaryLogStream& InStream, const UObject* const InValue) { InStream.WriteObject(InValue); }
+};
+
+template<class... Types>
+void FMyBinaryLogWriter::Write(const FMyBinaryLogFormat& InFormat, const Types&... InArgs)
+{
+	// None terminates the list (and makes the array valid for zero arguments)
+	static const EMyBinaryLogArgType ArgTypes[] = { TMyBinaryLogArg<typename TDecay<Types>::Type>::Type..., EMyBinaryLogArgType::None };
+	FMyBinaryLogStream& Stream = GetThreadStream();
+	FScopeLock const Lock { &Stream.Mutex };
+	Stream.BeginRecord(InFormat, ArgTypes, sizeof...(Types));
+	int32 const Unused[] = { 0, (TMyBinaryLogArg<typename TDecay<Types>::Type>::Write(Stream, InArgs), 0)... };
+	(void)Unused;
+	if(Stream.EndRecord())
+	{
+		WriteChunk(Stream);
+	}
+}
+
+namespace MyBinaryLog
+{
+	/** Is binary logging enabled by the console variable*/
+	bool IsEnabled();
+
+	/** Writer of the log file of the session (created on the first call)*/
+	FMyBinaryLogWriter& GetWriter();
+
+	/** Flushes the log file of the session if it was ever created*/
+	void FlushIfStarted();
+
+	/**
+	* Reconstructs the text of the binary log.
+	*
+	* @returns: false if the data is corrupted (lines decoded before the error are still returned).
+	*/
+	bool Decode(const TArray<uint8>& InData, TArray<FString>& OutLines, FString* OutError = nullptr);
+} // MyBinaryLog
+
+namespace MyBinaryLog
+{
+	// ~Text fallback Begin (values that are written as %s are converted to strings)
+	inline FMyMathText ToText(const FVector& InValue) { return MyFloatFormat::ToText(InValue); }
+	inline FMyMathText ToText(const FRotator& InValue) { return MyFloatFormat::ToText(InValue); }
+	inline FString ToText(const FName& InValue) { return InValue.ToString(); }
+	template<class T> const T& ToText(const T& InValue) { return InValue; }
+
+	inline const TCHAR* ToPrintfArg(const FString& InValue) { return *InValue; }
+	inline const TCHAR* ToPrintfArg(const FMyMathText& InValue) { return *InValue; }
+	template<class T> const T& ToPrintfArg(const T& InValue) { return InValue; }
+
+	/**
+	* Logs the text of the record (when the binary log is disabled).
+	*/
+	template<typename FmtType, class... Types>
+	void LogText(const FMyBinaryLogFormat& InFormat, const FmtType& InFormatString, const Types&... InArgs)
+	{
+		MyLog::Logf(InFormat.Site, *InFormat.Category, InFormat.Verbosity, InFormatString, ToPrintfArg(ToText(InArgs))...);
+	}
+	// ~Text fallback End
+} // MyBinaryLog
+
+/**
+* Writes the binary record if MyLog.Binary is enabled, otherwise logs the text (the same as M_LOG_CUSTOM_TO).
+* @note: arguments are the values themselves (FVector, FName...), NOT their strings.
+*/
+#define M_LOG_DEFERRED_CUSTOM_TO(LogCategory, LogLevel, FormatString, ...)\
+{\
+	if(M_LOG_IS_ACTIVE(LogCategory, LogLevel))\
+	{\
+		static const FMyBinaryLogFormat MyBinaryLogFormat { __FUNCTION__, __FILE__, __LINE__, LogCategory, ELogVerbosity::LogLevel, FormatString };\
+		if(MyBinaryLogFormat.Site.IsEnabled())\
+		{\
+			if(MyBinaryLog::IsEnabled())\
+			{\
+				MyBinaryLog::GetWriter().Write(MyBinaryLogFormat, ##__VA_ARGS__);\
+			}\
+			else\
+			{\
+				MyBinaryLog::LogText(MyBinaryLogFormat, FormatString, ##__VA_ARGS__);\
+			}\
+		}\
+	}\
+}
+
+#define M_LOG_DEFERRED(FormatString, ...) M_LOG_DEFERRED_CUSTOM_TO(MyLog, Log, FormatString, ##__VA_ARGS__)
+#define M_LOG_DEFERRED_IF(ShouldLog, FormatString, ...)\
+{\
+	if(ShouldLog)\
+	{\
+		M_LOG_DEFERRED(FormatString, ##__VA_ARGS__);\
+	}\
+}
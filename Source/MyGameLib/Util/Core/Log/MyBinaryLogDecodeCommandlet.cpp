@@ -0,0 +1,55 @@
+#include "MyBinaryLogDecodeCommandlet.h"
+#include "MyBinaryLog.h"
+#include "Util/Core/MyDebugMacros.h"
+
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+
+UMyBinaryLogDecodeCommandlet::UMyBinaryLogDecodeCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UMyBinaryLogDecodeCommandlet::Main(const FString& Params)
+{
+	FString InPath;
+	if( ! FParse::Value(*Params, TEXT("In="), InPath) )
+	{
+		M_LOG_ERROR(TEXT("Usage: -run=MyBinaryLogDecode -In=<File.mybinlog> [-Out=<File.log>]"));
+		return 1;
+	}
+
+	TArray<uint8> Data;
+	if( ! FFileHelper::LoadFileToArray(Data, *InPath) )
+	{
+		M_LOG_ERROR(TEXT("Unable to read \"%s\""), *InPath);
+		return 1;
+	}
+
+	TArray<FString> Lines;
+	FString Error;
+	bool const bDecoded = MyBinaryLog::Decode(Data, Lines, &Error);
+	M_LOG_ERROR_IF( ! bDecoded, TEXT("Decoding \"%s\" failed after %d lines: %s"), *InPath, Lines.Num(), *Error);
+
+	FString OutPath;
+	if(FParse::Value(*Params, TEXT("Out="), OutPath))
+	{
+		if( ! FFileHelper::SaveStringArrayToFile(Lines, *OutPath) )
+		{
+			M_LOG_ERROR(TEXT("Unable to write \"%s\""), *OutPath);
+			return 1;
+		}
+		M_LOG(TEXT("%d lines decoded from \"%s\" to \"%s\""), Lines.Num(), *InPath, *OutPath);
+	}
+	else
+	{
+		for(const FString& Line : Lines)
+		{
+			M_LOG(TEXT("%s"), *Line);
+		}
+	}
+	return bDecoded ? 0 : 1;
+}
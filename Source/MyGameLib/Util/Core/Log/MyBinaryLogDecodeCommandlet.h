@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "MyBinaryLogDecodeCommandlet.generated.h"
+
+/**
+* Reconstructs the text of the binary log (@see MyBinaryLog.h).
+*
+* Usage: UE4Editor-Cmd.exe <Project> -run=MyBinaryLogDecode -In=<File.mybinlog> [-Out=<File.log>]
+* Without -Out the lines are written to the output log.
+*/
+UCLASS()
+class UMyBinaryLogDecodeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMyBinaryLogDecodeCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,128 @@
+#include "MyBitmaskFormatter.h"
+
+#include "UObject/Class.h"
+#include "Math/UnrealMathUtility.h"
+
+namespace
+{
+	/** Slots probed for the mask (starting from its hash)*/
+	constexpr int32 MAX_MEMO_PROBES = 4;
+
+	int32 GetMemoSlot(uint64 const InValue)
+	{
+		// Fibonacci hashing: the flags usually differ in the high bits only
+		return static_cast<int32>((InValue * 0x9E3779B97F4A7C15ULL) >> 59) % FMyBitmaskFormatter::MEMO_CAPACITY;
+	}
+}
+
+FMyBitmaskFormatter::FMyBitmaskFormatter(TArrayView<const FMyBitName> const InBitNames, const TCHAR* const InSeparator, const TCHAR* const InNoneText) :
+	Separator ( InSeparator )
+,	NoneText ( InNoneText )
+{
+	for(const FMyBitName& BitName : InBitNames)
+	{
+		AddBit(BitName.Mask, BitName.Name);
+	}
+	for(std::atomic<FMemoEntry*>& Slot : Memo)
+	{
+		Slot.store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+FMyBitmaskFormatter::FMyBitmaskFormatter(const UEnum* const InEnum, const TCHAR* const InSeparator, const TCHAR* const InNoneText) :
+	Separator ( InSeparator )
+,	NoneText ( InNoneText )
+{
+	checkf(InEnum, TEXT("Enum must be valid in %s"), TEXT(__FUNCTION__));
+	// The last entry is the generated _MAX; zero (None) is NOT a bit, though IsPowerOfTwo(0) is true
+	for(int32 EnumIndex = 0; EnumIndex < InEnum->NumEnums() - 1; ++EnumIndex)
+	{
+		uint64 const Mask = static_cast<uint64>(InEnum->GetValueByIndex(EnumIndex));
+		if(Mask != 0 && FMath::IsPowerOfTwo(Mask) && ! InEnum->HasMetaData(TEXT("Hidden"), EnumIndex))
+		{
+			AddBit(Mask, InEnum->GetNameStringByIndex(EnumIndex));
+		}
+	}
+	for(std::atomic<FMemoEntry*>& Slot : Memo)
+	{
+		Slot.store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+FMyBitmaskFormatter::~FMyBitmaskFormatter()
+{
+	for(std::atomic<FMemoEntry*>& Slot : Memo)
+	{
+		delete Slot.load(std::memory_order_acquire);
+	}
+}
+
+void FMyBitmaskFormatter::AddBit(uint64 const InMask, const FString& InName)
+{
+	checkf(InMask != 0, TEXT("Zero mask of \"%s\" in %s"), *InName, TEXT(__FUNCTION__));
+	Masks.Add(InMask);
+	Names.Add(InName);
+}
+
+void FMyBitmaskFormatter::Append(FString& InOut, uint64 const InValue) const
+{
+	int32 const FirstSlot = GetMemoSlot(InValue);
+	int32 FreeSlot = INDEX_NONE;
+	for(int32 Probe = 0; Probe < MAX_MEMO_PROBES; ++Probe)
+	{
+		int32 const Slot = (FirstSlot + Probe) % MEMO_CAPACITY;
+		const FMemoEntry* const Entry = Memo[Slot].load(std::memory_order_acquire);
+		if(Entry == nullptr)
+		{
+			FreeSlot = Slot;
+			break;
+		}
+		if(Entry->Value == InValue)
+		{
+			InOut.Append(Entry->Text);
+			return;
+		}
+	}
+
+	if(FreeSlot == INDEX_NONE)
+	{
+		// The memo is full along the probes
+		Format(InOut, InValue);
+		return;
+	}
+
+	FMemoEntry* const NewEntry = new FMemoEntry();
+	NewEntry->Value = InValue;
+	Format(NewEntry->Text, InValue);
+	InOut.Append(NewEntry->Text);
+	FMemoEntry* ExpectedEntry = nullptr;
+	if( ! Memo[FreeSlot].compare_exchange_strong(ExpectedEntry, NewEntry, std::memory_order_acq_rel) )
+	{
+		// Taken by the other thread
+		delete NewEntry;
+	}
+}
+
+FString FMyBitmaskFormatter::ToString(uint64 const InValue) const
+{
+	FString Result;
+	Append(Result, InValue);
+	return Result;
+}
+
+void FMyBitmaskFormatter::Format(FString& InOut, uint64 const InValue) const
+{
+	if(InValue == 0)
+	{
+		InOut.Append(NoneText);
+		return;
+	}
+	for(int32 BitIndex = 0; BitIndex < Masks.Num(); ++BitIndex)
+	{
+		if((InValue & Masks[BitIndex]) != 0)
+		{
+			InOut.Append(Names[BitIndex]);
+			InOut.Append(Separator);
+		}
+	}
+}
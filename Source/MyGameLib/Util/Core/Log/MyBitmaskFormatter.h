@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ArrayView.h"
+#include <atomic>
+#include <type_traits>
+
+class UEnum;
+
+/** Name of the flag in the name table of the formatter*/
+struct FMyBitName
+{
+	uint64 Mask = 0;
+	const TCHAR* Name = nullptr;
+};
+
+/**
+* Table-driven formatter of the bitmasks: "Name1<Separator>Name2<Separator>" (or the none text if no flags set).
+*
+* Names of the bits are precomputed (from the static table or from the UEnum),
+* strings of the distinct masks are memoized in the small lock-free cache,
+* so formatting the common masks is the lookup.
+* The memo slots are filled once and never replaced (masks that do not fit are formatted each time).
+*
+* @note: bits without the name are NOT printed.
+*/
+class FMyBitmaskFormatter
+{
+public:
+	/** Number of the memoized masks*/
+	static constexpr int32 MEMO_CAPACITY = 32;
+
+	FMyBitmaskFormatter(TArrayView<const FMyBitName> InBitNames, const TCHAR* InSeparator = TEXT(" | "), const TCHAR* InNoneText = TEXT("None"));
+
+	/**
+	* Takes the names of the single bit entries of the enum (hidden entries are skipped).
+	*/
+	FMyBitmaskFormatter(const UEnum* InEnum, const TCHAR* InSeparator = TEXT(" | "), const TCHAR* InNoneText = TEXT("None"));
+
+	~FMyBitmaskFormatter();
+
+	FMyBitmaskFormatter(const FMyBitmaskFormatter&) = delete;
+	FMyBitmaskFormatter& operator=(const FMyBitmaskFormatter&) = delete;
+
+	void Append(FString& InOut, uint64 InValue) const;
+	FString ToString(uint64 InValue) const;
+
+	/** Number of the named bits*/
+	int32 NumBits() const { return Names.Num(); }
+
+private:
+	struct FMemoEntry
+	{
+		uint64 Value = 0;
+		FString Text;
+	};
+
+	void AddBit(uint64 InMask, const FString& InName);
+	void Format(FString& InOut, uint64 InValue) const;
+
+	TArray<uint64> Masks;
+	TArray<FString> Names;
+	FString Separator;
+	FString NoneText;
+
+	mutable std::atomic<FMemoEntry*> Memo[MEMO_CAPACITY];
+};
+
+/**
+* Formatter of the flags enum.
+*/
+template<class EnumT>
+class TMyBitmaskFormatter : public FMyBitmaskFormatter
+{
+	static_assert(std::is_enum<EnumT>::value, "TMyBitmaskFormatter: flags enum expected");
+
+public:
+	using FMyBitmaskFormatter::FMyBitmaskFormatter;
+	using FMyBitmaskFormatter::Append;
+	using FMyBitmaskFormatter::ToString;
+
+	void Append(FString& InOut, EnumT const InValue) const
+	{
+		FMyBitmaskFormatter::Append(InOut, ToBits(InValue));
+	}
+
+	FString ToString(EnumT const InValue) const
+	{
+		return FMyBitmaskFormatter::ToString(ToBits(InValue));
+	}
+
+private:
+	static uint64 ToBits(EnumT const InValue)
+	{
+		return static_cast<uint64>(static_cast<typename std::make_unsigned<typename std::underlying_type<EnumT>::type>::type>(InValue));
+	}
+};
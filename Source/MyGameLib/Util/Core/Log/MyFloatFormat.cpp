@@ -0,0 +1,306 @@
+#include "MyFloatFormat.h"
+
+#include "Misc/CString.h"
+#include "Math/UnrealMathUtility.h"
+#include "Math/Transform.h"
+
+namespace
+{
+	/** Greatest scaled value (Value * 10^Decimals) formatted by the integer path (must be the exact double integer)*/
+	constexpr double MAX_INTEGER_PATH_VALUE = 1.0e15;
+
+	/** Greatest number of decimals tried by the shortest mode*/
+	constexpr int32 MAX_SHORTEST_DECIMALS = 12;
+
+	/** Number of significant digits of "%g"*/
+	constexpr int32 GENERAL_SIGNIFICANT_DIGITS = 6;
+
+	/** "%g" writes the fixed notation for the decimal exponents in range [MIN_GENERAL_EXPONENT; GENERAL_SIGNIFICANT_DIGITS)*/
+	constexpr int32 MIN_GENERAL_EXPONENT = -4;
+
+	constexpr double POWERS_OF_TEN[] =
+	{
+		1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7,
+		1.0e8, 1.0e9, 1.0e10, 1.0e11, 1.0e12, 1.0e13, 1.0e14, 1.0e15
+	};
+
+	bool HasSignBit(float const InValue)
+	{
+		uint32 Bits = 0;
+		FMemory::Memcpy(&Bits, &InValue, sizeof(Bits));
+		return (Bits >> 31) != 0;
+	}
+
+	/**
+	* Rounds the scaled value to the integer (exact ties go to the even integer, the same as printf).
+	*/
+	uint64 RoundScaled(double const InScaledValue)
+	{
+		double const IntegerPart = FMath::FloorToDouble(InScaledValue);
+		double const Fraction = InScaledValue - IntegerPart;
+		uint64 Result = static_cast<uint64>(IntegerPart);
+		if(Fraction > 0.5 || (Fraction == 0.5 && (Result & 1) != 0))
+		{
+			++Result;
+		}
+		return Result;
+	}
+
+	/**
+	* Writes "Integer.Fraction" of the scaled value (ScaledValue = Value * 10^Decimals, rounded).
+	*/
+	int32 WriteScaled(TCHAR* const OutBuffer, bool const bInNegative, uint64 const InScaledValue, int32 const InDecimals)
+	{
+		uint64 const Scale = static_cast<uint64>(POWERS_OF_TEN[InDecimals]);
+		uint64 IntegerPart = InScaledValue / Scale;
+		uint64 FractionPart = InScaledValue % Scale;
+
+		// Digits are written backwards into the temporary buffer
+		TCHAR Reversed[MyFloatFormat::MAX_FLOAT_LEN];
+		int32 NumReversed = 0;
+		for(int32 DigitIndex = 0; DigitIndex < InDecimals; ++DigitIndex)
+		{
+			Reversed[NumReversed++] = TEXT('0') + static_cast<TCHAR>(FractionPart % 10);
+			FractionPart /= 10;
+		}
+		if(InDecimals > 0)
+		{
+			Reversed[NumReversed++] = TEXT('.');
+		}
+		do
+		{
+			Reversed[NumReversed++] = TEXT('0') + static_cast<TCHAR>(IntegerPart % 10);
+			IntegerPart /= 10;
+		}
+		while(IntegerPart > 0);
+
+		int32 Len = 0;
+		if(bInNegative)
+		{
+			OutBuffer[Len++] = TEXT('-');
+		}
+		while(NumReversed > 0)
+		{
+			OutBuffer[Len++] = Reversed[--NumReversed];
+		}
+		OutBuffer[Len] = 0;
+		return Len;
+	}
+
+	int32 FinishSnprintf(TCHAR* const OutBuffer, int32 const InWritten)
+	{
+		int32 const Len = FMath::Clamp(InWritten, 0, MyFloatFormat::MAX_FLOAT_LEN);
+		OutBuffer[Len] = 0;
+		return Len;
+	}
+
+	template<class... FloatTypes>
+	FMyMathText MakeComponentsText(int32 const InPrecision, const TCHAR* const InNames[], FloatTypes... InComponents)
+	{
+		float const Components[] = { static_cast<float>(InComponents)... };
+		FMyMathText Text;
+		for(int32 ComponentIndex = 0; ComponentIndex < ARRAY_COUNT(Components); ++ComponentIndex)
+		{
+			if(ComponentIndex > 0)
+			{
+				Text.AppendChar(TEXT(' '));
+			}
+			Text.Append(InNames[ComponentIndex]);
+			Text.AppendFloat(Components[ComponentIndex], InPrecision);
+		}
+		return Text;
+	}
+
+	const TCHAR* const XYZW_NAMES[] = { TEXT("X="), TEXT("Y="), TEXT("Z="), TEXT("W=") };
+	const TCHAR* const PYR_NAMES[] = { TEXT("P="), TEXT("Y="), TEXT("R=") };
+}
+
+// ~FMyMathText Begin
+void FMyMathText::Append(const TCHAR* const InText)
+{
+	for(const TCHAR* Char = InText; *Char && Length < CAPACITY - 1; ++Char)
+	{
+		Data[Length++] = *Char;
+	}
+	Data[Length] = 0;
+}
+
+void FMyMathText::AppendChar(TCHAR const InChar)
+{
+	if(Length < CAPACITY - 1)
+	{
+		Data[Length++] = InChar;
+		Data[Length] = 0;
+	}
+}
+
+void FMyMathText::AppendFloat(float const InValue, int32 const InPrecision)
+{
+	if(Length + MyFloatFormat::MAX_FLOAT_LEN >= CAPACITY)
+	{
+		return;
+	}
+	Length += MyFloatFormat::Format(Data + Length, InValue, InPrecision);
+}
+// ~FMyMathText End
+
+namespace MyFloatFormat
+{
+	int32 Format(TCHAR* const OutBuffer, float const InValue, int32 const InPrecision)
+	{
+		switch(InPrecision)
+		{
+		case SHORTEST:
+			return FormatShortest(OutBuffer, InValue);
+
+		case GENERAL:
+			return FormatGeneral(OutBuffer, InValue);
+
+		default:
+			return FormatFixed(OutBuffer, InValue, InPrecision);
+		}
+	}
+
+	int32 FormatFixed(TCHAR* const OutBuffer, float const InValue, int32 const InPrecision)
+	{
+		checkf(InPrecision >= 0 && InPrecision <= MAX_PRECISION, TEXT("Precision %d is out of range in %s"), InPrecision, TEXT(__FUNCTION__));
+		double const Scaled = FMath::Abs(static_cast<double>(InValue)) * POWERS_OF_TEN[InPrecision];
+		if( ! FMath::IsFinite(InValue) || Scaled >= MAX_INTEGER_PATH_VALUE )
+		{
+			return FinishSnprintf(OutBuffer, FCString::Snprintf(OutBuffer, MAX_FLOAT_LEN + 1, TEXT("%.*f"), InPrecision, InValue));
+		}
+		uint64 const ScaledValue = RoundScaled(Scaled);
+		return WriteScaled(OutBuffer, HasSignBit(InValue), ScaledValue, InPrecision);
+	}
+
+	int32 FormatShortest(TCHAR* const OutBuffer, float const InValue)
+	{
+		double const AbsValue = FMath::Abs(static_cast<double>(InValue));
+		if(FMath::IsFinite(InValue) && AbsValue < MAX_INTEGER_PATH_VALUE)
+		{
+			for(int32 Decimals = 0; Decimals <= MAX_SHORTEST_DECIMALS; ++Decimals)
+			{
+				double const Scaled = AbsValue * POWERS_OF_TEN[Decimals];
+				if(Scaled >= MAX_INTEGER_PATH_VALUE)
+				{
+					break;
+				}
+				uint64 const ScaledValue = RoundScaled(Scaled);
+				// The text is read back as the nearest float of the decimal value
+				if(static_cast<float>(static_cast<double>(ScaledValue) / POWERS_OF_TEN[Decimals]) == static_cast<float>(AbsValue))
+				{
+					return WriteScaled(OutBuffer, HasSignBit(InValue), ScaledValue, Decimals);
+				}
+			}
+		}
+		// Nine significant digits always round-trip the float
+		return FinishSnprintf(OutBuffer, FCString::Snprintf(OutBuffer, MAX_FLOAT_LEN + 1, TEXT("%.9g"), InValue));
+	}
+
+	int32 FormatGeneral(TCHAR* const OutBuffer, float const InValue)
+	{
+		double const AbsValue = FMath::Abs(static_cast<double>(InValue));
+		if(AbsValue == 0.0)
+		{
+			return WriteScaled(OutBuffer, HasSignBit(InValue), 0, 0);
+		}
+		// The float scaled by 10^4 is the exact double, so the decimal exponent is found by the exact comparisons
+		double const ScaledByMinExponent = AbsValue * POWERS_OF_TEN[-MIN_GENERAL_EXPONENT];
+		if(FMath::IsFinite(InValue) && ScaledByMinExponent >= 1.0 && ScaledByMinExponent < POWERS_OF_TEN[GENERAL_SIGNIFICANT_DIGITS - MIN_GENERAL_EXPONENT])
+		{
+			int32 Exponent = MIN_GENERAL_EXPONENT;
+			while(ScaledByMinExponent >= POWERS_OF_TEN[Exponent - MIN_GENERAL_EXPONENT + 1])
+			{
+				++Exponent;
+			}
+			int32 const Decimals = GENERAL_SIGNIFICANT_DIGITS - 1 - Exponent;
+			uint64 const ScaledValue = RoundScaled(AbsValue * POWERS_OF_TEN[Decimals]);
+			// Rounded up to the next power of ten the exponent changes (e.g. 999999.5 is "1e+06"): left to Snprintf
+			if(ScaledValue < static_cast<uint64>(POWERS_OF_TEN[GENERAL_SIGNIFICANT_DIGITS]))
+			{
+				int32 Len = WriteScaled(OutBuffer, HasSignBit(InValue), ScaledValue, Decimals);
+				if(Decimals > 0)
+				{
+					while(OutBuffer[Len - 1] == TEXT('0'))
+					{
+						--Len;
+					}
+					if(OutBuffer[Len - 1] == TEXT('.'))
+					{
+						--Len;
+					}
+					OutBuffer[Len] = 0;
+				}
+				return Len;
+			}
+		}
+		return FinishSnprintf(OutBuffer, FCString::Snprintf(OutBuffer, MAX_FLOAT_LEN + 1, TEXT("%g"), InValue));
+	}
+
+	FMyMathText ToText(const FVector& InValue, int32 const InPrecision)
+	{
+		return MakeComponentsText(InPrecision, XYZW_NAMES, InValue.X, InValue.Y, InValue.Z);
+	}
+
+	FMyMathText ToText(const FVector2D& InValue, int32 const InPrecision)
+	{
+		return MakeComponentsText(InPrecision, XYZW_NAMES, InValue.X, InValue.Y);
+	}
+
+	FMyMathText ToText(const FVector4& InValue, int32 const InPrecision)
+	{
+		return MakeComponentsText(InPrecision, XYZW_NAMES, InValue.X, InValue.Y, InValue.Z, InValue.W);
+	}
+
+	FMyMathText ToText(const FRotator& InValue, int32 const InPrecision)
+	{
+		return MakeComponentsText(InPrecision, PYR_NAMES, InValue.Pitch, InValue.Yaw, InValue.Roll);
+	}
+
+	FMyMathText ToText(const FQuat& InValue, int32 const InPrecision)
+	{
+		return MakeComponentsText(InPrecision, XYZW_NAMES, InValue.X, InValue.Y, InValue.Z, InValue.W);
+	}
+
+	FMyMathText ToText(const FPlane& InValue, int32 const InPrecision)
+	{
+		return MakeComponentsText(InPrecision, XYZW_NAMES, InValue.X, InValue.Y, InValue.Z, InValue.W);
+	}
+
+	FMyMathText ToText(const FMatrix& InValue, int32 const InPrecision)
+	{
+		FMyMathText Text;
+		for(int32 RowIndex = 0; RowIndex < 4; ++RowIndex)
+		{
+			Text.AppendChar(TEXT('['));
+			for(int32 ColumnIndex = 0; ColumnIndex < 4; ++ColumnIndex)
+			{
+				if(ColumnIndex > 0)
+				{
+					Text.AppendChar(TEXT(' '));
+				}
+				Text.AppendFloat(InValue.M[RowIndex][ColumnIndex], InPrecision);
+			}
+			Text.Append(TEXT("] "));
+		}
+		return Text;
+	}
+
+	FMyMathText ToText(const FTransform& InValue, int32 const InPrecision)
+	{
+		FRotator const Rotator = InValue.Rotator();
+		FVector const Translation = InValue.GetTranslation();
+		FVector const Scale = InValue.GetScale3D();
+		float const Components[] = { Translation.X, Translation.Y, Translation.Z, Rotator.Pitch, Rotator.Yaw, Rotator.Roll, Scale.X, Scale.Y, Scale.Z };
+		FMyMathText Text;
+		for(int32 ComponentIndex = 0; ComponentIndex < ARRAY_COUNT(Components); ++ComponentIndex)
+		{
+			if(ComponentIndex > 0)
+			{
+				Text.AppendChar((ComponentIndex % 3 == 0) ? TEXT('|') : TEXT(','));
+			}
+			Text.AppendFloat(Components[ComponentIndex], InPrecision);
+		}
+		return Text;
+	}
+} // MyFloatFormat
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+* Text of the formatted value on the stack (never allocates).
+* Text that does not fit is truncated.
+*/
+struct FMyMathText
+{
+	/** Maximal number of characters including the terminating zero (enough for the matrix)*/
+	static constexpr int32 CAPACITY = 512;
+
+	FMyMathText()
+	{
+		Data[0] = 0;
+	}
+
+	const TCHAR* operator*() const { return Data; }
+	int32 Len() const { return Length; }
+
+	void Append(const TCHAR* InText);
+	void AppendChar(TCHAR InChar);
+
+	/** @see MyFloatFormat::Format*/
+	void AppendFloat(float InValue, int32 InPrecision);
+
+private:
+	TCHAR Data[CAPACITY];
+	int32 Length = 0;
+};
+
+/**
+* Fast float formatting for the math loggers.
+*
+* Fixed mode is the equivalent of "%.Nf" computed in integers (the same rounding);
+* shortest mode prints the fewest decimals that read back as the same float (round-trip).
+* Values out of the range of the integer path (huge, tiny for the shortest mode, NaN, Inf) fall back to Snprintf.
+*/
+namespace MyFloatFormat
+{
+	/** Maximal number of characters of one float (without the terminating zero)*/
+	constexpr int32 MAX_FLOAT_LEN = 64;
+
+	/** Precision meaning the shortest round-trip text*/
+	constexpr int32 SHORTEST = -1;
+
+	/** Precision meaning the equivalent of "%g": 6 significant digits without the trailing zeros (as FMatrix::ToString)*/
+	constexpr int32 GENERAL = -2;
+
+	/** Maximal number of decimals in the fixed mode*/
+	constexpr int32 MAX_PRECISION = 9;
+
+	/** Precision of the vector-like types (the same as FVector::ToString)*/
+	constexpr int32 DEFAULT_PRECISION = 3;
+
+	/** Precision of the rotator (the same as FRotator::ToString)*/
+	constexpr int32 ROTATOR_PRECISION = 6;
+
+	/** Precision of the quaternion (the same as FQuat::ToString)*/
+	constexpr int32 QUAT_PRECISION = 9;
+
+	/** Precision of the transform (the same as FTransform::ToString)*/
+	constexpr int32 TRANSFORM_PRECISION = 6;
+
+	/**
+	* Writes the float and the terminating zero.
+	*
+	* @param OutBuffer: at least MAX_FLOAT_LEN + 1 characters.
+	* @param InPrecision: number of decimals in range [0; MAX_PRECISION], SHORTEST or GENERAL.
+	* @returns: number of characters written (without the terminating zero).
+	*/
+	int32 Format(TCHAR* OutBuffer, float InValue, int32 InPrecision);
+
+	/** @see Format*/
+	int32 FormatFixed(TCHAR* OutBuffer, float InValue, int32 InPrecision);
+
+	/** @see Format*/
+	int32 FormatShortest(TCHAR* OutBuffer, float InValue);
+
+	/** @see Format*/
+	int32 FormatGeneral(TCHAR* OutBuffer, float InValue);
+
+	/** "X=.. Y=.. Z=.." (the same as FVector::ToString with the default precision)*/
+	FMyMathText ToText(const FVector& InValue, int32 InPrecision = DEFAULT_PRECISION);
+
+	/** "X=.. Y=.." (the same as FVector2D::ToString with the default precision)*/
+	FMyMathText ToText(const FVector2D& InValue, int32 InPrecision = DEFAULT_PRECISION);
+
+	/** "X=.. Y=.. Z=.. W=.." (the same as FVector4::ToString with the default precision)*/
+	FMyMathText ToText(const FVector4& InValue, int32 InPrecision = DEFAULT_PRECISION);
+
+	/** "P=.. Y=.. R=.." (the same as FRotator::ToString with the default precision)*/
+	FMyMathText ToText(const FRotator& InValue, int32 InPrecision = ROTATOR_PRECISION);
+
+	/** "X=.. Y=.. Z=.. W=.." (the same as FQuat::ToString with the default precision)*/
+	FMyMathText ToText(const FQuat& InValue, int32 InPrecision = QUAT_PRECISION);
+
+	/** "X=.. Y=.. Z=.. W=.."*/
+	FMyMathText ToText(const FPlane& InValue, int32 InPrecision = DEFAULT_PRECISION);
+
+	/** "[.. .. .. ..] [.. .. .. ..] [.. .. .. ..] [.. .. .. ..] " (rows: the same as FMatrix::ToString with the default precision)*/
+	FMyMathText ToText(const FMatrix& InValue, int32 InPrecision = GENERAL);
+
+	/** "Translation|Rotator|Scale3D" with the comma separated components (the same as FTransform::ToString with the default precision)*/
+	FMyMathText ToText(const FTransform& InValue, int32 InPrecision = TRANSFORM_PRECISION);
+} // MyFloatFormat
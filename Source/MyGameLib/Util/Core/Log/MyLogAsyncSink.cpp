@@ -0,0 +1,322 @@
+#include "MyLogAsyncSink.h"
+#include "Util/Core/MyDebugMacros.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreGlobals.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/OutputDeviceRedirector.h"
+#include "Math/UnrealMathUtility.h"
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarMyLogAsync
+	(
+		TEXT("MyLog.Async"),
+		0,
+		TEXT("Write MyLog lines on the background thread (0 - synchronous, 1 - asynchronous)"),
+		ECVF_Default
+	);
+
+	TAutoConsoleVariable<int32> CVarMyLogAsyncOverflowPolicy
+	(
+		TEXT("MyLog.Async.OverflowPolicy"),
+		static_cast<int32>(EMyLogOverflowPolicy::Drop),
+		TEXT("What to do when the ring of the thread is full (0 - drop the line, 1 - block until there's space)"),
+		ECVF_Default
+	);
+
+	TAutoConsoleVariable<int32> CVarMyLogAsyncRingCapacity
+	(
+		TEXT("MyLog.Async.RingCapacity"),
+		128,
+		TEXT("Number of lines in the ring of each logging thread (applied to the rings created after the change)"),
+		ECVF_Default
+	);
+
+	/** How long the background thread sleeps when there's nothing to write*/
+	constexpr uint32 IDLE_WAIT_MS = 5;
+
+	/** How many times crash path tries to take the drain lock (the crash may happen while it's taken)*/
+	constexpr int32 CRASH_FLUSH_NUM_ATTEMPTS = 100;
+
+	/** Sink, once it's started*/
+	std::atomic<FMyLogAsyncSink*> GStartedSink { nullptr };
+
+	/**
+	* Releases the ring of the thread when the thread exits.
+	*/
+	struct FMyLogAsyncRingOwner
+	{
+		FMyLogAsyncRing* Ring = nullptr;
+
+		~FMyLogAsyncRingOwner()
+		{
+			if(Ring)
+			{
+				Ring->bOwned.store(false, std::memory_order_release);
+			}
+		}
+	};
+
+	thread_local FMyLogAsyncRingOwner GThreadRingOwner;
+
+	/** Is the thread draining the sink now (@see FMyLogAsyncSink::FlushIfStarted)*/
+	thread_local bool GIsDraining = false;
+
+	void WriteRecord(const FMyLogAsyncRecord& InRecord)
+	{
+		// Timestamped by the push, NOT by the drain
+		MyLog::GetOutputDevice(InRecord.Verbosity)->Serialize(InRecord.Text, InRecord.Verbosity, InRecord.Category->GetCategoryName(), InRecord.Time);
+	}
+}
+
+// ~FMyLogAsyncRing Begin
+FMyLogAsyncRing::FMyLogAsyncRing(uint32 const InCapacity)
+{
+	uint32 const Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 2U));
+	Records.SetNum(Capacity);
+	Mask = Capacity - 1;
+}
+
+bool FMyLogAsyncRing::TryPush(const FLogCategoryBase& InCategory, ELogVerbosity::Type const InVerbosity, const TCHAR* const InText)
+{
+	uint32 const Head = HeadIndex.load(std::memory_order_relaxed);
+	if(Head - TailIndex.load(std::memory_order_acquire) > Mask)
+	{
+		return false;
+	}
+	FMyLogAsyncRecord& Record = Records[Head & Mask];
+	Record.Category = &InCategory;
+	Record.Verbosity = InVerbosity;
+	Record.Time = FPlatformTime::Seconds() - GStartTime;
+	FCString::Strncpy(Record.Text, InText, FMyLogLine::CAPACITY);
+	HeadIndex.store(Head + 1, std::memory_order_release);
+	return true;
+}
+// ~FMyLogAsyncRing End
+
+// ~FMyLogAsyncSink Begin
+bool FMyLogAsyncSink::IsEnabled()
+{
+	return CVarMyLogAsync.GetValueOnAnyThread() != 0;
+}
+
+FMyLogAsyncSink& FMyLogAsyncSink::Get()
+{
+	// Never destroyed: the thread must NOT be stopped during the static destruction
+	static FMyLogAsyncSink* const Sink = new FMyLogAsyncSink();
+	return *Sink;
+}
+
+void FMyLogAsyncSink::FlushIfStarted()
+{
+	FMyLogAsyncSink* const Sink = GStartedSink.load(std::memory_order_acquire);
+	// The drain lock is recursive: the draining thread would write the lines it's writing again
+	if(Sink == nullptr || GIsDraining)
+	{
+		return;
+	}
+	for(int32 Attempt = 0; Attempt < CRASH_FLUSH_NUM_ATTEMPTS; ++Attempt)
+	{
+		if(Sink->DrainLock.TryLock())
+		{
+			Sink->DrainAllLocked();
+			Sink->DrainLock.Unlock();
+			return;
+		}
+		FPlatformProcess::SleepNoStats(0.001F);
+	}
+}
+
+FMyLogAsyncSink::FMyLogAsyncSink()
+{
+	if( ! FPlatformProcess::SupportsMultithreading() )
+	{
+		return;
+	}
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(/*bIsManualReset*/false);
+	bRunning.store(true, std::memory_order_release);
+	Thread = FRunnableThread::Create(this, TEXT("MyLogAsyncSink"), 0, TPri_BelowNormal);
+	if(Thread == nullptr)
+	{
+		bRunning.store(false, std::memory_order_release);
+		return;
+	}
+	GStartedSink.store(this, std::memory_order_release);
+
+	FCoreDelegates::OnHandleSystemError.AddStatic(&FMyLogAsyncSink::FlushIfStarted);
+	FCoreDelegates::OnHandleSystemEnsure.AddStatic(&FMyLogAsyncSink::FlushIfStarted);
+	FCoreDelegates::OnExit.AddRaw(this, &FMyLogAsyncSink::Shutdown);
+}
+
+FMyLogAsyncSink::~FMyLogAsyncSink()
+{
+	Shutdown();
+}
+
+void FMyLogAsyncSink::Shutdown()
+{
+	// Producers entering now write the lines themselves, the ones inside may still trigger the event:
+	// it's released only after they returned
+	bRunning.store(false, std::memory_order_seq_cst);
+	while(NumPushers.load(std::memory_order_seq_cst) > 0)
+	{
+		FPlatformProcess::YieldThread();
+	}
+
+	if(Thread)
+	{
+		Thread->Kill(/*bShouldWait*/true);
+		delete Thread;
+		Thread = nullptr;
+	}
+	if(WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+	Flush();
+}
+
+FMyLogAsyncSink::FPusherScope::FPusherScope(FMyLogAsyncSink& InSink) :
+	Sink ( InSink )
+{
+	Sink.NumPushers.fetch_add(1, std::memory_order_seq_cst);
+}
+
+FMyLogAsyncSink::FPusherScope::~FPusherScope()
+{
+	Sink.NumPushers.fetch_sub(1, std::memory_order_release);
+}
+
+bool FMyLogAsyncSink::Push(const FLogCategoryBase& InCategory, ELogVerbosity::Type const InVerbosity, const TCHAR* const InText)
+{
+	FPusherScope const PusherScope { *this };
+	if( ! bRunning.load(std::memory_order_seq_cst) )
+	{
+		return false;
+	}
+
+	FMyLogAsyncRing& Ring = GetThreadRing();
+	if(Ring.TryPush(InCategory, InVerbosity, InText))
+	{
+		// The count grows by one per push, so it equals the half once per filling (the thread drains by the timeout otherwise)
+		if(Ring.Num() == Ring.GetCapacity() / 2)
+		{
+			WakeEvent->Trigger();
+		}
+		return true;
+	}
+
+	if(static_cast<EMyLogOverflowPolicy>(CVarMyLogAsyncOverflowPolicy.GetValueOnAnyThread()) == EMyLogOverflowPolicy::Block)
+	{
+		while(IsRunning())
+		{
+			WakeEvent->Trigger();
+			FPlatformProcess::SleepNoStats(0.0F);
+			if(Ring.TryPush(InCategory, InVerbosity, InText))
+			{
+				return true;
+			}
+		}
+		// Sink is stopped while waiting: the caller writes the line itself
+		return false;
+	}
+
+	NumDropped.fetch_add(1, std::memory_order_relaxed);
+	// Line is dropped by the policy, so it's accepted
+	return true;
+}
+
+void FMyLogAsyncSink::Flush()
+{
+	DrainAll();
+}
+
+uint32 FMyLogAsyncSink::Run()
+{
+	while( ! bStopRequested.load(std::memory_order_acquire) )
+	{
+		if(DrainAll() == 0)
+		{
+			WakeEvent->Wait(IDLE_WAIT_MS);
+		}
+	}
+	DrainAll();
+	return 0;
+}
+
+void FMyLogAsyncSink::Stop()
+{
+	bStopRequested.store(true, std::memory_order_release);
+	if(WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+FMyLogAsyncRing& FMyLogAsyncSink::GetThreadRing()
+{
+	if(GThreadRingOwner.Ring)
+	{
+		return *GThreadRingOwner.Ring;
+	}
+
+	// Reusing the ring of the exited thread
+	for(FMyLogAsyncRing* Ring = Rings.load(std::memory_order_acquire); Ring; Ring = Ring->Next)
+	{
+		bool bExpectedOwned = false;
+		if(Ring->bOwned.compare_exchange_strong(bExpectedOwned, true, std::memory_order_acq_rel))
+		{
+			GThreadRingOwner.Ring = Ring;
+			return *Ring;
+		}
+	}
+
+	FMyLogAsyncRing* const NewRing = new FMyLogAsyncRing(static_cast<uint32>(FMath::Max(CVarMyLogAsyncRingCapacity.GetValueOnAnyThread(), 2)));
+	NewRing->Next = Rings.load(std::memory_order_relaxed);
+	while( ! Rings.compare_exchange_weak(NewRing->Next, NewRing, std::memory_order_release, std::memory_order_relaxed) )
+	{
+	}
+	GThreadRingOwner.Ring = NewRing;
+	return *NewRing;
+}
+
+int32 FMyLogAsyncSink::DrainAll()
+{
+	FScopeLock const Lock { &DrainLock };
+	return DrainAllLocked();
+}
+
+int32 FMyLogAsyncSink::DrainAllLocked()
+{
+	if(GIsDraining)
+	{
+		// Re-entered by the line being written (e.g. Flush from the device)
+		return 0;
+	}
+	GIsDraining = true;
+	int32 NumWritten = 0;
+	for(FMyLogAsyncRing* Ring = Rings.load(std::memory_order_acquire); Ring; Ring = Ring->Next)
+	{
+		NumWritten += Ring->Drain(&WriteRecord);
+	}
+	ReportDropped();
+	GIsDraining = false;
+	return NumWritten;
+}
+
+void FMyLogAsyncSink::ReportDropped()
+{
+	uint64 const Dropped = NumDropped.load(std::memory_order_relaxed);
+	if(Dropped != NumReportedDropped)
+	{
+		GLog->Serialize(*FString::Printf(TEXT("%llu lines dropped by the async sink (ring overflow)"), Dropped - NumReportedDropped), ELogVerbosity::Warning, MyLog.GetCategoryName());
+		NumReportedDropped = Dropped;
+	}
+}
+// ~FMyLogAsyncSink End
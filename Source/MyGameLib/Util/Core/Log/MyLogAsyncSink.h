@@ -0,0 +1,198 @@
+#pragma once
+
+#include "MyLogCallSite.h"
+#include "HAL/Runnable.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+
+/**
+* What to do when the ring of the producer thread is full.
+*/
+enum class EMyLogOverflowPolicy : uint8
+{
+	/** Line is dropped (counted and reported by the sink)*/
+	Drop = 0,
+
+	/** Producer waits until the background thread frees the space*/
+	Block = 1
+};
+
+/**
+* Formatted line waiting in the ring.
+*/
+struct FMyLogAsyncRecord
+{
+	const FLogCategoryBase* Category = nullptr;
+	ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+	/** When the line is pushed (seconds since GStartTime, as the log devices timestamp the lines)*/
+	double Time = 0.0;
+	TCHAR Text[FMyLogLine::CAPACITY];
+};
+
+/**
+* Bounded single-producer single-consumer lock-free ring of records.
+* Producer is the owner thread, consumer is the thread that holds the drain lock of the sink.
+*/
+class FMyLogAsyncRing
+{
+public:
+	/**
+	* @param InCapacity: number of records, rounded up to the power of two.
+	*/
+	explicit FMyLogAsyncRing(uint32 InCapacity);
+
+	/**
+	* Copies the line into the ring (producer only).
+	* @returns: false if the ring is full.
+	*/
+	bool TryPush(const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const TCHAR* InText);
+
+	/**
+	* Passes all the records to the function in the order of pushing (consumer only).
+	* @returns: number of records drained.
+	*/
+	template<class RecordFuncT>
+	int32 Drain(RecordFuncT&& InRecordFunc)
+	{
+		uint32 Tail = TailIndex.load(std::memory_order_relaxed);
+		uint32 const Head = HeadIndex.load(std::memory_order_acquire);
+		int32 const NumDrained = static_cast<int32>(Head - Tail);
+		for(; Tail != Head; ++Tail)
+		{
+			InRecordFunc(Records[Tail & Mask]);
+		}
+		TailIndex.store(Tail, std::memory_order_release);
+		return NumDrained;
+	}
+
+	/** Number of the records (exact for the producer, NOT greater than the real one for the consumer)*/
+	uint32 Num() const
+	{
+		return HeadIndex.load(std::memory_order_relaxed) - TailIndex.load(std::memory_order_acquire);
+	}
+
+	bool IsEmpty() const
+	{
+		return HeadIndex.load(std::memory_order_acquire) == TailIndex.load(std::memory_order_acquire);
+	}
+
+	uint32 GetCapacity() const { return Mask + 1; }
+
+	/** Is the ring used by a thread now (ring of the exited thread is reused by the next new thread)*/
+	std::atomic<bool> bOwned { true };
+
+	/** Next ring of the sink (rings are never removed from the list)*/
+	FMyLogAsyncRing* Next = nullptr;
+
+private:
+	TArray<FMyLogAsyncRecord> Records;
+	uint32 Mask = 0;
+
+	// The indices are kept on their own cache lines by the padding
+	// (NOT by alignas: the rings are created by new, that does NOT respect the extended alignment before C++17)
+	uint8 HeadPadding[PLATFORM_CACHE_LINE_SIZE];
+
+	/** Written by the producer*/
+	std::atomic<uint32> HeadIndex { 0 };
+
+	uint8 TailPadding[PLATFORM_CACHE_LINE_SIZE];
+
+	/** Written by the consumer*/
+	std::atomic<uint32> TailIndex { 0 };
+};
+
+/**
+* Asynchronous sink of the MyLog category.
+*
+* Producers copy the formatted lines into per-thread rings (no locks),
+* the background thread writes them to the log devices.
+* Producers wake the thread only when the ring is half full (or full), otherwise the thread wakes up by the timeout,
+* so the usual push never touches the event.
+* Memory is bounded by (number of threads * MyLog.Async.RingCapacity) records.
+*
+* Enabled by MyLog.Async console variable,
+* overflow policy is set by MyLog.Async.OverflowPolicy (@see EMyLogOverflowPolicy).
+* Flushed automatically on system error, ensure, fatal log and exit.
+*/
+class FMyLogAsyncSink : public FRunnable
+{
+public:
+	/** Is async logging enabled by the console variable*/
+	static bool IsEnabled();
+
+	/** Returns the sink, starts the background thread on the first call*/
+	static FMyLogAsyncSink& Get();
+
+	/**
+	* Flushes the sink if it was ever started (safe to call on crash paths:
+	* gives up if the drain lock is NOT released in time).
+	* Does nothing when called by the thread that is draining the sink (e.g. ensure while writing a line),
+	* so the lines being written are NOT written twice.
+	*/
+	static void FlushIfStarted();
+
+	/**
+	* Pushes the line to the ring of the calling thread.
+	* @returns: false if the line is NOT accepted (dropped or the sink is NOT running) - caller should write it synchronously.
+	*/
+	bool Push(const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const TCHAR* InText);
+
+	/**
+	* Writes all the pending lines of all threads on the calling thread.
+	*/
+	void Flush();
+
+	/** Total number of lines dropped because of overflow*/
+	uint64 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+	bool IsRunning() const { return bRunning.load(std::memory_order_acquire); }
+
+	// ~FRunnable Begin
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	// ~FRunnable End
+
+private:
+	FMyLogAsyncSink();
+	virtual ~FMyLogAsyncSink();
+
+	/**
+	* Refuses the new lines, waits for the producers to return, stops the thread and writes the rest of the lines.
+	*/
+	void Shutdown();
+
+	/** Counts the producer in Push (the event must NOT be released while any producer is in)*/
+	struct FPusherScope
+	{
+		explicit FPusherScope(FMyLogAsyncSink& InSink);
+		~FPusherScope();
+
+		FMyLogAsyncSink& Sink;
+	};
+
+	FMyLogAsyncRing& GetThreadRing();
+
+	/** @returns: number of lines written*/
+	int32 DrainAll();
+
+	/** DrainAll when the drain lock is already taken*/
+	int32 DrainAllLocked();
+
+	void ReportDropped();
+
+	std::atomic<FMyLogAsyncRing*> Rings { nullptr };
+	FCriticalSection DrainLock;
+	FEvent* WakeEvent = nullptr;
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bRunning { false };
+	std::atomic<bool> bStopRequested { false };
+
+	/** Number of the producers inside of Push*/
+	std::atomic<int32> NumPushers { 0 };
+
+	std::atomic<uint64> NumDropped { 0 };
+	uint64 NumReportedDropped = 0;
+};
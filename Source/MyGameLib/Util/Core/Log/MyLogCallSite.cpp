@@ -0,0 +1,287 @@
+#include "MyLogCallSite.h"
+#include "MyLogAsyncSink.h"
+#include "MyLogCoalescer.h"
+#include "MyLogFlightRecorder.h"
+#include "MyLogMappedSink.h"
+#include "Util/Core/MyDebugMacros.h"
+#include "Misc/OutputDeviceRedirector.h"
+#include "Misc/AssertionMacros.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/IConsoleManager.h"
+#include "CoreGlobals.h"
+
+namespace
+{
+	/** Enable/disable rule of the call sites*/
+	struct FMyLogSiteRule
+	{
+		FString Wildcard;
+		bool bEnabled = true;
+	};
+
+	std::atomic<const FMyLogCallSite*> GFirstSite { nullptr };
+
+	/** Guards the rules and the registration (the sites are iterated without the lock)*/
+	FCriticalSection& GetSiteRulesCriticalSection()
+	{
+		static FCriticalSection CriticalSection;
+		return CriticalSection;
+	}
+
+	/** Rules in the order of applying (@note: guarded by GetSiteRulesCriticalSection)*/
+	TArray<FMyLogSiteRule>& GetSiteRules()
+	{
+		static TArray<FMyLogSiteRule> Rules;
+		return Rules;
+	}
+
+	void SetSitesEnabledCommand(const TArray<FString>& InArgs, FOutputDevice& InAr, bool const bInEnabled)
+	{
+		if(InArgs.Num() == 0)
+		{
+			InAr.Logf(TEXT("Wildcard of the function or file is expected (e.g. *Movement*)"));
+			return;
+		}
+		for(const FString& Wildcard : InArgs)
+		{
+			int32 const NumMatched = MyLog::SetSitesEnabled(Wildcard, bInEnabled);
+			InAr.Logf(TEXT("%s: %d registered call sites %s"), *Wildcard, NumMatched, bInEnabled ? TEXT("enabled") : TEXT("disabled"));
+		}
+	}
+
+	void ListSites(const TArray<FString>& InArgs, FOutputDevice& InAr)
+	{
+		int32 NumListed = 0;
+		for(const FMyLogCallSite* Site = FMyLogCallSite::GetFirst(); Site; Site = Site->GetNext())
+		{
+			if(InArgs.Num() > 0 && ! MyLog::MatchesSite(*Site, InArgs[0]))
+			{
+				continue;
+			}
+			InAr.Logf(TEXT("[%s] %s %s%s"), Site->IsEnabled() ? TEXT("on") : TEXT("off"), ToString(Site->Verbosity), *Site->Prefix, *Site->Postfix);
+			++NumListed;
+		}
+		InAr.Logf(TEXT("%d call sites listed"), NumListed);
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const EnableSitesCommand
+	(
+		TEXT("MyLog.Sites.Enable"),
+		TEXT("Enables the log call sites which function, file path or file name matches any of the given wildcards (also applied to the sites reached later)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			SetSitesEnabledCommand(InArgs, InAr, true);
+		})
+	);
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const DisableSitesCommand
+	(
+		TEXT("MyLog.Sites.Disable"),
+		TEXT("Disables the log call sites which function, file path or file name matches any of the given wildcards (also applied to the sites reached later)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			SetSitesEnabledCommand(InArgs, InAr, false);
+		})
+	);
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const ListSitesCommand
+	(
+		TEXT("MyLog.Sites.List"),
+		TEXT("Lists the registered log call sites (optionally only the ones matching the given wildcard)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			ListSites(InArgs, InAr);
+		})
+	);
+}
+
+// ~FMyLogCallSite Begin
+FMyLogCallSite::FMyLogCallSite(const ANSICHAR* const InFunction, const ANSICHAR* const InFile, int32 const InLine, ELogVerbosity::Type const InVerbosity) :
+	Function ( InFunction )
+,	File ( InFile )
+,	Line ( InLine )
+,	Prefix ( FString(InFunction) + FString(TEXT(": ")) )
+,	Postfix ( FString::Printf(TEXT(" (line: %d : %s )"), InLine, ANSI_TO_TCHAR(InFile)) )
+,	Verbosity ( InVerbosity )
+{
+	// Rules and registration under the same lock, so the site either sees the new rule, or the rule sees the site
+	FScopeLock const Lock { &GetSiteRulesCriticalSection() };
+	for(const FMyLogSiteRule& Rule : GetSiteRules())
+	{
+		if(MyLog::MatchesSite(*this, Rule.Wildcard))
+		{
+			bEnabled.store(Rule.bEnabled, std::memory_order_relaxed);
+		}
+	}
+	Next = GFirstSite.load(std::memory_order_relaxed);
+	GFirstSite.store(this, std::memory_order_release);
+}
+
+const FMyLogCallSite* FMyLogCallSite::GetFirst()
+{
+	return GFirstSite.load(std::memory_order_acquire);
+}
+// ~FMyLogCallSite End
+
+void FMyLogLine::Append(const TCHAR* const InText, int32 const InLen)
+{
+	int32 const CopyLen = FMath::Min(InLen, CAPACITY - 1 - Length);
+	if(CopyLen < InLen)
+	{
+		bTruncated = true;
+	}
+	FMemory::Memcpy(Buffer + Length, InText, CopyLen * sizeof(TCHAR));
+	Length += CopyLen;
+	Buffer[Length] = 0;
+}
+
+void FMyLogLine::OnFormatted(int32 const InWritten, int32 const InAvailableLen)
+{
+	// Snprintf returns negative value (or the full length on some platforms) when the text does NOT fit
+	if(InWritten < 0 || InWritten > InAvailableLen)
+	{
+		bTruncated = true;
+		Length += InAvailableLen;
+	}
+	else
+	{
+		Length += InWritten;
+	}
+	Buffer[Length] = 0;
+}
+
+namespace MyLog
+{
+	bool MatchesSite(const FMyLogCallSite& InSite, const FString& InWildcard)
+	{
+		FString const File { ANSI_TO_TCHAR(InSite.File) };
+		return FString(ANSI_TO_TCHAR(InSite.Function)).MatchesWildcard(InWildcard)
+			|| File.MatchesWildcard(InWildcard)
+			|| FPaths::GetCleanFilename(File).MatchesWildcard(InWildcard);
+	}
+
+	int32 SetSitesEnabled(const FString& InWildcard, bool const bInEnabled)
+	{
+		FScopeLock const Lock { &GetSiteRulesCriticalSection() };
+		TArray<FMyLogSiteRule>& Rules = GetSiteRules();
+		// The new rule overrides the rule with the same wildcard
+		Rules.RemoveAll([&InWildcard](const FMyLogSiteRule& InRule) { return InRule.Wildcard == InWildcard; });
+		Rules.Add(FMyLogSiteRule{ InWildcard, bInEnabled });
+
+		int32 NumMatched = 0;
+		for(const FMyLogCallSite* Site = FMyLogCallSite::GetFirst(); Site; Site = Site->GetNext())
+		{
+			if(MatchesSite(*Site, InWildcard))
+			{
+				Site->SetEnabled(bInEnabled);
+				++NumMatched;
+			}
+		}
+		return NumMatched;
+	}
+
+	bool RemoveSitesRule(const FString& InWildcard)
+	{
+		FScopeLock const Lock { &GetSiteRulesCriticalSection() };
+		return GetSiteRules().RemoveAll([&InWildcard](const FMyLogSiteRule& InRule) { return InRule.Wildcard == InWildcard; }) > 0;
+	}
+
+	void Emit(const FMyLogCallSite& InSite, const FLogCategoryBase& InCategory, ELogVerbosity::Type const InVerbosity, const TCHAR* const InMessage, bool const bInToSinks, FOutputDevice* const InDevice)
+	{
+#if !NO_LOGGING
+		// The device gets every line
+		if(InDevice == nullptr && FMyLogCoalescer::IsEnabled())
+		{
+			if((InVerbosity & ELogVerbosity::VerbosityMask) == ELogVerbosity::Fatal)
+			{
+				// Summaries of the duplicates must be written before the crash
+				FMyLogCoalescer::Flush();
+			}
+			else if( ! FMyLogCoalescer::Add(InSite, InCategory, InVerbosity, InMessage, bInToSinks) )
+			{
+				return;
+			}
+		}
+		EmitUncoalesced(InSite, InCategory, InVerbosity, InMessage, bInToSinks, InDevice);
+#endif // !NO_LOGGING
+	}
+
+	void EmitUncoalesced(const FMyLogCallSite& InSite, const FLogCategoryBase& InCategory, ELogVerbosity::Type const InVerbosity, const TCHAR* const InMessage, bool const bInToSinks, FOutputDevice* const InDevice)
+	{
+#if !NO_LOGGING
+		ELogVerbosity::Type const Verbosity = static_cast<ELogVerbosity::Type>(InVerbosity & ELogVerbosity::VerbosityMask);
+		bool const bRecording = FMyLogFlightRecorder::IsEnabled();
+		if(bRecording)
+		{
+			FMyLogFlightRecorder::Record(InCategory, InVerbosity, InMessage);
+		}
+
+		if(Verbosity == ELogVerbosity::Fatal)
+		{
+			// Lines written before must NOT be lost
+			FMyLogAsyncSink::FlushIfStarted();
+			if(bRecording)
+			{
+				FMyLogFlightRecorder::DumpOnCrash();
+			}
+			// Logs the line and asserts (the same as UE_LOG does)
+			FMsg::Logf(InSite.File, InSite.Line, InCategory.GetCategoryName(), InVerbosity, TEXT("%s"), InMessage);
+			return;
+		}
+
+		if(bRecording && ! FMyLogFlightRecorder::ShouldWrite(InVerbosity))
+		{
+			return;
+		}
+
+		if(FMyLogStats::IsEnabled())
+		{
+			FMyLogStats::AddBytes(InSite, FCString::Strlen(InMessage));
+		}
+
+		if(InDevice)
+		{
+			InDevice->Serialize(InMessage, InVerbosity, InCategory.GetCategoryName());
+			return;
+		}
+
+		bool const bToSinks = bInToSinks || &InCategory == &MyLog;
+		if(bToSinks && FMyLogMappedSink::IsEnabled() && FMyLogMappedSink::Get().Write(InCategory, InVerbosity, InMessage) && ! FMyLogMappedSink::ShouldWriteToDevices(InVerbosity))
+		{
+			return;
+		}
+
+		if(bToSinks && FMyLogAsyncSink::IsEnabled() && FMyLogAsyncSink::Get().Push(InCategory, InVerbosity, InMessage))
+		{
+			return;
+		}
+
+		GetOutputDevice(InVerbosity)->Serialize(InMessage, InVerbosity, InCategory.GetCategoryName());
+#endif // !NO_LOGGING
+	}
+
+	FOutputDevice* GetOutputDevice(ELogVerbosity::Type const InVerbosity)
+	{
+		// The same devices as FMsg::Logf uses
+		ELogVerbosity::Type const Verbosity = static_cast<ELogVerbosity::Type>(InVerbosity & ELogVerbosity::VerbosityMask);
+		bool const bToWarnDevice = (Verbosity == ELogVerbosity::Error || Verbosity == ELogVerbosity::Warning || Verbosity == ELogVerbosity::Display);
+		return (bToWarnDevice && GWarn) ? static_cast<FOutputDevice*>(GWarn) : static_cast<FOutputDevice*>(GLog);
+	}
+
+	void EmitScopeLine(const FMyLogCallSite& InSite, const FLogCategoryBase& InCategory, ELogVerbosity::Type const InVerbosity, const FMyLogLine& InMessage, const TCHAR* const InSuffix)
+	{
+		bool const bStats = FMyLogStats::IsEnabled();
+		uint64 const StartCycles = bStats ? FPlatformTime::Cycles64() : 0;
+		FMyLogLine Line;
+		Line.Append(InSite.Prefix);
+		Line.Append(InMessage.GetData(), InMessage.Len());
+		Line.Append(InSite.Postfix);
+		Line.Append(InSuffix);
+		if(bStats)
+		{
+			FMyLogStats::AddCall(InSite, InCategory, FPlatformTime::Cycles64() - StartCycles);
+		}
+		Emit(InSite, InCategory, InVerbosity, Line.GetData());
+	}
+} // MyLog
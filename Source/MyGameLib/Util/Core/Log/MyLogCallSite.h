@@ -0,0 +1,217 @@
+#pragma once
+
+#include "MyLogStats.h"
+#include "Logging/LogMacros.h"
+#include "Misc/CString.h"
+#include "HAL/PlatformTime.h"
+#include "Containers/UnrealString.h"
+#include <atomic>
+
+class FOutputDevice;
+
+/**
+* Call site of the M_LOG* macros.
+*
+* Declared as function-local static by the macros,
+* so the metadata (and the prefix/postfix strings) are built once per call site
+* and each emitted line only references them.
+*
+* Each call site registers itself when constructed (the first time it is reached with the active verbosity)
+* and can be enabled or disabled at runtime (@see MyLog::SetSitesEnabled, MyLog.Sites.* console commands).
+* @warning: must have the static storage duration (sites are never unregistered).
+*/
+struct FMyLogCallSite
+{
+	/** __FUNCTION__ of the call site*/
+	const ANSICHAR* Function = nullptr;
+
+	/** __FILE__ of the call site*/
+	const ANSICHAR* File = nullptr;
+
+	/** __LINE__ of the call site*/
+	int32 Line = 0;
+
+	/** "Function: " (the same as M_DEBUG_LOG_PREFIX)*/
+	FString Prefix;
+
+	/** " (line: Line : File )" (the same as M_DEBUG_LOG_POSTFIX)*/
+	FString Postfix;
+
+	/** Verbosity of the lines of the call site*/
+	ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+
+	FMyLogCallSite(const ANSICHAR* InFunction, const ANSICHAR* InFile, int32 InLine, ELogVerbosity::Type InVerbosity = ELogVerbosity::Log);
+
+	FMyLogCallSite(const FMyLogCallSite&) = delete;
+	FMyLogCallSite& operator=(const FMyLogCallSite&) = delete;
+
+	/** Is the call site enabled (only a relaxed load, so disabled site costs one branch)*/
+	FORCEINLINE bool IsEnabled() const
+	{
+		return bEnabled.load(std::memory_order_relaxed);
+	}
+
+	/** @see MyLog::SetSitesEnabled*/
+	void SetEnabled(bool const bInEnabled) const
+	{
+		bEnabled.store(bInEnabled, std::memory_order_relaxed);
+	}
+
+	/** Next registered call site*/
+	const FMyLogCallSite* GetNext() const { return Next; }
+
+	/** Last registered call site (the registry is the lock-free intrusive list)*/
+	static const FMyLogCallSite* GetFirst();
+
+	/** @see FMyLogStats*/
+	FMyLogSiteCounters& GetCounters() const { return Counters; }
+
+private:
+	/** Mutable, because the call sites are declared const by the macros*/
+	mutable std::atomic<bool> bEnabled { true };
+
+	mutable FMyLogSiteCounters Counters;
+
+	const FMyLogCallSite* Next = nullptr;
+};
+
+/**
+* Text line of the fixed capacity formatted on the stack (never allocates).
+* Text that does not fit is truncated.
+*/
+class FMyLogLine
+{
+public:
+	/** Maximal number of characters including the terminating zero*/
+	static constexpr int32 CAPACITY = 1024;
+
+	FMyLogLine()
+	{
+		Buffer[0] = 0;
+	}
+
+	const TCHAR* GetData() const { return Buffer; }
+	int32 Len() const { return Length; }
+	bool IsTruncated() const { return bTruncated; }
+
+	/** Appends the given number of characters of the text*/
+	void Append(const TCHAR* InText, int32 InLen);
+
+	void Append(const FString& InText)
+	{
+		Append(*InText, InText.Len());
+	}
+
+	void Append(const TCHAR* InText)
+	{
+		Append(InText, FCString::Strlen(InText));
+	}
+
+	/**
+	* Appends the formatted text.
+	*
+	* @param InReservedLen: number of characters to keep free for the text appended later (postfix).
+	*/
+	template<typename FmtType, typename... Types>
+	void Appendf(int32 const InReservedLen, const FmtType& InFormat, Types... InArgs)
+	{
+		int32 const AvailableLen = CAPACITY - 1 - InReservedLen - Length;
+		if(AvailableLen <= 0)
+		{
+			bTruncated = true;
+			return;
+		}
+		int32 const Written = FCString::Snprintf(Buffer + Length, AvailableLen + 1, InFormat, InArgs...);
+		OnFormatted(Written, AvailableLen);
+	}
+
+private:
+	void OnFormatted(int32 InWritten, int32 InAvailableLen);
+
+	TCHAR Buffer[CAPACITY];
+	int32 Length = 0;
+	bool bTruncated = false;
+};
+
+namespace MyLog
+{
+	/**
+	* Does the wildcard (e.g. "*Movement*") match the function, the file path or the file name of the call site.
+	*/
+	bool MatchesSite(const FMyLogCallSite& InSite, const FString& InWildcard);
+
+	/**
+	* Enables or disables all the call sites matching the wildcard (@see MatchesSite).
+	* The rule is kept and applied to the call sites registered later (the last matching rule wins).
+	*
+	* @returns: number of the already registered call sites matched.
+	*/
+	int32 SetSitesEnabled(const FString& InWildcard, bool bInEnabled);
+
+	/**
+	* Removes the rule of the wildcard (@see SetSitesEnabled), so it's no longer applied to the call sites registered later.
+	* The already registered call sites keep their state.
+	*
+	* @returns: false if there's no rule of the wildcard.
+	*/
+	bool RemoveSitesRule(const FString& InWildcard);
+
+	/**
+	* Writes the ready line to the log devices (like UE_LOG does, but without formatting the line again).
+	* Fatal verbosity asserts like UE_LOG (attributed to the file and the line of the call site).
+	* Duplicate lines are coalesced when MyLog.Coalesce is on.
+	*
+	* @param bInToSinks: may the line be written by the mapped and the async sinks (always true for MyLog;
+	* the sinks keep the pointer to the category, so the category must never be destroyed).
+	* @param InDevice: device to write the line to instead of the sinks and the log devices (nullptr to write as usual).
+	*/
+	void Emit(const FMyLogCallSite& InSite, const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const TCHAR* InMessage, bool bInToSinks = false, FOutputDevice* InDevice = nullptr);
+
+	/**
+	* Emit that bypasses the coalescing of the duplicates (@see FMyLogCoalescer).
+	* The only write path of the lines: the flight recorder, the stats, the sinks and the log devices.
+	*/
+	void EmitUncoalesced(const FMyLogCallSite& InSite, const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const TCHAR* InMessage, bool bInToSinks = false, FOutputDevice* InDevice = nullptr);
+
+	/**
+	* Formats the line of the call site: Prefix + Message + Postfix.
+	*/
+	template<typename FmtType, typename... Types>
+	void FormatLine(FMyLogLine& OutLine, const FMyLogCallSite& InSite, const FmtType& InFormat, Types... InArgs)
+	{
+		OutLine.Append(InSite.Prefix);
+		OutLine.Appendf(InSite.Postfix.Len(), InFormat, InArgs...);
+		OutLine.Append(InSite.Postfix);
+	}
+
+	/**
+	* Device to write the line of the given verbosity to (GWarn for errors, warnings and display, GLog otherwise).
+	*/
+	FOutputDevice* GetOutputDevice(ELogVerbosity::Type InVerbosity);
+
+	/**
+	* Emits the line of the scoped log helper: Prefix + Message + Postfix + Suffix.
+	*/
+	void EmitScopeLine(const FMyLogCallSite& InSite, const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const FMyLogLine& InMessage, const TCHAR* InSuffix);
+
+	/**
+	* Formats the line of the call site on the stack and emits it.
+	* @note: suppression by the category is to be checked by the caller (M_LOG_IS_ACTIVE).
+	*/
+	template<typename FmtType, typename... Types>
+	void Logf(const FMyLogCallSite& InSite, const FLogCategoryBase& InCategory, ELogVerbosity::Type const InVerbosity, const FmtType& InFormat, Types... InArgs)
+	{
+		FMyLogLine Line;
+		if(FMyLogStats::IsEnabled())
+		{
+			uint64 const StartCycles = FPlatformTime::Cycles64();
+			FormatLine(Line, InSite, InFormat, InArgs...);
+			FMyLogStats::AddCall(InSite, InCategory, FPlatformTime::Cycles64() - StartCycles);
+		}
+		else
+		{
+			FormatLine(Line, InSite, InFormat, InArgs...);
+		}
+		Emit(InSite, InCategory, InVerbosity, Line.GetData());
+	}
+} // MyLog
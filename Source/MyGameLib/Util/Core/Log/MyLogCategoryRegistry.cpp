@@ -0,0 +1,110 @@
+#include "MyLogCategoryRegistry.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeRWLock.h"
+#include "Misc/OutputDevice.h"
+#include "UObject/Class.h"
+
+namespace
+{
+	struct FMyLogCategories
+	{
+		/** Lock of the maps (the categories themselves are never destroyed)*/
+		FRWLock Lock;
+
+		TMap<FName, FMyLogDynamicCategory*> ByName;
+
+		/** In the order of registration*/
+		TArray<FMyLogDynamicCategory*> All;
+	};
+
+	FMyLogCategories& GetCategories()
+	{
+		// Never destroyed: the async sink may write the lines of the categories on exit
+		static FMyLogCategories* const Categories = new FMyLogCategories();
+		return *Categories;
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const ListCommand
+	(
+		TEXT("MyLog.Categories.List"),
+		TEXT("Prints the log categories created at runtime with their verbosities (use \"Log <Name> <Verbosity>\" to change)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>&, UWorld*, FOutputDevice& InAr)
+		{
+			FMyLogCategoryRegistry::Dump(InAr);
+		})
+	);
+}
+
+FMyLogDynamicCategory::FMyLogDynamicCategory(FName const InName, ELogVerbosity::Type const InDefaultVerbosity) :
+	Category ( *InName.ToString(), InDefaultVerbosity, ELogVerbosity::All )
+{
+}
+
+void FMyLogDynamicCategory::Log(const FMyLogCallSite& InSite, ELogVerbosity::Type const InVerbosity, const TCHAR* const InText) const
+{
+	// Categories are never destroyed, so the sinks may keep the pointer
+	MyLog::Emit(InSite, Category, InVerbosity, InText, /*bInToSinks*/true, GetSink());
+}
+
+FMyLogDynamicCategory& FMyLogCategoryRegistry::FindOrAdd(FName const InName, ELogVerbosity::Type const InDefaultVerbosity)
+{
+	checkf( ! InName.IsNone(), TEXT("Name of the category must be set in %s"), TEXT(__FUNCTION__));
+	FMyLogCategories& Categories = GetCategories();
+	{
+		FRWScopeLock const Lock { Categories.Lock, SLT_ReadOnly };
+		if(FMyLogDynamicCategory* const* const Found = Categories.ByName.Find(InName))
+		{
+			return **Found;
+		}
+	}
+
+	FRWScopeLock const Lock { Categories.Lock, SLT_Write };
+	// Could be added by the other thread while the lock was released
+	if(FMyLogDynamicCategory* const* const Found = Categories.ByName.Find(InName))
+	{
+		return **Found;
+	}
+	FMyLogDynamicCategory* const Category = new FMyLogDynamicCategory(InName, InDefaultVerbosity);
+	Categories.ByName.Add(InName, Category);
+	Categories.All.Add(Category);
+	return *Category;
+}
+
+FMyLogDynamicCategory& FMyLogCategoryRegistry::FindOrAddForClass(const UClass* const InClass, ELogVerbosity::Type const InDefaultVerbosity)
+{
+	checkf(InClass, TEXT("nullptr is invalid in %s"), TEXT(__FUNCTION__));
+	return FindOrAdd(FName(*(FString(CLASS_CATEGORY_PREFIX) + InClass->GetName())), InDefaultVerbosity);
+}
+
+FMyLogDynamicCategory* FMyLogCategoryRegistry::Find(FName const InName)
+{
+	FMyLogCategories& Categories = GetCategories();
+	FRWScopeLock const Lock { Categories.Lock, SLT_ReadOnly };
+	FMyLogDynamicCategory* const* const Found = Categories.ByName.Find(InName);
+	return Found ? *Found : nullptr;
+}
+
+int32 FMyLogCategoryRegistry::Num()
+{
+	FMyLogCategories& Categories = GetCategories();
+	FRWScopeLock const Lock { Categories.Lock, SLT_ReadOnly };
+	return Categories.All.Num();
+}
+
+TArray<FMyLogDynamicCategory*> FMyLogCategoryRegistry::GetAll()
+{
+	FMyLogCategories& Categories = GetCategories();
+	FRWScopeLock const Lock { Categories.Lock, SLT_ReadOnly };
+	return Categories.All;
+}
+
+void FMyLogCategoryRegistry::Dump(FOutputDevice& InAr)
+{
+	TArray<FMyLogDynamicCategory*> const Categories = GetAll();
+	InAr.Logf(TEXT("%d log categories created at runtime"), Categories.Num());
+	for(const FMyLogDynamicCategory* const Category : Categories)
+	{
+		InAr.Logf(TEXT("%s: %s%s"), *Category->GetName().ToString(), ::ToString(Category->GetVerbosity()), Category->GetSink() ? TEXT(" (own sink)") : TEXT(""));
+	}
+}
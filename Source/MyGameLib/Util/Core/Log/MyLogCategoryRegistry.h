@@ -0,0 +1,143 @@
+#pragma once
+
+#include "Util/Core/MyDebugMacros.h"
+#include "Logging/LogMacros.h"
+#include <atomic>
+
+class FOutputDevice;
+class UClass;
+
+/**
+* Log category created at runtime (e.g. per subsystem or per actor class).
+*
+* The category is the usual FLogCategoryBase (associated with the log suppression, so "Log <Name> <Verbosity>" works),
+* so the verbosity gate is the same inline check UE_LOG does (@see IsActive).
+* The line is written directly to the sink of the category (@see SetSink) or as the M_LOG* lines are written
+* (@see MyLog::Emit, including the mapped and the async sinks): no formatting is repeated and no switch by the verbosity.
+*
+* @warning: categories are never destroyed (the lines of the async sink keep the pointer to the category).
+* @see FMyLogCategoryRegistry
+*/
+class FMyLogDynamicCategory
+{
+public:
+	FMyLogDynamicCategory(FName InName, ELogVerbosity::Type InDefaultVerbosity);
+
+	FMyLogDynamicCategory(const FMyLogDynamicCategory&) = delete;
+	FMyLogDynamicCategory& operator=(const FMyLogDynamicCategory&) = delete;
+
+	/** Would the line of the given verbosity be written (the same check as UE_LOG does at runtime)*/
+	FORCEINLINE bool IsActive(ELogVerbosity::Type const InVerbosity) const
+	{
+		return ! Category.IsSuppressed(InVerbosity);
+	}
+
+	/**
+	* Writes the ready line.
+	* Fatal verbosity asserts like UE_LOG (attributed to the call site).
+	* @param InSite: call site of the line (the stats, the coalescing and the fatal assert are by the call site).
+	* @note: suppression is to be checked by the caller (IsActive, M_LOG_DYN).
+	*/
+	void Log(const FMyLogCallSite& InSite, ELogVerbosity::Type InVerbosity, const TCHAR* InText) const;
+
+	/**
+	* Formats the line on the stack (@see FMyLogLine) and writes it.
+	* @note: suppression is to be checked by the caller (IsActive, M_LOG_DYN).
+	*/
+	template<typename FmtType, typename... Types>
+	void Logf(const FMyLogCallSite& InSite, ELogVerbosity::Type const InVerbosity, const FmtType& InFormat, Types... InArgs) const
+	{
+		FMyLogLine Line;
+		if(FMyLogStats::IsEnabled())
+		{
+			uint64 const StartCycles = FPlatformTime::Cycles64();
+			Line.Appendf(0, InFormat, InArgs...);
+			FMyLogStats::AddCall(InSite, Category, FPlatformTime::Cycles64() - StartCycles);
+		}
+		else
+		{
+			Line.Appendf(0, InFormat, InArgs...);
+		}
+		Log(InSite, InVerbosity, Line.GetData());
+	}
+
+	/**
+	* Sets the device all the lines of the category are written to (nullptr to write as the other categories do).
+	* @warning: the device must outlive the category or be reset before destroyed.
+	*/
+	void SetSink(FOutputDevice* const InSink)
+	{
+		Sink.store(InSink, std::memory_order_release);
+	}
+
+	FOutputDevice* GetSink() const { return Sink.load(std::memory_order_acquire); }
+
+	const FLogCategoryBase& GetCategory() const { return Category; }
+	FName GetName() const { return Category.GetCategoryName(); }
+	ELogVerbosity::Type GetVerbosity() const { return Category.GetVerbosity(); }
+
+	/** Sets the runtime verbosity of the category (the same as "Log <Name> <Verbosity>")*/
+	void SetVerbosity(ELogVerbosity::Type const InVerbosity) { Category.SetVerbosity(InVerbosity); }
+
+private:
+	FLogCategoryBase Category;
+
+	std::atomic<FOutputDevice*> Sink { nullptr };
+};
+
+/**
+* Registry of the log categories created at runtime.
+*
+* Lookup takes the lock, so the callers are expected to keep the returned reference
+* (e.g. as the function-local static or the member), the logging itself does NOT touch the registry.
+* Registered categories are listed by MyLog.Categories.List.
+*/
+class FMyLogCategoryRegistry
+{
+public:
+	/** Prefix of the names of the categories of the classes*/
+	static constexpr const TCHAR* CLASS_CATEGORY_PREFIX = TEXT("MyLog_");
+
+	/**
+	* Returns the category of the given name, creates it on the first call.
+	* @param InDefaultVerbosity: verbosity of the created category (ignored if the category already exists).
+	*/
+	static FMyLogDynamicCategory& FindOrAdd(FName InName, ELogVerbosity::Type InDefaultVerbosity = ELogVerbosity::Log);
+
+	/** Category of the class: MyLog_<ClassName> (@see FindOrAdd)*/
+	static FMyLogDynamicCategory& FindOrAddForClass(const UClass* InClass, ELogVerbosity::Type InDefaultVerbosity = ELogVerbosity::Log);
+
+	/** @returns: nullptr if NOT registered*/
+	static FMyLogDynamicCategory* Find(FName InName);
+
+	/** Number of the registered categories*/
+	static int32 Num();
+
+	/** All the registered categories in the order of registration*/
+	static TArray<FMyLogDynamicCategory*> GetAll();
+
+	/** Prints the registered categories with their verbosities*/
+	static void Dump(FOutputDevice& InAr);
+};
+
+/**
+* Logs into the dynamic category (@see FMyLogDynamicCategory):
+* the line is formatted only if the verbosity is compiled in and NOT suppressed by the category.
+*
+* Example: M_LOG_DYN(FMyLogCategoryRegistry::FindOrAddForClass(GetClass()), Verbose, TEXT("Speed: %f"), Speed);
+*/
+#define M_LOG_DYN(DynamicCategory, LogLevel, FormatString, ...)\
+{\
+	if(M_LOG_IS_COMPILED_IN(LogLevel))\
+	{\
+		const FMyLogDynamicCategory& MyLogDynamicCategory = (DynamicCategory);\
+		if(MyLogDynamicCategory.IsActive(ELogVerbosity::LogLevel))\
+		{\
+			M_DECLARE_LOG_CALL_SITE_LEVEL(MyLogCallSite, LogLevel);\
+			if(MyLogCallSite.IsEnabled())\
+			{\
+				MyLogDynamicCategory.Logf(MyLogCallSite, ELogVerbosity::LogLevel, FormatString, ##__VA_ARGS__);\
+			}\
+		}\
+	}\
+}
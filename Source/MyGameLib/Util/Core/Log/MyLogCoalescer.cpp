@@ -0,0 +1,167 @@
+#include "MyLogCoalescer.h"
+#include "MyLogCallSite.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarMyLogCoalesce
+	(
+		TEXT("MyLog.Coalesce"),
+		0,
+		TEXT("Write the consecutive identical MyLog lines of the call site once, followed by the summary with the repeat count (0 - off, 1 - on)"),
+		ECVF_Default
+	);
+
+	/**
+	* Last line of the thread and its duplicates (never destroyed, reused by the threads started later).
+	*/
+	struct FMyLogCoalescerThreadState
+	{
+		/** Guards everything below (only contended by Flush)*/
+		FCriticalSection CriticalSection;
+
+		const FMyLogCallSite* Site = nullptr;
+		const FLogCategoryBase* Category = nullptr;
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+		bool bToSinks = false;
+		FMyLogLine Line;
+
+		/** Number of the duplicates NOT written*/
+		uint32 NumRepeats = 0;
+
+		/** Time of the written line and of the last duplicate*/
+		uint64 FirstCycles = 0;
+		uint64 LastCycles = 0;
+
+		std::atomic<bool> bOwned { true };
+
+		bool IsDuplicate(const FMyLogCallSite& InSite, const TCHAR* const InMessage, int32 const InLen) const
+		{
+			return Site == &InSite
+				&& Line.Len() == InLen
+				&& FMemory::Memcmp(Line.GetData(), InMessage, InLen * sizeof(TCHAR)) == 0;
+		}
+
+		/** Writes the summary of the duplicates (if any) and forgets the line*/
+		void FlushLocked()
+		{
+			if(NumRepeats > 0)
+			{
+				double const SpanMs = static_cast<double>(LastCycles - FirstCycles) * FPlatformTime::GetSecondsPerCycle64() * 1000.0;
+				FMyLogLine Summary;
+				Summary.Append(Line.GetData(), Line.Len());
+				Summary.Appendf(0, TEXT(" [repeated %u times over %.3f ms]"), NumRepeats, SpanMs);
+				MyLog::EmitUncoalesced(*Site, *Category, Verbosity, Summary.GetData(), bToSinks);
+			}
+			Site = nullptr;
+			NumRepeats = 0;
+		}
+	};
+
+	FCriticalSection& GetThreadStatesCriticalSection()
+	{
+		static FCriticalSection CriticalSection;
+		return CriticalSection;
+	}
+
+	/** @note: guarded by GetThreadStatesCriticalSection*/
+	TArray<FMyLogCoalescerThreadState*>& GetThreadStates()
+	{
+		static TArray<FMyLogCoalescerThreadState*> States;
+		return States;
+	}
+
+	/**
+	* Releases the state of the thread when the thread exits (the pending summary is written by the next Flush).
+	*/
+	struct FMyLogCoalescerThreadStateOwner
+	{
+		FMyLogCoalescerThreadState* State = nullptr;
+
+		~FMyLogCoalescerThreadStateOwner()
+		{
+			if(State)
+			{
+				State->bOwned.store(false, std::memory_order_release);
+			}
+		}
+	};
+
+	thread_local FMyLogCoalescerThreadStateOwner GThreadStateOwner;
+
+	FMyLogCoalescerThreadState& GetThreadState()
+	{
+		if(GThreadStateOwner.State)
+		{
+			return *GThreadStateOwner.State;
+		}
+
+		FScopeLock const Lock { &GetThreadStatesCriticalSection() };
+		TArray<FMyLogCoalescerThreadState*>& States = GetThreadStates();
+		if(States.Num() == 0)
+		{
+			// Runs of duplicates are ended at least once per frame
+			FCoreDelegates::OnEndFrame.AddStatic(&FMyLogCoalescer::Flush);
+			FCoreDelegates::OnExit.AddStatic(&FMyLogCoalescer::Flush);
+		}
+		for(FMyLogCoalescerThreadState* const State : States)
+		{
+			bool bExpectedOwned = false;
+			if(State->bOwned.compare_exchange_strong(bExpectedOwned, true, std::memory_order_acquire))
+			{
+				GThreadStateOwner.State = State;
+				return *State;
+			}
+		}
+		FMyLogCoalescerThreadState* const NewState = new FMyLogCoalescerThreadState();
+		States.Add(NewState);
+		GThreadStateOwner.State = NewState;
+		return *NewState;
+	}
+}
+
+bool FMyLogCoalescer::IsEnabled()
+{
+	return CVarMyLogCoalesce.GetValueOnAnyThread() != 0;
+}
+
+bool FMyLogCoalescer::Add(const FMyLogCallSite& InSite, const FLogCategoryBase& InCategory, ELogVerbosity::Type const InVerbosity, const TCHAR* const InMessage, bool const bInToSinks)
+{
+	FMyLogCoalescerThreadState& State = GetThreadState();
+	int32 const Len = FCString::Strlen(InMessage);
+	uint64 const Cycles = FPlatformTime::Cycles64();
+
+	FScopeLock const Lock { &State.CriticalSection };
+	if(State.IsDuplicate(InSite, InMessage, Len))
+	{
+		++State.NumRepeats;
+		State.LastCycles = Cycles;
+		return false;
+	}
+
+	State.FlushLocked();
+	State.Site = &InSite;
+	State.Category = &InCategory;
+	State.Verbosity = InVerbosity;
+	State.bToSinks = bInToSinks;
+	State.Line = FMyLogLine();
+	State.Line.Append(InMessage, Len);
+	State.FirstCycles = Cycles;
+	State.LastCycles = Cycles;
+	return true;
+}
+
+void FMyLogCoalescer::Flush()
+{
+	FScopeLock const Lock { &GetThreadStatesCriticalSection() };
+	for(FMyLogCoalescerThreadState* const State : GetThreadStates())
+	{
+		FScopeLock const StateLock { &State->CriticalSection };
+		State->FlushLocked();
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMyLogCallSite;
+
+/**
+* Coalescing of the duplicate lines of MyLog.
+*
+* When enabled by MyLog.Coalesce, the line emitted by the same call site with the same text
+* as the previous line of the thread is NOT written; instead, when the run of duplicates ends
+* (a different line of the thread, the end of the frame, the fatal line or the exit)
+* one summary line is written: "<Line> [repeated N times over T ms]".
+*
+* Each thread has its own state: the lock of the state is only contended by Flush.
+*/
+class FMyLogCoalescer
+{
+public:
+	/** Is coalescing enabled by the console variable*/
+	static bool IsEnabled();
+
+	/**
+	* Registers the line in the state of the calling thread
+	* (the summary of the previous run of duplicates is written if the line differs).
+	*
+	* @param bInToSinks: @see MyLog::Emit (the summary is written the same way).
+	* @returns: false if the line is the duplicate (it must NOT be written).
+	*/
+	static bool Add(const FMyLogCallSite& InSite, const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const TCHAR* InMessage, bool bInToSinks = false);
+
+	/** Writes the summaries of the pending duplicates of all threads*/
+	static void Flush();
+};
@@ -0,0 +1,259 @@
+#include "MyLogFlightRecorder.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/App.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/Paths.h"
+#include <atomic>
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarMyLogFlightRecorder
+	(
+		TEXT("MyLog.FlightRecorder"),
+		0,
+		TEXT("Record the last MyLog lines in memory to dump them on crash, ensure or MyLog.FlightRecorder.Dump (0 - off, 1 - record and write, 2 - record only: only warnings and errors are written)"),
+		ECVF_Default
+	);
+
+	TAutoConsoleVariable<int32> CVarMyLogFlightRecorderCapacity
+	(
+		TEXT("MyLog.FlightRecorder.Capacity"),
+		4096,
+		TEXT("Number of lines in the flight recorder ring (read once, when the first line is recorded)"),
+		ECVF_Default
+	);
+
+	/** Recording mode (@see MyLog.FlightRecorder)*/
+	enum class EMyLogFlightRecorderMode : int32
+	{
+		Off = 0,
+		RecordAndWrite,
+		RecordOnly
+	};
+
+	/**
+	* Recorded line.
+	*/
+	struct FMyLogFlightRecord
+	{
+		/** Index of the line + 1 when written, zero while writing*/
+		std::atomic<uint64> Sequence { 0 };
+
+		uint64 Cycles = 0;
+		const FLogCategoryBase* Category = nullptr;
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+		uint32 ThreadId = 0;
+		TCHAR Text[FMyLogFlightRecorder::TEXT_CAPACITY];
+	};
+
+	/**
+	* Ring of the recorded lines (never destroyed, so it's valid on the crash paths).
+	*/
+	struct FMyLogFlightRing
+	{
+		TArray<FMyLogFlightRecord> Records;
+		uint64 Mask = 0;
+
+		/** Index of the next line to write*/
+		std::atomic<uint64> NextIndex { 0 };
+
+		/** Time of the creation (to convert the cycles of the lines to the date time)*/
+		FDateTime StartTime;
+		uint64 StartCycles = 0;
+
+		explicit FMyLogFlightRing(uint32 const InCapacity)
+		{
+			uint32 const Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 2U));
+			Records.SetNum(Capacity);
+			Mask = Capacity - 1;
+			StartTime = FDateTime::Now();
+			StartCycles = FPlatformTime::Cycles64();
+		}
+	};
+
+	std::atomic<FMyLogFlightRing*> GRing { nullptr };
+
+	/** Set by the first crash dump*/
+	std::atomic<bool> GCrashDumped { false };
+
+	/** Number of the default dump file names generated*/
+	std::atomic<uint32> GDumpSequence { 0 };
+
+	FMyLogFlightRing& GetOrCreateRing()
+	{
+		static FMyLogFlightRing* const Ring = []()
+		{
+			FMyLogFlightRing* const NewRing = new FMyLogFlightRing(static_cast<uint32>(FMath::Max(CVarMyLogFlightRecorderCapacity.GetValueOnAnyThread(), 2)));
+			GRing.store(NewRing, std::memory_order_release);
+			FCoreDelegates::OnHandleSystemError.AddStatic(&FMyLogFlightRecorder::DumpOnCrash);
+			FCoreDelegates::OnHandleSystemEnsure.AddStatic(&FMyLogFlightRecorder::DumpOnEnsure);
+			return NewRing;
+		}();
+		return *Ring;
+	}
+
+	EMyLogFlightRecorderMode GetMode()
+	{
+		return static_cast<EMyLogFlightRecorderMode>(CVarMyLogFlightRecorder.GetValueOnAnyThread());
+	}
+
+	void DumpCommand(const TArray<FString>& InArgs, FOutputDevice& InAr)
+	{
+		if(FMyLogFlightRecorder::GetCapacity() == 0)
+		{
+			InAr.Logf(TEXT("No lines are recorded (enable MyLog.FlightRecorder)"));
+			return;
+		}
+		FString const Filename = (InArgs.Num() > 0) ? InArgs[0] : FMyLogFlightRecorder::GetDefaultDumpFilename();
+		if( ! FMyLogFlightRecorder::Dump(Filename) )
+		{
+			InAr.Logf(ELogVerbosity::Error, TEXT("Failed to write MyLog flight recorder to \"%s\""), *Filename);
+			return;
+		}
+		InAr.Logf(TEXT("MyLog flight recorder written to \"%s\""), *Filename);
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const DumpFlightRecorderCommand
+	(
+		TEXT("MyLog.FlightRecorder.Dump"),
+		TEXT("Writes the lines recorded by MyLog flight recorder to the given file (or <ProjectLogDir>/<ProjectName>-FlightRecorder-<DateTime>.log)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			DumpCommand(InArgs, InAr);
+		})
+	);
+}
+
+bool FMyLogFlightRecorder::IsEnabled()
+{
+	return GetMode() != EMyLogFlightRecorderMode::Off;
+}
+
+bool FMyLogFlightRecorder::ShouldWrite(ELogVerbosity::Type const InVerbosity)
+{
+	if(GetMode() != EMyLogFlightRecorderMode::RecordOnly)
+	{
+		return true;
+	}
+	return (InVerbosity & ELogVerbosity::VerbosityMask) <= ELogVerbosity::Warning;
+}
+
+void FMyLogFlightRecorder::Record(const FLogCategoryBase& InCategory, ELogVerbosity::Type const InVerbosity, const TCHAR* const InText)
+{
+	FMyLogFlightRing& Ring = GetOrCreateRing();
+	uint64 const Index = Ring.NextIndex.fetch_add(1, std::memory_order_relaxed);
+	FMyLogFlightRecord& Record = Ring.Records[Index & Ring.Mask];
+
+	// Readers skip the record until the sequence is set again
+	Record.Sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	Record.Cycles = FPlatformTime::Cycles64();
+	Record.Category = &InCategory;
+	Record.Verbosity = InVerbosity;
+	Record.ThreadId = FPlatformTLS::GetCurrentThreadId();
+	int32 const CopyLen = FMath::Min(FCString::Strlen(InText), TEXT_CAPACITY - 1);
+	FMemory::Memcpy(Record.Text, InText, CopyLen * sizeof(TCHAR));
+	Record.Text[CopyLen] = 0;
+
+	Record.Sequence.store(Index + 1, std::memory_order_release);
+}
+
+TArray<FString> FMyLogFlightRecorder::GetLines()
+{
+	TArray<FString> Lines;
+	FMyLogFlightRing* const Ring = GRing.load(std::memory_order_acquire);
+	if(Ring == nullptr)
+	{
+		return Lines;
+	}
+
+	uint64 const EndIndex = Ring->NextIndex.load(std::memory_order_acquire);
+	uint64 const Capacity = Ring->Mask + 1;
+	uint64 const StartIndex = (EndIndex > Capacity) ? (EndIndex - Capacity) : 0;
+	double const SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+	Lines.Reserve(static_cast<int32>(EndIndex - StartIndex));
+
+	FMyLogFlightRecord Copy;
+	for(uint64 Index = StartIndex; Index < EndIndex; ++Index)
+	{
+		const FMyLogFlightRecord& Record = Ring->Records[Index & Ring->Mask];
+		uint64 const Sequence = Record.Sequence.load(std::memory_order_acquire);
+		if(Sequence != Index + 1)
+		{
+			continue;
+		}
+		Copy.Cycles = Record.Cycles;
+		Copy.Category = Record.Category;
+		Copy.Verbosity = Record.Verbosity;
+		Copy.ThreadId = Record.ThreadId;
+		FMemory::Memcpy(Copy.Text, Record.Text, sizeof(Copy.Text));
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if(Record.Sequence.load(std::memory_order_relaxed) != Sequence)
+		{
+			// Overwritten while copying
+			continue;
+		}
+		Copy.Text[TEXT_CAPACITY - 1] = 0;
+
+		FDateTime const Time = Ring->StartTime + FTimespan::FromSeconds(static_cast<double>(Copy.Cycles - Ring->StartCycles) * SecondsPerCycle);
+		// The same layout as the text log: "Category: Verbosity: Message" (verbosity is omitted for Log)
+		ELogVerbosity::Type const Verbosity = static_cast<ELogVerbosity::Type>(Copy.Verbosity & ELogVerbosity::VerbosityMask);
+		if(Verbosity == ELogVerbosity::Log)
+		{
+			Lines.Add(FString::Printf(TEXT("[%s][%u] %s: %s"), *Time.ToString(TEXT("%Y.%m.%d-%H.%M.%S:%s")), Copy.ThreadId, *Copy.Category->GetCategoryName().ToString(), Copy.Text));
+		}
+		else
+		{
+			Lines.Add(FString::Printf(TEXT("[%s][%u] %s: %s: %s"), *Time.ToString(TEXT("%Y.%m.%d-%H.%M.%S:%s")), Copy.ThreadId, *Copy.Category->GetCategoryName().ToString(), ::ToString(Verbosity), Copy.Text));
+		}
+	}
+	return Lines;
+}
+
+int32 FMyLogFlightRecorder::GetCapacity()
+{
+	FMyLogFlightRing* const Ring = GRing.load(std::memory_order_acquire);
+	return Ring ? static_cast<int32>(Ring->Mask + 1) : 0;
+}
+
+bool FMyLogFlightRecorder::Dump(const FString& InFilename)
+{
+	TArray<FString> const Lines = GetLines();
+	if(Lines.Num() == 0)
+	{
+		return false;
+	}
+	return FFileHelper::SaveStringArrayToFile(Lines, *InFilename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+FString FMyLogFlightRecorder::GetDefaultDumpFilename()
+{
+	uint32 const Sequence = GDumpSequence.fetch_add(1, std::memory_order_relaxed);
+	FString const DateTime = FDateTime::Now().ToString(TEXT("%Y.%m.%d-%H.%M.%S-%s"));
+	return FPaths::Combine(FPaths::ProjectLogDir(), FString::Printf(TEXT("%s-FlightRecorder-%s-%u.log"), FApp::GetProjectName(), *DateTime, Sequence));
+}
+
+void FMyLogFlightRecorder::DumpOnCrash()
+{
+	if(GRing.load(std::memory_order_acquire) == nullptr || GCrashDumped.exchange(true))
+	{
+		return;
+	}
+	Dump(GetDefaultDumpFilename());
+}
+
+void FMyLogFlightRecorder::DumpOnEnsure()
+{
+	if(GRing.load(std::memory_order_acquire) == nullptr)
+	{
+		return;
+	}
+	Dump(GetDefaultDumpFilename());
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+* Flight recorder of MyLog: fixed-size in-memory ring of the last emitted lines.
+*
+* When enabled by MyLog.FlightRecorder, each line emitted by the M_LOG* macros (@see MyLog::Emit)
+* is copied (preformatted) into the ring; the oldest lines are overwritten.
+* The ring is written to disk only on the system error (crash, fatal), ensure or by MyLog.FlightRecorder.Dump,
+* so in the record-only mode verbose call sites may stay enabled without the I/O cost.
+*
+* Writers never lock: each record is claimed by the atomic counter and validated by its sequence number when read.
+*/
+class FMyLogFlightRecorder
+{
+public:
+	/** Maximal number of characters of the recorded line including the terminating zero (longer lines are truncated)*/
+	static constexpr int32 TEXT_CAPACITY = 512;
+
+	/** Is recording enabled by the console variable*/
+	static bool IsEnabled();
+
+	/**
+	* Should the line also be written to the log devices (lines below warning are only recorded in the record-only mode).
+	*/
+	static bool ShouldWrite(ELogVerbosity::Type InVerbosity);
+
+	/**
+	* Copies the line into the ring (the ring is created by the first call).
+	*/
+	static void Record(const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const TCHAR* InText);
+
+	/**
+	* Formats the recorded lines from the oldest to the newest.
+	* Lines being overwritten while reading are skipped.
+	*/
+	static TArray<FString> GetLines();
+
+	/** Number of lines the ring holds (zero if no lines recorded yet)*/
+	static int32 GetCapacity();
+
+	/**
+	* Writes the recorded lines to the file.
+	* @returns: false if no lines recorded or failed to write.
+	*/
+	static bool Dump(const FString& InFilename);
+
+	/**
+	* <ProjectLogDir>/<ProjectName>-FlightRecorder-<DateTime with milliseconds>-<Sequence>.log
+	* (the sequence number keeps the dumps of the same millisecond, e.g. of several ensures, apart).
+	*/
+	static FString GetDefaultDumpFilename();
+
+	/**
+	* Dumps to the default file if any lines are recorded (only the first call dumps).
+	* Called on the system error and by the fatal line.
+	*/
+	static void DumpOnCrash();
+
+	/** Dumps to the default file if any lines are recorded (called on each ensure)*/
+	static void DumpOnEnsure();
+};
@@ -0,0 +1,142 @@
+#include "MyLogKV.h"
+#include "Util/Core/LogUtilLib.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Math/UnrealMathUtility.h"
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarMyLogKVJson
+	(
+		TEXT("MyLog.KV.Json"),
+		0,
+		TEXT("Write M_LOGKV lines (and the ULogUtilLib::Log* values) as JSON objects instead of the text (0 - text, 1 - JSON lines)"),
+		ECVF_Default
+	);
+
+	const TCHAR* const KEY_BINARY_FORMAT = TEXT("%s : ");
+	const TCHAR* const PAIR_SEPARATOR = TEXT(", ");
+}
+
+namespace MyLogKV
+{
+	bool IsJsonEnabled()
+	{
+		return CVarMyLogKVJson.GetValueOnAnyThread() != 0;
+	}
+
+	FString BuildBinaryFormat(const TCHAR* const* const InArgFormats, int32 const InNumArgs)
+	{
+		FString Format;
+		for(int32 ValueIndex = 1; ValueIndex < InNumArgs; ValueIndex += 2)
+		{
+			if(ValueIndex > 1)
+			{
+				Format += PAIR_SEPARATOR;
+			}
+			Format += KEY_BINARY_FORMAT;
+			Format += InArgFormats[ValueIndex];
+		}
+		return Format;
+	}
+
+	void AppendQuoted(FMyLogLine& OutLine, const TCHAR* const InText, int32 const InLen)
+	{
+		OutLine.Append(TEXT("\""), 1);
+		OutLine.Append(InText, InLen);
+		OutLine.Append(TEXT("\""), 1);
+	}
+
+	void AppendJsonString(FMyLogLine& OutLine, const TCHAR* const InText, int32 const InLen)
+	{
+		OutLine.Append(TEXT("\""), 1);
+		int32 RunStart = 0;
+		for(int32 CharIndex = 0; CharIndex < InLen; ++CharIndex)
+		{
+			TCHAR const Char = InText[CharIndex];
+			if(Char != TEXT('"') && Char != TEXT('\\') && Char >= 0x20)
+			{
+				continue;
+			}
+			// Characters that need no escaping are appended as one run
+			OutLine.Append(InText + RunStart, CharIndex - RunStart);
+			RunStart = CharIndex + 1;
+			switch(Char)
+			{
+			case TEXT('"'):
+				OutLine.Append(TEXT("\\\""), 2);
+				break;
+
+			case TEXT('\\'):
+				OutLine.Append(TEXT("\\\\"), 2);
+				break;
+
+			default:
+				OutLine.Appendf(0, TEXT("\\u%04x"), static_cast<uint32>(Char));
+				break;
+			}
+		}
+		OutLine.Append(InText + RunStart, InLen - RunStart);
+		OutLine.Append(TEXT("\""), 1);
+	}
+
+	void AppendFloat(FMyLogLine& OutLine, float const InValue, int32 const InPrecision)
+	{
+		TCHAR Buffer[MyFloatFormat::MAX_FLOAT_LEN + 1];
+		int32 const Len = MyFloatFormat::Format(Buffer, InValue, InPrecision);
+		OutLine.Append(Buffer, Len);
+	}
+
+	void AppendJsonFloat(FMyLogLine& OutLine, float const InValue)
+	{
+		if( ! FMath::IsFinite(InValue) )
+		{
+			// JSON has no NaN and infinity
+			OutLine.Append(TEXT("null"), 4);
+			return;
+		}
+		AppendFloat(OutLine, InValue, MyFloatFormat::SHORTEST);
+	}
+
+	void AppendJsonDouble(FMyLogLine& OutLine, double const InValue)
+	{
+		if( ! FMath::IsFinite(InValue) )
+		{
+			OutLine.Append(TEXT("null"), 4);
+			return;
+		}
+		OutLine.Appendf(0, TEXT("%.17g"), InValue);
+	}
+
+	void AppendName(FMyLogLine& OutLine, const FName& InName, bool const bInJson)
+	{
+		// The buffer of the thread is reused: no string is allocated per name
+		static thread_local FString Text;
+		Text.Reset();
+		InName.AppendString(Text);
+		if(bInJson)
+		{
+			AppendJsonString(OutLine, *Text, Text.Len());
+		}
+		else
+		{
+			AppendQuoted(OutLine, *Text, Text.Len());
+		}
+	}
+
+	void AppendObject(FMyLogLine& OutLine, const UObject* const InObject, bool const bInJson)
+	{
+		// Not the scratch string of ULogUtilLib: the caller may be logging it
+		static thread_local FString Text;
+		Text.Reset();
+		ULogUtilLib::AppendNameAndClassScoped(Text, InObject);
+		if(bInJson)
+		{
+			AppendJsonString(OutLine, *Text, Text.Len());
+		}
+		else
+		{
+			OutLine.Append(Text);
+		}
+	}
+} // MyLogKV
@@ -0,0 +1,373 @@
+#pragma once
+
+/**
+* Typed key-value logging: M_LOGKV(TEXT("Key1"), Value1, TEXT("Key2"), Value2, ...).
+*
+* Types of the arguments are checked at compile time (keys must be TCHAR strings, values must have TMyLogKVValue specialized),
+* each pair is written directly into the line on the stack in the active format (NO intermediate strings):
+* - text: "Key1 : Value1, Key2 : Value2" (the same as ULogUtilLib::Log* functions print);
+* - JSON lines: {"function":"...","line":N,"Key1":Value1,"Key2":Value2} (when MyLog.KV.Json is on);
+* - binary: the record of MyBinaryLog (when MyLog.Binary is on), the descriptor of the record is built once per call site.
+*
+* Supported values: bool, int32, uint32, int64, float, double, TCHAR strings, FString, FName, FText, FVector, FRotator
+* and pointers to UObject-derived classes (name and class).
+*/
+
+#include "MyBinaryLog.h"
+#include "Templates/Decay.h"
+#include "Internationalization/Text.h"
+#include <type_traits>
+
+class UObject;
+
+namespace MyLogKV
+{
+	/** Is the JSON lines format enabled by the console variable*/
+	bool IsJsonEnabled();
+
+	/** Joins the formats of the values (every second argument format), the keys are written as %s*/
+	FString BuildBinaryFormat(const TCHAR* const* InArgFormats, int32 InNumArgs);
+
+	// ~Value writers (used by TMyLogKVValue) Begin
+	void AppendQuoted(FMyLogLine& OutLine, const TCHAR* InText, int32 InLen);
+	void AppendJsonString(FMyLogLine& OutLine, const TCHAR* InText, int32 InLen);
+	void AppendFloat(FMyLogLine& OutLine, float InValue, int32 InPrecision);
+	void AppendJsonFloat(FMyLogLine& OutLine, float InValue);
+	void AppendJsonDouble(FMyLogLine& OutLine, double InValue);
+	void AppendName(FMyLogLine& OutLine, const FName& InName, bool bInJson);
+	void AppendObject(FMyLogLine& OutLine, const UObject* InObject, bool bInJson);
+	// ~Value writers End
+} // MyLogKV
+
+/**
+* Serialization of the value type (undefined for unsupported types - static_assert of M_LOGKV).
+*
+* Each specialization provides:
+* - AppendText, AppendJson: write the value to the line;
+* - GetBinaryFormat: format specifier of the value in the binary log descriptor;
+* - ToBinaryArg: the value passed to FMyBinaryLogWriter (must have TMyBinaryLogArg).
+*/
+template<class T>
+struct TMyLogKVValue
+{
+	static constexpr bool bSupported = false;
+};
+
+template<>
+struct TMyLogKVValue<bool>
+{
+	static constexpr bool bSupported = true;
+	/** @see ULogUtilLib::GetYesNo*/
+	static const TCHAR* GetYesNoText(bool const bInValue) { return bInValue ? TEXT("YES") : TEXT("no"); }
+	static void AppendText(FMyLogLine& OutLine, bool const bInValue) { OutLine.Append(GetYesNoText(bInValue)); }
+	static void AppendJson(FMyLogLine& OutLine, bool const bInValue) { OutLine.Append(bInValue ? TEXT("true") : TEXT("false")); }
+	static const TCHAR* GetBinaryFormat() { return TEXT("%s"); }
+	static const TCHAR* ToBinaryArg(bool const bInValue) { return GetYesNoText(bInValue); }
+};
+
+template<>
+struct TMyLogKVValue<int32>
+{
+	static constexpr bool bSupported = true;
+	static void AppendText(FMyLogLine& OutLine, int32 const InValue) { OutLine.Appendf(0, TEXT("%d"), InValue); }
+	static void AppendJson(FMyLogLine& OutLine, int32 const InValue) { AppendText(OutLine, InValue); }
+	static const TCHAR* GetBinaryFormat() { return TEXT("%d"); }
+	static int32 ToBinaryArg(int32 const InValue) { return InValue; }
+};
+
+template<>
+struct TMyLogKVValue<uint32>
+{
+	static constexpr bool bSupported = true;
+	static void AppendText(FMyLogLine& OutLine, uint32 const InValue) { OutLine.Appendf(0, TEXT("%u"), InValue); }
+	static void AppendJson(FMyLogLine& OutLine, uint32 const InValue) { AppendText(OutLine, InValue); }
+	static const TCHAR* GetBinaryFormat() { return TEXT("%u"); }
+	static int32 ToBinaryArg(uint32 const InValue) { return static_cast<int32>(InValue); }
+};
+
+template<>
+struct TMyLogKVValue<int64>
+{
+	static constexpr bool bSupported = true;
+	static void AppendText(FMyLogLine& OutLine, int64 const InValue) { OutLine.Appendf(0, TEXT("%lld"), InValue); }
+	static void AppendJson(FMyLogLine& OutLine, int64 const InValue) { AppendText(OutLine, InValue); }
+	static const TCHAR* GetBinaryFormat() { return TEXT("%lld"); }
+	static int64 ToBinaryArg(int64 const InValue) { return InValue; }
+};
+
+template<>
+struct TMyLogKVValue<float>
+{
+	static constexpr bool bSupported = true;
+	// %f of printf
+	static constexpr int32 TEXT_PRECISION = 6;
+	static void AppendText(FMyLogLine& OutLine, float const InValue) { MyLogKV::AppendFloat(OutLine, InValue, TEXT_PRECISION); }
+	static void AppendJson(FMyLogLine& OutLine, float const InValue) { MyLogKV::AppendJsonFloat(OutLine, InValue); }
+	static const TCHAR* GetBinaryFormat() { return TEXT("%f"); }
+	static float ToBinaryArg(float const InValue) { return InValue; }
+};
+
+template<>
+struct TMyLogKVValue<double>
+{
+	static constexpr bool bSupported = true;
+	static void AppendText(FMyLogLine& OutLine, double const InValue) { OutLine.Appendf(0, TEXT("%lf"), InValue); }
+	static void AppendJson(FMyLogLine& OutLine, double const InValue) { MyLogKV::AppendJsonDouble(OutLine, InValue); }
+	static const TCHAR* GetBinaryFormat() { return TEXT("%lf"); }
+	static double ToBinaryArg(double const InValue) { return InValue; }
+};
+
+template<>
+struct TMyLogKVValue<const TCHAR*>
+{
+	static constexpr bool bSupported = true;
+	static void AppendText(FMyLogLine& OutLine, const TCHAR* const InValue) { MyLogKV::AppendQuoted(OutLine, ToBinaryArg(InValue), FCString::Strlen(ToBinaryArg(InValue))); }
+	static void AppendJson(FMyLogLine& OutLine, const TCHAR* const InValue) { MyLogKV::AppendJsonString(OutLine, ToBinaryArg(InValue), FCString::Strlen(ToBinaryArg(InValue))); }
+	static const TCHAR* GetBinaryFormat() { return TEXT("\"%s\""); }
+	static const TCHAR* ToBinaryArg(const TCHAR* const InValue) { return InValue ? InValue : TEXT(""); }
+};
+
+template<> struct TMyLogKVValue<TCHAR*> : TMyLogKVValue<const TCHAR*> {};
+
+template<>
+struct TMyLogKVValue<FString>
+{
+	static constexpr bool bSupported = true;
+	static void AppendText(FMyLogLine& OutLine, const FString& InValue) { MyLogKV::AppendQuoted(OutLine, *InValue, InValue.Len()); }
+	static void AppendJson(FMyLogLine& OutLine, const FString& InValue) { MyLogKV::AppendJsonString(OutLine, *InValue, InValue.Len()); }
+	static const TCHAR* GetBinaryFormat() { return TEXT("\"%s\""); }
+	static const TCHAR* ToBinaryArg(const FString& InValue) { return *InValue; }
+};
+
+template<>
+struct TMyLogKVValue<FName>
+{
+	static constexpr bool bSupported = true;
+	static void AppendText(FMyLogLine& OutLine, const FName& InValue) { MyLogKV::AppendName(OutLine, InValue, /*bInJson*/false); }
+	static void AppendJson(FMyLogLine& OutLine, const FName& InValue) { MyLogKV::AppendName(OutLine, InValue, /*bInJson*/true); }
+	static const TCHAR* GetBinaryFormat() { return TEXT("\"%s\""); }
+	// Names are interned by the binary log
+	static const FName& ToBinaryArg(const FName& InValue) { return InValue; }
+};
+
+template<>
+struct TMyLogKVValue<FText>
+{
+	static constexpr bool bSupported = true;
+	static void AppendText(FMyLogLine& OutLine, const FText& InValue) { TMyLogKVValue<FString>::AppendText(OutLine, InValue.ToString()); }
+	static void AppendJson(FMyLogLine& OutLine, const FText& InValue) { TMyLogKVValue<FString>::AppendJson(OutLine, InValue.ToString()); }
+	static const TCHAR* GetBinaryFormat() { return TEXT("\"%s\""); }
+	static const TCHAR* ToBinaryArg(const FText& InValue) { return *InValue.ToString(); }
+};
+
+template<>
+struct TMyLogKVValue<FVector>
+{
+	static constexpr bool bSupported = true;
+	static void AppendText(FMyLogLine& OutLine, const FVector& InValue)
+	{
+		FMyMathText const Text = MyFloatFormat::ToText(InValue);
+		MyLogKV::AppendQuoted(OutLine, *Text, Text.Len());
+	}
+	static void AppendJson(FMyLogLine& OutLine, const FVector& InValue)
+	{
+		OutLine.Append(TEXT("["));
+		MyLogKV::AppendJsonFloat(OutLine, InValue.X);
+		OutLine.Append(TEXT(","));
+		MyLogKV::AppendJsonFloat(OutLine, InValue.Y);
+		OutLine.Append(TEXT(","));
+		MyLogKV::AppendJsonFloat(OutLine, InValue.Z);
+		OutLine.Append(TEXT("]"));
+	}
+	static const TCHAR* GetBinaryFormat() { return TEXT("\"%s\""); }
+	static const FVector& ToBinaryArg(const FVector& InValue) { return InValue; }
+};
+
+template<>
+struct TMyLogKVValue<FRotator>
+{
+	static constexpr bool bSupported = true;
+	static void AppendText(FMyLogLine& OutLine, const FRotator& InValue)
+	{
+		FMyMathText const Text = MyFloatFormat::ToText(InValue);
+		MyLogKV::AppendQuoted(OutLine, *Text, Text.Len());
+	}
+	static void AppendJson(FMyLogLine& OutLine, const FRotator& InValue) { TMyLogKVValue<FVector>::AppendJson(OutLine, FVector { InValue.Pitch, InValue.Yaw, InValue.Roll }); }
+	static const TCHAR* GetBinaryFormat() { return TEXT("\"%s\""); }
+	static const FRotator& ToBinaryArg(const FRotator& InValue) { return InValue; }
+};
+
+/** Pointers to UObject-derived classes (not supported for other pointers)*/
+template<bool bObject>
+struct TMyLogKVObjectValue
+{
+	static constexpr bool bSupported = false;
+};
+
+template<>
+struct TMyLogKVObjectValue<true>
+{
+	static constexpr bool bSupported = true;
+	static void AppendText(FMyLogLine& OutLine, const UObject* const InValue) { MyLogKV::AppendObject(OutLine, InValue, /*bInJson*/false); }
+	static void AppendJson(FMyLogLine& OutLine, const UObject* const InValue) { MyLogKV::AppendObject(OutLine, InValue, /*bInJson*/true); }
+	static const TCHAR* GetBinaryFormat() { return TEXT("%s"); }
+	// Name and class are written as the interned names by the binary log
+	static const UObject* ToBinaryArg(const UObject* const InValue) { return InValue; }
+};
+
+template<class T>
+struct TMyLogKVValue<T*> : TMyLogKVObjectValue<std::is_base_of<UObject, T>::value> {};
+
+/**
+* Argument list of M_LOGKV: checks the types and builds the binary log format.
+*/
+template<class... Types>
+struct TMyLogKVArgs
+{
+	static_assert(sizeof...(Types) > 0 && sizeof...(Types) % 2 == 0, "M_LOGKV: key-value pairs expected");
+
+	/**
+	* Format of the binary log descriptor ("%s : <Value1>, %s : <Value2>", built once).
+	*/
+	static const TCHAR* GetBinaryFormat()
+	{
+		static const TCHAR* const ArgFormats[] = { TMyLogKVValue<Types>::GetBinaryFormat()... };
+		static const FString Format = MyLogKV::BuildBinaryFormat(ArgFormats, sizeof...(Types));
+		return *Format;
+	}
+};
+
+namespace MyLogKV
+{
+	/**
+	* Declared only: the argument list type of M_LOGKV (in decltype, so the arguments are NOT evaluated).
+	*/
+	template<class... Types>
+	TMyLogKVArgs<typename TDecay<Types>::Type...> DeclareArgs(const Types&... InArgs);
+
+	inline void AppendTextPairs(FMyLogLine& /*OutLine*/)
+	{
+	}
+
+	/**
+	* Writes "Key1 : Value1, Key2 : Value2".
+	*/
+	template<class KeyT, class ValueT, class... Types>
+	void AppendTextPairs(FMyLogLine& OutLine, const KeyT& InKey, const ValueT& InValue, const Types&... InRest)
+	{
+		static_assert(std::is_convertible<const KeyT&, const TCHAR*>::value, "M_LOGKV: key must be the TCHAR string (TEXT(\"Key\"))");
+		static_assert(TMyLogKVValue<typename TDecay<ValueT>::Type>::bSupported, "M_LOGKV: unsupported value type (specialize TMyLogKVValue)");
+		OutLine.Append(static_cast<const TCHAR*>(InKey));
+		OutLine.Append(TEXT(" : "), 3);
+		TMyLogKVValue<typename TDecay<ValueT>::Type>::AppendText(OutLine, InValue);
+		if(sizeof...(Types) > 0)
+		{
+			OutLine.Append(TEXT(", "), 2);
+		}
+		AppendTextPairs(OutLine, InRest...);
+	}
+
+	inline void AppendJsonPairs(FMyLogLine& /*OutLine*/)
+	{
+	}
+
+	/**
+	* Writes ,"Key1":Value1,"Key2":Value2 (the object is opened by the caller).
+	*/
+	template<class KeyT, class ValueT, class... Types>
+	void AppendJsonPairs(FMyLogLine& OutLine, const KeyT& InKey, const ValueT& InValue, const Types&... InRest)
+	{
+		static_assert(std::is_convertible<const KeyT&, const TCHAR*>::value, "M_LOGKV: key must be the TCHAR string (TEXT(\"Key\"))");
+		static_assert(TMyLogKVValue<typename TDecay<ValueT>::Type>::bSupported, "M_LOGKV: unsupported value type (specialize TMyLogKVValue)");
+		const TCHAR* const Key = InKey;
+		OutLine.Append(TEXT(","), 1);
+		AppendJsonString(OutLine, Key, FCString::Strlen(Key));
+		OutLine.Append(TEXT(":"), 1);
+		TMyLogKVValue<typename TDecay<ValueT>::Type>::AppendJson(OutLine, InValue);
+		AppendJsonPairs(OutLine, InRest...);
+	}
+
+	/**
+	* Formats the line of the call site in the active text format (JSON lines or Prefix + pairs + Postfix).
+	*/
+	template<class... Types>
+	void FormatLine(FMyLogLine& OutLine, const FMyLogCallSite& InSite, bool const bInJson, const Types&... InArgs)
+	{
+		if(bInJson)
+		{
+			OutLine.Appendf(0, TEXT("{\"function\":\"%s\",\"line\":%d"), ANSI_TO_TCHAR(InSite.Function), InSite.Line);
+			AppendJsonPairs(OutLine, InArgs...);
+			OutLine.Append(TEXT("}"), 1);
+		}
+		else
+		{
+			OutLine.Append(InSite.Prefix);
+			AppendTextPairs(OutLine, InArgs...);
+			OutLine.Append(InSite.Postfix);
+		}
+	}
+
+	/**
+	* Writes the pairs to the active sink.
+	* @note: suppression by the category and the enabled state of the site are to be checked by the caller (M_LOGKV).
+	*/
+	template<class... Types>
+	void Log(const FMyBinaryLogFormat& InFormat, const Types&... InArgs)
+	{
+		if(MyBinaryLog::IsEnabled())
+		{
+			MyBinaryLog::GetWriter().Write(InFormat, TMyLogKVValue<typename TDecay<Types>::Type>::ToBinaryArg(InArgs)...);
+			return;
+		}
+
+		FMyLogLine Line;
+		bool const bJson = IsJsonEnabled();
+		if(FMyLogStats::IsEnabled())
+		{
+			uint64 const StartCycles = FPlatformTime::Cycles64();
+			FormatLine(Line, InFormat.Site, bJson, InArgs...);
+			FMyLogStats::AddCall(InFormat.Site, *InFormat.Category, FPlatformTime::Cycles64() - StartCycles);
+		}
+		else
+		{
+			FormatLine(Line, InFormat.Site, bJson, InArgs...);
+		}
+		MyLog::Emit(InFormat.Site, *InFormat.Category, InFormat.Verbosity, Line.GetData());
+	}
+} // MyLogKV
+
+/**
+* @note: arguments are evaluated only when the verbosity is active and the call site is enabled.
+*/
+#define M_LOGKV_CUSTOM_TO(LogCategory, LogLevel, ...)\
+{\
+	if(M_LOG_IS_ACTIVE(LogCategory, LogLevel))\
+	{\
+		static const FMyBinaryLogFormat MyLogKVFormat { __FUNCTION__, __FILE__, __LINE__, LogCategory, ELogVerbosity::LogLevel, decltype(MyLogKV::DeclareArgs(__VA_ARGS__))::GetBinaryFormat() };\
+		if(MyLogKVFormat.Site.IsEnabled())\
+		{\
+			MyLogKV::Log(MyLogKVFormat, __VA_ARGS__);\
+		}\
+	}\
+}
+
+#define M_LOGKV_CUSTOM_TO_IF(ShouldLog, LogCategory, LogLevel, ...)\
+{\
+	if(ShouldLog)\
+	{\
+		M_LOGKV_CUSTOM_TO(LogCategory, LogLevel, __VA_ARGS__);\
+	}\
+}
+
+#define M_LOGKV_CUSTOM_TO_IF_FLAGS(LogFlags, LogCategory, LogLevel, ...)\
+{\
+	if(M_LOG_IS_COMPILED_IN(LogLevel) && UMyLoggingTypes::ShouldLogVerbosity(LogFlags, ELogVerbosity::Type::LogLevel))\
+	{\
+		M_LOGKV_CUSTOM_TO(LogCategory, LogLevel, __VA_ARGS__);\
+	}\
+}
+
+#define M_LOGKV(...) M_LOGKV_CUSTOM_TO(MyLog, Log, __VA_ARGS__)
+#define M_LOGKV_IF(ShouldLog, ...) M_LOGKV_CUSTOM_TO_IF(ShouldLog, MyLog, Log, __VA_ARGS__)
+#define M_LOGKV_IF_FLAGS(LogFlags, ...) M_LOGKV_CUSTOM_TO_IF_FLAGS(LogFlags, MyLog, Log, __VA_ARGS__)
+#define M_LOGKV_WARN(...) M_LOGKV_CUSTOM_TO(MyLog, Warning, __VA_ARGS__)
@@ -0,0 +1,657 @@
+#include "MyLogMappedSink.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/FileManager.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformTime.h"
+#include "Containers/StringConv.h"
+#include "Misc/App.h"
+#include "Misc/Compression.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "CoreGlobals.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#include "Windows/WindowsHWrapper.h"
+#include "Windows/HideWindowsPlatformTypes.h"
+#elif PLATFORM_UNIX || PLATFORM_MAC
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // PLATFORM_WINDOWS
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarMyLogMappedFile
+	(
+		TEXT("MyLog.MappedFile"),
+		0,
+		TEXT("Write MyLog lines to the rotated memory-mapped files in <ProjectLogDir>/MyLog (0 - off, 1 - on: only warnings and errors are also written to the log devices)"),
+		ECVF_Default
+	);
+
+	TAutoConsoleVariable<int32> CVarMyLogMappedFileSegmentMB
+	(
+		TEXT("MyLog.MappedFile.SegmentMB"),
+		64,
+		TEXT("Size of the memory-mapped log file in megabytes the file is rotated at (applied to the files created after the change)"),
+		ECVF_Default
+	);
+
+	TAutoConsoleVariable<int32> CVarMyLogMappedFileCompress
+	(
+		TEXT("MyLog.MappedFile.Compress"),
+		0,
+		TEXT("Compress the closed memory-mapped log files to .log.gz on the background thread (0 - off, 1 - on)"),
+		ECVF_Default
+	);
+
+	/** Greatest segment size (the closed segment is loaded into the memory for the compression)*/
+	constexpr int32 MAX_SEGMENT_MB = 1024;
+
+	/** How long the background thread sleeps when there's nothing to do*/
+	constexpr uint32 IDLE_WAIT_MS = 50;
+
+	/** How many times the writer waiting for the next segment yields before it starts to sleep*/
+	constexpr int32 FULL_NUM_YIELDS = 16;
+
+	/** Names of the verbosities as FOutputDeviceHelper::FormatLogLine writes them*/
+	const ANSICHAR* const VERBOSITY_NAMES[] = { "NoLogging", "Fatal", "Error", "Warning", "Display", "Log", "Verbose", "VeryVerbose" };
+
+	/** Longest category name written (longer names are truncated)*/
+	constexpr int32 MAX_CATEGORY_LEN = 128;
+
+	/** Longest prefix of the line (the time, the frame, the category and the verbosity)*/
+	constexpr int32 MAX_HEADER_LEN = MAX_CATEGORY_LEN + 128;
+
+	/** Appends the decimal digits of the value padded by the given character to the given width*/
+	void AppendDecimal(ANSICHAR*& InOutCursor, uint64 InValue, int32 const InWidth, ANSICHAR const InPadding = '0')
+	{
+		ANSICHAR Digits[24];
+		int32 NumDigits = 0;
+		do
+		{
+			Digits[NumDigits++] = static_cast<ANSICHAR>('0' + InValue % 10);
+			InValue /= 10;
+		}
+		while(InValue > 0);
+		for(int32 PaddingIndex = NumDigits; PaddingIndex < InWidth; ++PaddingIndex)
+		{
+			*InOutCursor++ = InPadding;
+		}
+		while(NumDigits > 0)
+		{
+			*InOutCursor++ = Digits[--NumDigits];
+		}
+	}
+
+	void AppendDateTime(ANSICHAR*& InOutCursor, const FDateTime& InDateTime)
+	{
+		// %Y.%m.%d-%H.%M.%S:%s
+		AppendDecimal(InOutCursor, InDateTime.GetYear(), 4);
+		*InOutCursor++ = '.';
+		AppendDecimal(InOutCursor, InDateTime.GetMonth(), 2);
+		*InOutCursor++ = '.';
+		AppendDecimal(InOutCursor, InDateTime.GetDay(), 2);
+		*InOutCursor++ = '-';
+		AppendDecimal(InOutCursor, InDateTime.GetHour(), 2);
+		*InOutCursor++ = '.';
+		AppendDecimal(InOutCursor, InDateTime.GetMinute(), 2);
+		*InOutCursor++ = '.';
+		AppendDecimal(InOutCursor, InDateTime.GetSecond(), 2);
+		*InOutCursor++ = ':';
+		AppendDecimal(InOutCursor, InDateTime.GetMillisecond(), 3);
+	}
+
+	/**
+	* Formats the prefix of the line the same way as FOutputDeviceHelper::FormatLogLine does without the temporary strings.
+	* @returns: length of the prefix.
+	*/
+	int32 FormatHeader(ANSICHAR (&OutHeader)[MAX_HEADER_LEN], FName const InCategory, ELogVerbosity::Type const InVerbosity)
+	{
+		ANSICHAR* Cursor = OutHeader;
+		if(GPrintLogTimes != ELogTimes::None)
+		{
+			*Cursor++ = '[';
+			switch(GPrintLogTimes)
+			{
+			case ELogTimes::SinceGStart:
+			{
+				// %07.2f
+				uint64 const Hundredths = static_cast<uint64>(FMath::Max(FPlatformTime::Seconds() - GStartTime, 0.0) * 100.0 + 0.5);
+				AppendDecimal(Cursor, Hundredths / 100, 4);
+				*Cursor++ = '.';
+				AppendDecimal(Cursor, Hundredths % 100, 2);
+				break;
+			}
+
+			case ELogTimes::UTC:
+				AppendDateTime(Cursor, FDateTime::UtcNow());
+				break;
+
+			default:
+				AppendDateTime(Cursor, FDateTime::Now());
+				break;
+			}
+			*Cursor++ = ']';
+			*Cursor++ = '[';
+			AppendDecimal(Cursor, GFrameCounter % 1000, 3, ' ');
+			*Cursor++ = ']';
+		}
+
+		// Category names are the identifiers: cached per thread to keep FName::ToString off the hot path
+		static thread_local FName CachedCategory;
+		static thread_local ANSICHAR CachedCategoryText[MAX_CATEGORY_LEN];
+		static thread_local int32 CachedCategoryLen = 0;
+		if(InCategory != CachedCategory)
+		{
+			FString const CategoryString = InCategory.ToString();
+			CachedCategoryLen = FMath::Min(CategoryString.Len(), MAX_CATEGORY_LEN);
+			for(int32 CharIndex = 0; CharIndex < CachedCategoryLen; ++CharIndex)
+			{
+				CachedCategoryText[CharIndex] = static_cast<ANSICHAR>(CategoryString[CharIndex]);
+			}
+			CachedCategory = InCategory;
+		}
+		if(InCategory != NAME_None)
+		{
+			FMemory::Memcpy(Cursor, CachedCategoryText, CachedCategoryLen);
+			Cursor += CachedCategoryLen;
+			*Cursor++ = ':';
+			*Cursor++ = ' ';
+		}
+		if(InVerbosity != ELogVerbosity::Log && InVerbosity < ARRAY_COUNT(VERBOSITY_NAMES))
+		{
+			for(const ANSICHAR* Name = VERBOSITY_NAMES[InVerbosity]; *Name; ++Name)
+			{
+				*Cursor++ = *Name;
+			}
+			*Cursor++ = ':';
+			*Cursor++ = ' ';
+		}
+		return static_cast<int32>(Cursor - OutHeader);
+	}
+
+	void Compress(const FString& InFilename)
+	{
+		TArray<uint8> Uncompressed;
+		if( ! FFileHelper::LoadFileToArray(Uncompressed, *InFilename) )
+		{
+			return;
+		}
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Uncompressed.Num());
+		TArray<uint8> Compressed;
+		Compressed.SetNumUninitialized(CompressedSize);
+		if( ! FCompression::CompressMemory(NAME_Gzip, Compressed.GetData(), CompressedSize, Uncompressed.GetData(), Uncompressed.Num()) )
+		{
+			return;
+		}
+		Compressed.SetNum(CompressedSize, /*bAllowShrinking*/false);
+		if(FFileHelper::SaveArrayToFile(Compressed, *(InFilename + TEXT(".gz"))))
+		{
+			IFileManager::Get().Delete(*InFilename);
+		}
+	}
+}
+
+/**
+* Writable mapping of the whole file (platform-specific).
+*/
+struct FMyMappedFile
+{
+#if PLATFORM_WINDOWS
+	HANDLE File = INVALID_HANDLE_VALUE;
+	HANDLE Mapping = nullptr;
+#elif PLATFORM_UNIX || PLATFORM_MAC
+	int Descriptor = -1;
+#endif // PLATFORM_WINDOWS
+
+	/**
+	* Creates the file of the given size and maps it.
+	* @returns: nullptr if failed.
+	*/
+	uint8* Open(const FString& InFilename, uint64 const InCapacity)
+	{
+#if PLATFORM_WINDOWS
+		File = CreateFileW(*InFilename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if(File == INVALID_HANDLE_VALUE)
+		{
+			return nullptr;
+		}
+		// The mapping of the size greater than the file extends the file
+		Mapping = CreateFileMappingW(File, nullptr, PAGE_READWRITE, static_cast<DWORD>(InCapacity >> 32), static_cast<DWORD>(InCapacity), nullptr);
+		void* const Data = Mapping ? MapViewOfFile(Mapping, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>(InCapacity)) : nullptr;
+		if(Data == nullptr)
+		{
+			Close(nullptr, InCapacity, 0);
+		}
+		return static_cast<uint8*>(Data);
+#elif PLATFORM_UNIX || PLATFORM_MAC
+		Descriptor = open(TCHAR_TO_UTF8(*InFilename), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+		if(Descriptor < 0)
+		{
+			return nullptr;
+		}
+		bool bAllocated = false;
+#if PLATFORM_LINUX
+		// Blocks are allocated now, so the writers never fault on the full disk
+		bAllocated = posix_fallocate(Descriptor, 0, static_cast<off_t>(InCapacity)) == 0;
+#endif // PLATFORM_LINUX
+		if( ! bAllocated && ftruncate(Descriptor, static_cast<off_t>(InCapacity)) != 0 )
+		{
+			Close(nullptr, InCapacity, 0);
+			return nullptr;
+		}
+		void* const Data = mmap(nullptr, static_cast<size_t>(InCapacity), PROT_READ | PROT_WRITE, MAP_SHARED, Descriptor, 0);
+		if(Data == MAP_FAILED)
+		{
+			Close(nullptr, InCapacity, 0);
+			return nullptr;
+		}
+		return static_cast<uint8*>(Data);
+#else
+		return nullptr;
+#endif // PLATFORM_WINDOWS
+	}
+
+	/**
+	* Unmaps the file and truncates it to the given size.
+	*/
+	void Close(uint8* const InData, uint64 const InCapacity, uint64 const InSize)
+	{
+#if PLATFORM_WINDOWS
+		if(InData)
+		{
+			UnmapViewOfFile(InData);
+		}
+		if(Mapping)
+		{
+			CloseHandle(Mapping);
+			Mapping = nullptr;
+		}
+		if(File != INVALID_HANDLE_VALUE)
+		{
+			LARGE_INTEGER Size;
+			Size.QuadPart = static_cast<LONGLONG>(InSize);
+			SetFilePointerEx(File, Size, nullptr, FILE_BEGIN);
+			SetEndOfFile(File);
+			CloseHandle(File);
+			File = INVALID_HANDLE_VALUE;
+		}
+#elif PLATFORM_UNIX || PLATFORM_MAC
+		if(InData)
+		{
+			munmap(InData, static_cast<size_t>(InCapacity));
+		}
+		if(Descriptor >= 0)
+		{
+			int const Result = ftruncate(Descriptor, static_cast<off_t>(InSize));
+			(void)Result;
+			close(Descriptor);
+			Descriptor = -1;
+		}
+#endif // PLATFORM_WINDOWS
+	}
+};
+
+// ~FMyLogMappedSegment Begin
+FMyLogMappedSegment::FMyLogMappedSegment(const FString& InFilename, uint64 const InCapacity) :
+	Filename ( InFilename )
+,	File ( MakeUnique<FMyMappedFile>() )
+,	Capacity ( InCapacity )
+{
+	checkf(InCapacity > 0, TEXT("Capacity must be positive in %s"), TEXT(__FUNCTION__));
+	Data = File->Open(Filename, Capacity);
+}
+
+FMyLogMappedSegment::~FMyLogMappedSegment()
+{
+	if(Data)
+	{
+		Seal();
+		Close();
+	}
+}
+
+EMyLogMappedWriteResult FMyLogMappedSegment::TryWrite(const ANSICHAR* const InText, int32 const InLen)
+{
+	return TryWriteWith(InLen, [InText, InLen](ANSICHAR* const OutLine)
+	{
+		FMemory::Memcpy(OutLine, InText, InLen);
+	});
+}
+
+bool FMyLogMappedSegment::Seal()
+{
+	uint64 const Len = Capacity + 1;
+	return SealAt(Reserved.fetch_add(Len, std::memory_order_relaxed), Len);
+}
+
+bool FMyLogMappedSegment::SealAt(uint64 const InOffset, uint64 const InLen)
+{
+	// Claimed ranges never overlap, so only one of them contains the end (or starts exactly at it)
+	if(InOffset > Capacity || InOffset + InLen <= Capacity)
+	{
+		return false;
+	}
+	SealedSize.store(InOffset, std::memory_order_release);
+	return true;
+}
+
+bool FMyLogMappedSegment::IsComplete() const
+{
+	uint64 const Size = SealedSize.load(std::memory_order_acquire);
+	return Size != MAX_uint64 && Committed.load(std::memory_order_acquire) == Size;
+}
+
+void FMyLogMappedSegment::Close()
+{
+	checkf(IsComplete(), TEXT("Segment \"%s\" must be complete in %s"), *Filename, TEXT(__FUNCTION__));
+	File->Close(Data, Capacity, GetWrittenSize());
+	Data = nullptr;
+}
+// ~FMyLogMappedSegment End
+
+// ~FMyLogMappedSink Begin
+bool FMyLogMappedSink::IsEnabled()
+{
+	return CVarMyLogMappedFile.GetValueOnAnyThread() != 0;
+}
+
+FMyLogMappedSink& FMyLogMappedSink::Get()
+{
+	// Never destroyed: the writers may still hold the segments during the static destruction
+	static FMyLogMappedSink* const Sink = new FMyLogMappedSink();
+	return *Sink;
+}
+
+bool FMyLogMappedSink::ShouldWriteToDevices(ELogVerbosity::Type const InVerbosity)
+{
+	ELogVerbosity::Type const Verbosity = static_cast<ELogVerbosity::Type>(InVerbosity & ELogVerbosity::VerbosityMask);
+	return Verbosity <= ELogVerbosity::Warning;
+}
+
+FMyLogMappedSink::FMyLogMappedSink()
+{
+	Start(FPaths::Combine(FPaths::ProjectLogDir(), TEXT("MyLog"), FString::Printf(TEXT("%s-MyLog-%s"), FApp::GetProjectName(), *FDateTime::Now().ToString())));
+	FCoreDelegates::OnExit.AddRaw(this, &FMyLogMappedSink::Shutdown);
+}
+
+FMyLogMappedSink::FMyLogMappedSink(const FString& InBaseFilename, uint64 const InSegmentSize, bool const bInCompress) :
+	SegmentSize ( InSegmentSize )
+,	bCompress ( bInCompress )
+{
+	checkf(InSegmentSize > 0, TEXT("Segment size must be positive in %s"), TEXT(__FUNCTION__));
+	Start(InBaseFilename);
+}
+
+FMyLogMappedSink::~FMyLogMappedSink()
+{
+	FCoreDelegates::OnExit.RemoveAll(this);
+	Shutdown();
+}
+
+void FMyLogMappedSink::Start(const FString& InBaseFilename)
+{
+	BaseFilename = InBaseFilename;
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(BaseFilename), /*Tree*/true);
+
+	FMyLogMappedSegment* const FirstSegment = CreateSegment();
+	if(FirstSegment == nullptr)
+	{
+		return;
+	}
+	LastSeenSegment = FirstSegment;
+	CurrentSegment.store(FirstSegment, std::memory_order_release);
+
+	if(FPlatformProcess::SupportsMultithreading())
+	{
+		WakeEvent = FPlatformProcess::GetSynchEventFromPool(/*bIsManualReset*/false);
+		Thread = FRunnableThread::Create(this, TEXT("MyLogMappedSink"), 0, TPri_BelowNormal);
+	}
+}
+
+void FMyLogMappedSink::Shutdown()
+{
+	// Called on exit and by the destructor
+	if(bShuttingDown.exchange(true, std::memory_order_seq_cst))
+	{
+		return;
+	}
+	// Writers entering now refuse the lines, the ones inside may only rotate to no segment (@see Rotate):
+	// nothing touches the segments or the event once they returned
+	while(NumWriters.load(std::memory_order_seq_cst) > 0)
+	{
+		FPlatformProcess::YieldThread();
+	}
+
+	if(Thread)
+	{
+		Thread->Kill(/*bShouldWait*/true);
+		delete Thread;
+		Thread = nullptr;
+	}
+	if(WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	// Lines written later go to the log devices
+	CurrentSegment.store(nullptr, std::memory_order_release);
+	NextSegment.store(nullptr, std::memory_order_release);
+
+	// All the claimed lines are copied, so every open segment is complete once sealed
+	for(FMyLogMappedSegment* Segment = CreatedSegments.load(std::memory_order_acquire); Segment; Segment = Segment->NextCreated)
+	{
+		if(Segment->IsValid())
+		{
+			Segment->Seal();
+			Finish(*Segment);
+		}
+	}
+	PendingSegments.Reset();
+	LastSeenSegment = nullptr;
+}
+
+FMyLogMappedSink::FWriterScope::FWriterScope(FMyLogMappedSink& InSink) :
+	Sink ( InSink )
+{
+	Sink.NumWriters.fetch_add(1, std::memory_order_seq_cst);
+}
+
+FMyLogMappedSink::FWriterScope::~FWriterScope()
+{
+	Sink.NumWriters.fetch_sub(1, std::memory_order_release);
+}
+
+bool FMyLogMappedSink::Write(const FLogCategoryBase& InCategory, ELogVerbosity::Type const InVerbosity, const TCHAR* const InText)
+{
+	FWriterScope const WriterScope { *this };
+	if(bShuttingDown.load(std::memory_order_seq_cst))
+	{
+		return false;
+	}
+
+	// The line is formatted directly to the claimed space: only the prefix is formatted on the stack
+	ELogVerbosity::Type const Verbosity = static_cast<ELogVerbosity::Type>(InVerbosity & ELogVerbosity::VerbosityMask);
+	ANSICHAR Header[MAX_HEADER_LEN];
+	int32 const HeaderLen = FormatHeader(Header, InCategory.GetCategoryName(), Verbosity);
+	int32 const TextLen = FCString::Strlen(InText);
+	int32 const ConvertedTextLen = FTCHARToUTF8_Convert::ConvertedLength(InText, TextLen);
+	int32 const LineLen = HeaderLen + ConvertedTextLen;
+	auto const WriteLine = [&Header, HeaderLen, InText, TextLen, ConvertedTextLen](ANSICHAR* const OutLine)
+	{
+		FMemory::Memcpy(OutLine, Header, HeaderLen);
+		ANSICHAR* ConvertedText = OutLine + HeaderLen;
+		FTCHARToUTF8_Convert::Convert(ConvertedText, ConvertedTextLen, InText, TextLen);
+	};
+
+	for(;;)
+	{
+		FMyLogMappedSegment* const Segment = CurrentSegment.load(std::memory_order_acquire);
+		if(Segment == nullptr || static_cast<uint64>(LineLen) >= Segment->GetCapacity())
+		{
+			return false;
+		}
+		switch(Segment->TryWriteWith(LineLen, WriteLine))
+		{
+		case EMyLogMappedWriteResult::Written:
+			return true;
+
+		case EMyLogMappedWriteResult::Sealed:
+			Rotate(Segment);
+			break;
+
+		case EMyLogMappedWriteResult::Full:
+			// The writer that sealed the segment publishes the next one
+			// (it creates the file itself if the background thread is late, so the wait sleeps instead of spinning)
+			for(int32 WaitIndex = 0; CurrentSegment.load(std::memory_order_acquire) == Segment; ++WaitIndex)
+			{
+				if(WaitIndex < FULL_NUM_YIELDS)
+				{
+					FPlatformProcess::YieldThread();
+				}
+				else
+				{
+					FPlatformProcess::SleepNoStats(0.0001F);
+				}
+			}
+			break;
+		}
+	}
+}
+
+FString FMyLogMappedSink::GetCurrentFilename() const
+{
+	const FMyLogMappedSegment* const Segment = CurrentSegment.load(std::memory_order_acquire);
+	return Segment ? Segment->GetFilename() : FString();
+}
+
+uint32 FMyLogMappedSink::Run()
+{
+	while( ! bStopRequested.load(std::memory_order_acquire) )
+	{
+		PrepareNextSegment();
+		CollectSealedSegments(CurrentSegment.load(std::memory_order_acquire));
+		FinishCompleteSegments();
+		WakeEvent->Wait(IDLE_WAIT_MS);
+	}
+	return 0;
+}
+
+void FMyLogMappedSink::Stop()
+{
+	bStopRequested.store(true, std::memory_order_release);
+	if(WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+FMyLogMappedSegment* FMyLogMappedSink::CreateSegment()
+{
+	int32 const SegmentIndex = NextSegmentIndex.fetch_add(1, std::memory_order_relaxed);
+	uint64 const Capacity = SegmentSize > 0 ? SegmentSize : static_cast<uint64>(FMath::Clamp(CVarMyLogMappedFileSegmentMB.GetValueOnAnyThread(), 1, MAX_SEGMENT_MB)) * 1024 * 1024;
+	FString const Filename = FString::Printf(TEXT("%s-%03d.log"), *BaseFilename, SegmentIndex);
+	FMyLogMappedSegment* const Segment = new FMyLogMappedSegment(Filename, Capacity);
+	if( ! Segment->IsValid() )
+	{
+		delete Segment;
+		return nullptr;
+	}
+	Segment->NextCreated = CreatedSegments.load(std::memory_order_relaxed);
+	while( ! CreatedSegments.compare_exchange_weak(Segment->NextCreated, Segment, std::memory_order_release, std::memory_order_relaxed) )
+	{
+	}
+	return Segment;
+}
+
+void FMyLogMappedSink::Rotate(FMyLogMappedSegment* const InSealedSegment)
+{
+	NumRotations.fetch_add(1, std::memory_order_relaxed);
+	FMyLogMappedSegment* NewSegment = nullptr;
+	// Shutdown waits for this writer, so the flag set before the wait is seen here:
+	// no segment is published once Shutdown started (the waiting writers see no segment and return)
+	if( ! bShuttingDown.load(std::memory_order_seq_cst) )
+	{
+		NewSegment = NextSegment.exchange(nullptr, std::memory_order_acq_rel);
+		if(NewSegment == nullptr)
+		{
+			// The background thread is late: the file is created by the writer
+			NewSegment = CreateSegment();
+		}
+	}
+	if(NewSegment)
+	{
+		NewSegment->Previous = InSealedSegment;
+	}
+	CurrentSegment.store(NewSegment, std::memory_order_release);
+	// Released by Shutdown only after the writers returned
+	if(WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FMyLogMappedSink::PrepareNextSegment()
+{
+	// Only this thread stores the non-null segment, the writers take it
+	if(NextSegment.load(std::memory_order_acquire) == nullptr && CurrentSegment.load(std::memory_order_acquire) != nullptr)
+	{
+		NextSegment.store(CreateSegment(), std::memory_order_release);
+	}
+}
+
+void FMyLogMappedSink::CollectSealedSegments(FMyLogMappedSegment* const InCurrentSegment)
+{
+	if(InCurrentSegment == LastSeenSegment)
+	{
+		return;
+	}
+	// Segments sealed since the last call are linked from the current one
+	FMyLogMappedSegment* SealedSegment = InCurrentSegment ? InCurrentSegment->Previous : LastSeenSegment;
+	while(SealedSegment)
+	{
+		PendingSegments.Add(SealedSegment);
+		if(SealedSegment == LastSeenSegment)
+		{
+			break;
+		}
+		SealedSegment = SealedSegment->Previous;
+	}
+	LastSeenSegment = InCurrentSegment;
+}
+
+void FMyLogMappedSink::FinishCompleteSegments()
+{
+	for(int32 SegmentIndex = PendingSegments.Num() - 1; SegmentIndex >= 0; --SegmentIndex)
+	{
+		if(PendingSegments[SegmentIndex]->IsComplete())
+		{
+			Finish(*PendingSegments[SegmentIndex]);
+			PendingSegments.RemoveAtSwap(SegmentIndex);
+		}
+	}
+}
+
+void FMyLogMappedSink::Finish(FMyLogMappedSegment& InSegment)
+{
+	InSegment.Close();
+	if(InSegment.GetWrittenSize() == 0)
+	{
+		IFileManager::Get().Delete(*InSegment.GetFilename());
+		return;
+	}
+	if(bCompress.Get(CVarMyLogMappedFileCompress.GetValueOnAnyThread() != 0))
+	{
+		Compress(InSegment.GetFilename());
+	}
+}
+// ~FMyLogMappedSink End
@@ -0,0 +1,254 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Templates/UniquePtr.h"
+#include "Misc/Optional.h"
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+struct FMyMappedFile;
+
+/** Result of FMyLogMappedSegment::TryWrite*/
+enum class EMyLogMappedWriteResult : uint8
+{
+	/** Line is written*/
+	Written = 0,
+
+	/** Segment is full: the line is NOT written, the caller must wait for the next segment*/
+	Full,
+
+	/** Line is the first one that did NOT fit: the segment is sealed by the call, the caller must publish the next segment*/
+	Sealed
+};
+
+/**
+* Preallocated memory-mapped file the lines are appended to.
+*
+* Writers claim the space by the atomic bump of the reserved size and never lock.
+* The first writer whose line crosses the end seals the segment (the written size is fixed),
+* the segment is complete when all the claimed lines are copied.
+*
+* @note: the mapped pages are owned by the OS, so the lines are NOT lost if the process crashes
+* (the file of the crashed process keeps its preallocated size: the tail is filled with zeros).
+*/
+class FMyLogMappedSegment
+{
+public:
+	/**
+	* Creates (or overwrites) the file of the given size and maps it.
+	* @see IsValid
+	*/
+	FMyLogMappedSegment(const FString& InFilename, uint64 InCapacity);
+	~FMyLogMappedSegment();
+
+	FMyLogMappedSegment(const FMyLogMappedSegment&) = delete;
+	FMyLogMappedSegment& operator=(const FMyLogMappedSegment&) = delete;
+
+	/** Is the file mapped (false if failed to create the file or the platform does NOT support the writable mapping)*/
+	bool IsValid() const { return Data != nullptr; }
+
+	/**
+	* Appends the line followed by the new line character.
+	*/
+	EMyLogMappedWriteResult TryWrite(const ANSICHAR* InText, int32 InLen);
+
+	/**
+	* Claims the space of the line of the given length (followed by the new line character)
+	* and lets the function write the line directly to the mapped file: void(ANSICHAR* OutLine).
+	*/
+	template<typename WriteFuncT>
+	EMyLogMappedWriteResult TryWriteWith(int32 const InLen, WriteFuncT&& InWriteFunc)
+	{
+		uint64 const Len = static_cast<uint64>(InLen) + 1;
+		uint64 const Offset = Reserved.fetch_add(Len, std::memory_order_relaxed);
+		if(Offset + Len > Capacity)
+		{
+			return SealAt(Offset, Len) ? EMyLogMappedWriteResult::Sealed : EMyLogMappedWriteResult::Full;
+		}
+		InWriteFunc(reinterpret_cast<ANSICHAR*>(Data + Offset));
+		Data[Offset + InLen] = '\n';
+		Committed.fetch_add(Len, std::memory_order_release);
+		return EMyLogMappedWriteResult::Written;
+	}
+
+	/**
+	* Seals the segment (the lines written later are refused).
+	* @returns: true if sealed by the call (false if already sealed).
+	*/
+	bool Seal();
+
+	/** Is the segment sealed and all the claimed lines copied*/
+	bool IsComplete() const;
+
+	/**
+	* Unmaps the complete segment and truncates the file to the written size.
+	*/
+	void Close();
+
+	/** Size of the written lines (valid when sealed)*/
+	uint64 GetWrittenSize() const { return SealedSize.load(std::memory_order_acquire); }
+
+	uint64 GetCapacity() const { return Capacity; }
+	const FString& GetFilename() const { return Filename; }
+
+	/** Segment that was current before this one (set before this segment is published)*/
+	FMyLogMappedSegment* Previous = nullptr;
+
+	/** Segment created before this one (segments are never removed from the list of the sink)*/
+	FMyLogMappedSegment* NextCreated = nullptr;
+
+private:
+	/** @returns: true if the claimed range is the first one crossing the end*/
+	bool SealAt(uint64 InOffset, uint64 InLen);
+
+	FString Filename;
+	TUniquePtr<FMyMappedFile> File;
+	uint8* Data = nullptr;
+	uint64 Capacity = 0;
+
+	// The counters bumped by all the writers are kept on their own cache lines by the padding
+	// (NOT by alignas: the segments are created by new, that does NOT respect the extended alignment before C++17)
+	uint8 ReservedPadding[PLATFORM_CACHE_LINE_SIZE];
+
+	/** Bytes claimed by the writers (grows past the capacity when full)*/
+	std::atomic<uint64> Reserved { 0 };
+
+	uint8 CommittedPadding[PLATFORM_CACHE_LINE_SIZE];
+
+	/** Bytes copied by the writers*/
+	std::atomic<uint64> Committed { 0 };
+
+	/** Written size, MAX_uint64 until sealed*/
+	std::atomic<uint64> SealedSize { MAX_uint64 };
+};
+
+/**
+* Sink of the MyLog category writing to the rotated memory-mapped files:
+* <ProjectLogDir>/MyLog/<ProjectName>-MyLog-<DateTime>-<SegmentIndex>.log
+*
+* Writers append to the current segment without locks (@see FMyLogMappedSegment).
+* The background thread prepares the next segment beforehand, so the rotation is the pointer swap,
+* and closes the complete segments (optionally compressing them to .log.gz).
+*
+* Enabled by MyLog.MappedFile (lines below warning are written only to the file),
+* segment size is set by MyLog.MappedFile.SegmentMB, compression by MyLog.MappedFile.Compress.
+* Closed on exit.
+*/
+class FMyLogMappedSink : public FRunnable
+{
+public:
+	/** Is the sink enabled by the console variable*/
+	static bool IsEnabled();
+
+	/** Returns the sink, opens the first segment and starts the background thread on the first call*/
+	static FMyLogMappedSink& Get();
+
+	/**
+	* Owned sink with the explicit settings (NOT the one MyLog writes to, NOT closed on exit):
+	* opens the first segment <InBaseFilename>-000.log and starts the background thread.
+	*
+	* @param InSegmentSize: size of the segment in bytes.
+	* @param bInCompress: compress the closed segments to .log.gz.
+	*/
+	FMyLogMappedSink(const FString& InBaseFilename, uint64 InSegmentSize, bool bInCompress);
+
+	/** Closes all the segments*/
+	virtual ~FMyLogMappedSink();
+
+	/**
+	* Should the line written to the file also be written to the log devices.
+	*/
+	static bool ShouldWriteToDevices(ELogVerbosity::Type InVerbosity);
+
+	/**
+	* Formats the line the same way as the log file does directly into the current segment.
+	* @returns: false if the line is NOT written (the sink is NOT running or the line is longer than the segment) - caller should write it to the log devices.
+	*/
+	bool Write(const FLogCategoryBase& InCategory, ELogVerbosity::Type InVerbosity, const TCHAR* InText);
+
+	bool IsRunning() const { return CurrentSegment.load(std::memory_order_acquire) != nullptr; }
+
+	/** Filename of the current segment (empty if not running)*/
+	FString GetCurrentFilename() const;
+
+	/** Number of the segments sealed because they're full*/
+	uint64 GetNumRotations() const { return NumRotations.load(std::memory_order_relaxed); }
+
+	// ~FRunnable Begin
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	// ~FRunnable End
+
+private:
+	FMyLogMappedSink();
+
+	/** Opens the first segment and starts the background thread*/
+	void Start(const FString& InBaseFilename);
+
+	/**
+	* Refuses the new lines, waits for the writers to return, stops the thread and closes all the segments.
+	*/
+	void Shutdown();
+
+	/** Counts the writer in Write (the sink must NOT be shut down while any writer is in)*/
+	struct FWriterScope
+	{
+		explicit FWriterScope(FMyLogMappedSink& InSink);
+		~FWriterScope();
+
+		FMyLogMappedSink& Sink;
+	};
+
+	/** @returns: nullptr if failed to create*/
+	FMyLogMappedSegment* CreateSegment();
+
+	/**
+	* Publishes the next segment after the sealed one (the prepared one, or created on the calling thread).
+	*/
+	void Rotate(FMyLogMappedSegment* InSealedSegment);
+
+	/** Creates the next segment if the writers took it (background thread)*/
+	void PrepareNextSegment();
+
+	/** Adds the segments sealed since the last call to the pending ones (background thread)*/
+	void CollectSealedSegments(FMyLogMappedSegment* InCurrentSegment);
+
+	/** Finishes the complete pending segments (background thread)*/
+	void FinishCompleteSegments();
+
+	/** Closes the segment and compresses it if enabled (the empty segment is deleted)*/
+	void Finish(FMyLogMappedSegment& InSegment);
+
+	std::atomic<FMyLogMappedSegment*> CurrentSegment { nullptr };
+	std::atomic<FMyLogMappedSegment*> NextSegment { nullptr };
+	std::atomic<uint64> NumRotations { 0 };
+	std::atomic<int32> NextSegmentIndex { 0 };
+	FString BaseFilename;
+
+	/** Size of the created segments in bytes (0 - by MyLog.MappedFile.SegmentMB)*/
+	uint64 SegmentSize = 0;
+
+	/** Compress the closed segments (unset - by MyLog.MappedFile.Compress)*/
+	TOptional<bool> bCompress;
+
+	/** Segment that was current when the sealed segments were collected last time*/
+	FMyLogMappedSegment* LastSeenSegment = nullptr;
+
+	/** Sealed segments waiting for the writers to complete*/
+	TArray<FMyLogMappedSegment*> PendingSegments;
+
+	/** All the created segments (never deleted: the late writers may still bump the reserved size of the sealed segments)*/
+	std::atomic<FMyLogMappedSegment*> CreatedSegments { nullptr };
+
+	FEvent* WakeEvent = nullptr;
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bStopRequested { false };
+
+	/** Set by Shutdown: the writers entering Write refuse the lines, Rotate does NOT create the segments*/
+	std::atomic<bool> bShuttingDown { false };
+
+	/** Number of the writers inside of Write*/
+	std::atomic<int32> NumWriters { 0 };
+};
@@ -0,0 +1,417 @@
+#include "MyLogProfiler.h"
+#include "MyLogCallSite.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/ScopeLock.h"
+#include "Math/UnrealMathUtility.h"
+#include <atomic>
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarMyLogProfile
+	(
+		TEXT("MyLog.Profile"),
+		0,
+		TEXT("Record the timing of the scoped log helpers (M_LOGFUNC*, M_LOGBLOCK*) even if the lines are NOT logged (0 - off, 1 - on)"),
+		ECVF_Default
+	);
+
+	TAutoConsoleVariable<int32> CVarMyLogProfileRingCapacity
+	(
+		TEXT("MyLog.Profile.RingCapacity"),
+		4096,
+		TEXT("Number of the last enter/exit events kept for each thread (applied to the threads that start profiling after the change)"),
+		ECVF_Default
+	);
+
+	TAutoConsoleVariable<int32> CVarMyLogTraceMaxEventsPerThread
+	(
+		TEXT("MyLog.Trace.MaxEventsPerThread"),
+		1000000,
+		TEXT("Maximal number of the scope events captured for each thread by MyLog.Trace.Start (the rest is dropped)"),
+		ECVF_Default
+	);
+
+	/** Number of scopes printed by MyLog.Profile.Dump by default*/
+	constexpr int32 DEFAULT_DUMP_MAX_SCOPES = 20;
+
+	std::atomic<bool> GCapturing { false };
+	std::atomic<uint64> GNumCaptureDropped { 0 };
+	uint64 GCaptureStartCycles = 0;
+	int32 GCaptureMaxEventsPerThread = 0;
+
+	/** Enter or exit event of the profiled scope*/
+	struct FMyLogProfilerEvent
+	{
+		const FMyLogCallSite* Site = nullptr;
+		uint64 Cycles = 0;
+		bool bEnter = false;
+	};
+
+	struct FMyLogProfilerScopeStats
+	{
+		uint64 NumCalls = 0;
+		uint64 TotalCycles = 0;
+		uint64 SelfCycles = 0;
+		uint64 MaxCycles = 0;
+		FMyLogLatencyHistogram Histogram;
+
+		void Merge(const FMyLogProfilerScopeStats& InOther)
+		{
+			NumCalls += InOther.NumCalls;
+			TotalCycles += InOther.TotalCycles;
+			SelfCycles += InOther.SelfCycles;
+			MaxCycles = FMath::Max(MaxCycles, InOther.MaxCycles);
+			Histogram.Merge(InOther.Histogram);
+		}
+	};
+
+	struct FMyLogProfilerOpenScope
+	{
+		const FMyLogCallSite* Site = nullptr;
+		uint64 EnterCycles = 0;
+
+		/** Total time of the nested profiled scopes*/
+		uint64 ChildCycles = 0;
+	};
+
+	/**
+	* Profiling state of the thread (never destroyed, reused by the threads started later).
+	*/
+	struct FMyLogProfilerThreadState
+	{
+		/** Guards Events and Stats (only contended by Dump/Reset)*/
+		FCriticalSection CriticalSection;
+
+		/** Ring of the last events*/
+		TArray<FMyLogProfilerEvent> Events;
+		uint32 NextEventIndex = 0;
+
+		TMap<const FMyLogCallSite*, FMyLogProfilerScopeStats> Stats;
+
+		/** Events captured since FMyLogProfiler::StartCapture*/
+		TArray<FMyLogTraceEvent> CapturedEvents;
+
+		/** Only accessed by the owning thread*/
+		TArray<FMyLogProfilerOpenScope> OpenScopes;
+
+		/** Id of the owning thread*/
+		uint32 ThreadId = 0;
+
+		std::atomic<bool> bOwned { true };
+
+		explicit FMyLogProfilerThreadState(int32 const InRingCapacity)
+		{
+			Events.SetNum(FMath::Max(InRingCapacity, 1));
+		}
+
+		void AddEvent(const FMyLogCallSite* const InSite, uint64 const InCycles, bool const bInEnter)
+		{
+			Events[NextEventIndex] = FMyLogProfilerEvent{ InSite, InCycles, bInEnter };
+			NextEventIndex = (NextEventIndex + 1) % static_cast<uint32>(Events.Num());
+
+			if(GCapturing.load(std::memory_order_acquire))
+			{
+				if(CapturedEvents.Num() < GCaptureMaxEventsPerThread)
+				{
+					CapturedEvents.Add(FMyLogTraceEvent{ InSite, InCycles, ThreadId, bInEnter });
+				}
+				else
+				{
+					GNumCaptureDropped.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		}
+	};
+
+	FCriticalSection& GetThreadStatesCriticalSection()
+	{
+		static FCriticalSection CriticalSection;
+		return CriticalSection;
+	}
+
+	/** @note: guarded by GetThreadStatesCriticalSection*/
+	TArray<FMyLogProfilerThreadState*>& GetThreadStates()
+	{
+		static TArray<FMyLogProfilerThreadState*> States;
+		return States;
+	}
+
+	/**
+	* Releases the state of the thread when the thread exits.
+	*/
+	struct FMyLogProfilerThreadStateOwner
+	{
+		FMyLogProfilerThreadState* State = nullptr;
+
+		~FMyLogProfilerThreadStateOwner()
+		{
+			if(State)
+			{
+				State->OpenScopes.Reset();
+				State->bOwned.store(false, std::memory_order_release);
+			}
+		}
+	};
+
+	thread_local FMyLogProfilerThreadStateOwner GThreadStateOwner;
+
+	FMyLogProfilerThreadState& GetThreadState()
+	{
+		if(GThreadStateOwner.State)
+		{
+			return *GThreadStateOwner.State;
+		}
+
+		FScopeLock const Lock { &GetThreadStatesCriticalSection() };
+		TArray<FMyLogProfilerThreadState*>& States = GetThreadStates();
+		for(FMyLogProfilerThreadState* const State : States)
+		{
+			bool bExpectedOwned = false;
+			if(State->bOwned.compare_exchange_strong(bExpectedOwned, true, std::memory_order_acquire))
+			{
+				State->ThreadId = FPlatformTLS::GetCurrentThreadId();
+				GThreadStateOwner.State = State;
+				return *State;
+			}
+		}
+		FMyLogProfilerThreadState* const NewState = new FMyLogProfilerThreadState(CVarMyLogProfileRingCapacity.GetValueOnAnyThread());
+		NewState->ThreadId = FPlatformTLS::GetCurrentThreadId();
+		States.Add(NewState);
+		GThreadStateOwner.State = NewState;
+		return *NewState;
+	}
+
+	double CyclesToMs(uint64 const InCycles)
+	{
+		return static_cast<double>(InCycles) * FPlatformTime::GetSecondsPerCycle64() * 1000.0;
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const DumpCommand
+	(
+		TEXT("MyLog.Profile.Dump"),
+		TEXT("Prints the profiled scopes with the greatest total time (optional argument: number of scopes)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			int32 const MaxScopes = (InArgs.Num() > 0) ? FCString::Atoi(*InArgs[0]) : DEFAULT_DUMP_MAX_SCOPES;
+			FMyLogProfiler::Dump(InAr, MaxScopes);
+		})
+	);
+
+	FAutoConsoleCommand const ResetCommand
+	(
+		TEXT("MyLog.Profile.Reset"),
+		TEXT("Clears the stats of the profiled scopes"),
+		FConsoleCommandDelegate::CreateStatic(&FMyLogProfiler::Reset)
+	);
+}
+
+// ~FMyLogLatencyHistogram Begin
+void FMyLogLatencyHistogram::Add(uint64 const InCycles)
+{
+	++Counts[GetBucketIndex(InCycles)];
+	++NumSamples;
+}
+
+void FMyLogLatencyHistogram::Merge(const FMyLogLatencyHistogram& InOther)
+{
+	for(int32 BucketIndex = 0; BucketIndex < NUM_BUCKETS; ++BucketIndex)
+	{
+		Counts[BucketIndex] += InOther.Counts[BucketIndex];
+	}
+	NumSamples += InOther.NumSamples;
+}
+
+uint64 FMyLogLatencyHistogram::GetPercentileCycles(double const InPercentile) const
+{
+	if(NumSamples == 0)
+	{
+		return 0;
+	}
+	// Rank of the sample (one-based), so the 0th percentile is the first sample
+	uint64 const Rank = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(FMath::Clamp(InPercentile, 0.0, 1.0) * NumSamples)));
+	uint64 NumCounted = 0;
+	for(int32 BucketIndex = 0; BucketIndex < NUM_BUCKETS; ++BucketIndex)
+	{
+		NumCounted += Counts[BucketIndex];
+		if(NumCounted >= Rank)
+		{
+			return GetBucketUpperBound(BucketIndex);
+		}
+	}
+	return GetBucketUpperBound(NUM_BUCKETS - 1);
+}
+
+int32 FMyLogLatencyHistogram::GetBucketIndex(uint64 const InCycles)
+{
+	if(InCycles < NUM_SUB_BUCKETS)
+	{
+		return static_cast<int32>(InCycles);
+	}
+	int32 const HighestBit = static_cast<int32>(FMath::FloorLog2_64(InCycles));
+	int32 const SubBucket = static_cast<int32>(InCycles >> (HighestBit - NUM_SUB_BUCKETS_LOG2)) & (NUM_SUB_BUCKETS - 1);
+	return (HighestBit - NUM_SUB_BUCKETS_LOG2 + 1) * NUM_SUB_BUCKETS + SubBucket;
+}
+
+uint64 FMyLogLatencyHistogram::GetBucketUpperBound(int32 const InBucketIndex)
+{
+	if(InBucketIndex < NUM_SUB_BUCKETS)
+	{
+		return static_cast<uint64>(InBucketIndex);
+	}
+	int32 const Shift = InBucketIndex / NUM_SUB_BUCKETS - 1;
+	uint64 const SubBucket = static_cast<uint64>(InBucketIndex % NUM_SUB_BUCKETS);
+	uint64 const LowerBound = (NUM_SUB_BUCKETS + SubBucket) << Shift;
+	return LowerBound + (uint64(1) << Shift) - 1;
+}
+// ~FMyLogLatencyHistogram End
+
+// ~FMyLogProfiler Begin
+bool FMyLogProfiler::IsEnabled()
+{
+	return CVarMyLogProfile.GetValueOnAnyThread() != 0 || GCapturing.load(std::memory_order_relaxed);
+}
+
+void FMyLogProfiler::Enter(const FMyLogCallSite& InSite)
+{
+	FMyLogProfilerThreadState& State = GetThreadState();
+	uint64 const NowCycles = FPlatformTime::Cycles64();
+	State.OpenScopes.Add(FMyLogProfilerOpenScope{ &InSite, NowCycles, 0 });
+
+	FScopeLock const Lock { &State.CriticalSection };
+	State.AddEvent(&InSite, NowCycles, /*bEnter*/true);
+}
+
+void FMyLogProfiler::Exit(const FMyLogCallSite& InSite)
+{
+	uint64 const NowCycles = FPlatformTime::Cycles64();
+	FMyLogProfilerThreadState& State = GetThreadState();
+	checkf(State.OpenScopes.Num() > 0 && State.OpenScopes.Last().Site == &InSite, TEXT("Exited scope must be the scope entered last in %s"), TEXT(__FUNCTION__));
+	FMyLogProfilerOpenScope const Scope = State.OpenScopes.Pop(/*bAllowShrinking*/false);
+	uint64 const ElapsedCycles = NowCycles - Scope.EnterCycles;
+	if(State.OpenScopes.Num() > 0)
+	{
+		State.OpenScopes.Last().ChildCycles += ElapsedCycles;
+	}
+
+	FScopeLock const Lock { &State.CriticalSection };
+	State.AddEvent(&InSite, NowCycles, /*bEnter*/false);
+	FMyLogProfilerScopeStats& Stats = State.Stats.FindOrAdd(&InSite);
+	++Stats.NumCalls;
+	Stats.TotalCycles += ElapsedCycles;
+	Stats.SelfCycles += ElapsedCycles - FMath::Min(Scope.ChildCycles, ElapsedCycles);
+	Stats.MaxCycles = FMath::Max(Stats.MaxCycles, ElapsedCycles);
+	Stats.Histogram.Add(ElapsedCycles);
+}
+
+TArray<FMyLogScopeSummary> FMyLogProfiler::GetScopeSummaries()
+{
+	TMap<const FMyLogCallSite*, FMyLogProfilerScopeStats> MergedStats;
+	{
+		FScopeLock const Lock { &GetThreadStatesCriticalSection() };
+		for(FMyLogProfilerThreadState* const State : GetThreadStates())
+		{
+			FScopeLock const StateLock { &State->CriticalSection };
+			for(const TPair<const FMyLogCallSite*, FMyLogProfilerScopeStats>& Pair : State->Stats)
+			{
+				MergedStats.FindOrAdd(Pair.Key).Merge(Pair.Value);
+			}
+		}
+	}
+
+	TArray<FMyLogScopeSummary> Summaries;
+	Summaries.Reserve(MergedStats.Num());
+	for(const TPair<const FMyLogCallSite*, FMyLogProfilerScopeStats>& Pair : MergedStats)
+	{
+		const FMyLogProfilerScopeStats& Stats = Pair.Value;
+		FMyLogScopeSummary& Summary = Summaries.AddDefaulted_GetRef();
+		Summary.Site = Pair.Key;
+		Summary.NumCalls = Stats.NumCalls;
+		Summary.TotalMs = CyclesToMs(Stats.TotalCycles);
+		Summary.SelfMs = CyclesToMs(Stats.SelfCycles);
+		Summary.MaxMs = CyclesToMs(Stats.MaxCycles);
+		Summary.P50Ms = CyclesToMs(Stats.Histogram.GetPercentileCycles(0.5));
+		Summary.P99Ms = CyclesToMs(Stats.Histogram.GetPercentileCycles(0.99));
+	}
+	Summaries.Sort([](const FMyLogScopeSummary& InA, const FMyLogScopeSummary& InB)
+	{
+		return InA.TotalMs > InB.TotalMs;
+	});
+	return Summaries;
+}
+
+void FMyLogProfiler::Dump(FOutputDevice& InAr, int32 const InMaxScopes)
+{
+	TArray<FMyLogScopeSummary> const Summaries = GetScopeSummaries();
+	InAr.Logf(TEXT("%10s %12s %12s %10s %10s %10s %10s  Scope"), TEXT("Calls"), TEXT("Total(ms)"), TEXT("Self(ms)"), TEXT("Avg(us)"), TEXT("P50(us)"), TEXT("P99(us)"), TEXT("Max(us)"));
+	int32 const NumPrinted = FMath::Min(Summaries.Num(), FMath::Max(InMaxScopes, 0));
+	for(int32 SummaryIndex = 0; SummaryIndex < NumPrinted; ++SummaryIndex)
+	{
+		const FMyLogScopeSummary& S = Summaries[SummaryIndex];
+		double const AvgUs = (S.NumCalls > 0) ? (S.TotalMs * 1000.0 / S.NumCalls) : 0.0;
+		InAr.Logf(TEXT("%10llu %12.3f %12.3f %10.2f %10.2f %10.2f %10.2f  %s%s"),
+			S.NumCalls, S.TotalMs, S.SelfMs, AvgUs, S.P50Ms * 1000.0, S.P99Ms * 1000.0, S.MaxMs * 1000.0, *S.Site->Prefix, *S.Site->Postfix);
+	}
+	InAr.Logf(TEXT("%d of %d profiled scopes printed"), NumPrinted, Summaries.Num());
+}
+
+void FMyLogProfiler::Reset()
+{
+	FScopeLock const Lock { &GetThreadStatesCriticalSection() };
+	for(FMyLogProfilerThreadState* const State : GetThreadStates())
+	{
+		FScopeLock const StateLock { &State->CriticalSection };
+		State->Stats.Reset();
+		for(FMyLogProfilerEvent& Event : State->Events)
+		{
+			Event = FMyLogProfilerEvent{};
+		}
+		State->NextEventIndex = 0;
+	}
+}
+void FMyLogProfiler::StartCapture()
+{
+	FScopeLock const Lock { &GetThreadStatesCriticalSection() };
+	for(FMyLogProfilerThreadState* const State : GetThreadStates())
+	{
+		FScopeLock const StateLock { &State->CriticalSection };
+		State->CapturedEvents.Reset();
+	}
+	GCaptureMaxEventsPerThread = FMath::Max(CVarMyLogTraceMaxEventsPerThread.GetValueOnAnyThread(), 0);
+	GNumCaptureDropped.store(0, std::memory_order_relaxed);
+	GCaptureStartCycles = FPlatformTime::Cycles64();
+	GCapturing.store(true, std::memory_order_release);
+}
+
+FMyLogTraceCapture FMyLogProfiler::StopCapture()
+{
+	GCapturing.store(false, std::memory_order_release);
+
+	FMyLogTraceCapture Capture;
+	Capture.StartCycles = GCaptureStartCycles;
+	{
+		FScopeLock const Lock { &GetThreadStatesCriticalSection() };
+		for(FMyLogProfilerThreadState* const State : GetThreadStates())
+		{
+			FScopeLock const StateLock { &State->CriticalSection };
+			Capture.Events.Append(State->CapturedEvents);
+			State->CapturedEvents.Empty();
+		}
+	}
+	Capture.NumDropped = GNumCaptureDropped.load(std::memory_order_relaxed);
+	// Stable: enter and exit of the empty scope may have the same timestamp
+	Capture.Events.StableSort([](const FMyLogTraceEvent& InA, const FMyLogTraceEvent& InB)
+	{
+		return InA.Cycles < InB.Cycles;
+	});
+	return Capture;
+}
+
+bool FMyLogProfiler::IsCapturing()
+{
+	return GCapturing.load(std::memory_order_relaxed);
+}
+// ~FMyLogProfiler End
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMyLogCallSite;
+class FOutputDevice;
+
+/**
+* Latency histogram: each power of two is split into 4 linear sub-buckets
+* (percentiles are reported as the upper bound of the bucket, so the error is below 25%).
+*/
+struct FMyLogLatencyHistogram
+{
+	static constexpr int32 NUM_SUB_BUCKETS_LOG2 = 2;
+	static constexpr int32 NUM_SUB_BUCKETS = 1 << NUM_SUB_BUCKETS_LOG2;
+	static constexpr int32 NUM_BUCKETS = 64 * NUM_SUB_BUCKETS;
+
+	uint32 Counts[NUM_BUCKETS] = {};
+	uint64 NumSamples = 0;
+
+	void Add(uint64 InCycles);
+	void Merge(const FMyLogLatencyHistogram& InOther);
+
+	/**
+	* @param InPercentile: in range [0; 1].
+	* @returns: upper bound of the bucket containing the percentile (zero if empty).
+	*/
+	uint64 GetPercentileCycles(double InPercentile) const;
+
+	static int32 GetBucketIndex(uint64 InCycles);
+	static uint64 GetBucketUpperBound(int32 InBucketIndex);
+};
+
+/**
+* Timing of the scope merged over all threads.
+*/
+struct FMyLogScopeSummary
+{
+	const FMyLogCallSite* Site = nullptr;
+	uint64 NumCalls = 0;
+	double TotalMs = 0.0;
+
+	/** Total time without the time of the nested profiled scopes*/
+	double SelfMs = 0.0;
+
+	double MaxMs = 0.0;
+	double P50Ms = 0.0;
+	double P99Ms = 0.0;
+};
+
+/**
+* Enter or exit event of the captured scope (@see FMyLogProfiler::StartCapture).
+*/
+struct FMyLogTraceEvent
+{
+	const FMyLogCallSite* Site = nullptr;
+	uint64 Cycles = 0;
+	uint32 ThreadId = 0;
+	bool bEnter = false;
+};
+
+/**
+* Events of the scopes captured between FMyLogProfiler::StartCapture and StopCapture.
+*/
+struct FMyLogTraceCapture
+{
+	uint64 StartCycles = 0;
+
+	/** Sorted by Cycles*/
+	TArray<FMyLogTraceEvent> Events;
+
+	/** Number of events NOT captured because of MyLog.Trace.MaxEventsPerThread*/
+	uint64 NumDropped = 0;
+};
+
+/**
+* Profiling mode of the scoped log helpers (M_LOGFUNC*, M_LOGBLOCK*).
+*
+* When enabled by MyLog.Profile console variable, each scoped helper records the enter/exit timestamps (Cycles64)
+* into the ring of its thread and aggregates the call count, total and self time and the latency histogram per call site,
+* regardless of whether the scope lines are logged (so every instrumented function is profiled without code changes).
+*
+* Each thread has its own state: the lock of the state is only contended by Dump/Reset and the capture start/stop.
+* Results are printed by MyLog.Profile.Dump and cleared by MyLog.Profile.Reset.
+*/
+class FMyLogProfiler
+{
+public:
+	/** Is profiling enabled by the console variable*/
+	static bool IsEnabled();
+
+	/** Records entering the scope of the call site on the calling thread*/
+	static void Enter(const FMyLogCallSite& InSite);
+
+	/** Records exiting the scope entered last on the calling thread*/
+	static void Exit(const FMyLogCallSite& InSite);
+
+	/**
+	* Merges the stats of all threads.
+	* @returns: summaries sorted by the total time (descending).
+	*/
+	static TArray<FMyLogScopeSummary> GetScopeSummaries();
+
+	/**
+	* Prints the scopes with the greatest total time.
+	*/
+	static void Dump(FOutputDevice& InAr, int32 InMaxScopes);
+
+	/** Clears the stats and the rings of all threads (the open scopes are kept)*/
+	static void Reset();
+
+	/**
+	* Starts capturing all the scope events of all threads (scopes are timed while capturing even if MyLog.Profile is off).
+	* Events captured before are discarded.
+	*/
+	static void StartCapture();
+
+	/** Stops capturing and returns the captured events*/
+	static FMyLogTraceCapture StopCapture();
+
+	static bool IsCapturing();
+};
@@ -0,0 +1,671 @@
+#include "MyLogReplay.h"
+
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/FileHelper.h"
+#include <cstring>
+
+namespace
+{
+	/** Greatest number of the chunks parsed in parallel*/
+	constexpr int32 MAX_CHUNKS = 256;
+
+	/** The postfix of the M_LOG* line (@see FMyLogCallSite::Postfix)*/
+	constexpr ANSICHAR SITE_POSTFIX[] = " (line: ";
+	constexpr int32 SITE_POSTFIX_LEN = sizeof(SITE_POSTFIX) - 1;
+
+	/** The name of the object (@see ULogUtilLib::AppendNameAndClass)*/
+	constexpr ANSICHAR OBJECT_NAME_KEY[] = "name=\"";
+	constexpr int32 OBJECT_NAME_KEY_LEN = sizeof(OBJECT_NAME_KEY) - 1;
+
+	struct FMyLogReplayVerbosityName
+	{
+		const ANSICHAR* Name;
+		int32 Len;
+		ELogVerbosity::Type Verbosity;
+	};
+
+	/** Verbosities written by FOutputDeviceHelper::FormatLogLine (Log is NOT written)*/
+	const FMyLogReplayVerbosityName VERBOSITY_NAMES[] =
+	{
+		{ "Fatal: ", 7, ELogVerbosity::Fatal },
+		{ "Error: ", 7, ELogVerbosity::Error },
+		{ "Warning: ", 9, ELogVerbosity::Warning },
+		{ "Display: ", 9, ELogVerbosity::Display },
+		{ "Verbose: ", 9, ELogVerbosity::Verbose },
+		{ "VeryVerbose: ", 13, ELogVerbosity::VeryVerbose }
+	};
+
+	/** Record of the chunk (the site and the objects are the indices of the chunk)*/
+	struct FMyLogReplayChunkRecord
+	{
+		FMyLogReplayRecord Record;
+
+		/** Is the time written in the header*/
+		bool bHasTime = false;
+
+		/** Is the time the date (the seconds since the start otherwise)*/
+		bool bDateTime = false;
+
+		/** Range of the objects of the record in ObjectRefs*/
+		int32 FirstObject = 0;
+		int32 NumObjects = 0;
+	};
+
+	/**
+	* Part of the file parsed on its own thread.
+	* Sites and objects are keyed by the hash of their text, so the strings are built only once per chunk.
+	*/
+	struct FMyLogReplayChunk
+	{
+		uint64 Begin = 0;
+		uint64 End = 0;
+
+		/** End of the continuation lines of the last record of the previous chunk*/
+		uint64 LeadingEnd = 0;
+
+		/** Objects of the continuation lines of the last record of the previous chunk (only the object range is used)*/
+		FMyLogReplayChunkRecord Leading;
+
+		TArray<FMyLogReplayChunkRecord> Records;
+
+		TArray<FString> Sites;
+		TMap<uint64, int32> SiteIndices;
+
+		TArray<FString> Objects;
+		TMap<uint64, int32> ObjectIndices;
+		TArray<int32> ObjectRefs;
+	};
+
+	bool IsDigit(ANSICHAR const InChar)
+	{
+		return InChar >= '0' && InChar <= '9';
+	}
+
+	bool IsIdentifierChar(ANSICHAR const InChar)
+	{
+		return IsDigit(InChar) || (InChar >= 'a' && InChar <= 'z') || (InChar >= 'A' && InChar <= 'Z') || InChar == '_';
+	}
+
+	bool StartsWith(const ANSICHAR* const InBegin, const ANSICHAR* const InEnd, const ANSICHAR* const InPrefix, int32 const InPrefixLen)
+	{
+		return (InEnd - InBegin) >= InPrefixLen && FMemory::Memcmp(InBegin, InPrefix, InPrefixLen) == 0;
+	}
+
+	/** String of the UTF-8 text of the given length*/
+	FString MakeString(const ANSICHAR* const InText, int32 const InLen)
+	{
+		FUTF8ToTCHAR const Text { InText, InLen };
+		return FString(Text.Length(), Text.Get());
+	}
+
+	/** @returns: nullptr if NOT found*/
+	const ANSICHAR* Find(const ANSICHAR* const InBegin, const ANSICHAR* const InEnd, const ANSICHAR* const InNeedle, int32 const InNeedleLen)
+	{
+		for(const ANSICHAR* Pos = InBegin; InEnd - Pos >= InNeedleLen; ++Pos)
+		{
+			Pos = static_cast<const ANSICHAR*>(memchr(Pos, InNeedle[0], (InEnd - Pos) - InNeedleLen + 1));
+			if(Pos == nullptr)
+			{
+				return nullptr;
+			}
+			if(FMemory::Memcmp(Pos, InNeedle, InNeedleLen) == 0)
+			{
+				return Pos;
+			}
+		}
+		return nullptr;
+	}
+
+	/** @returns: nullptr if NOT found*/
+	const ANSICHAR* FindLast(const ANSICHAR* const InBegin, const ANSICHAR* const InEnd, const ANSICHAR* const InNeedle, int32 const InNeedleLen)
+	{
+		for(const ANSICHAR* Pos = InEnd - InNeedleLen; Pos >= InBegin; --Pos)
+		{
+			if(*Pos == InNeedle[0] && FMemory::Memcmp(Pos, InNeedle, InNeedleLen) == 0)
+			{
+				return Pos;
+			}
+		}
+		return nullptr;
+	}
+
+	/** @returns: -1 if NOT all the characters are digits*/
+	int32 ParseDigits(const ANSICHAR* const InText, int32 const InNum)
+	{
+		int32 Value = 0;
+		for(int32 CharIndex = 0; CharIndex < InNum; ++CharIndex)
+		{
+			if( ! IsDigit(InText[CharIndex]) )
+			{
+				return -1;
+			}
+			Value = Value * 10 + (InText[CharIndex] - '0');
+		}
+		return Value;
+	}
+
+	/** Parses the date of the log time: 2020.01.31-23.59.59:999*/
+	bool ParseDateTime(const ANSICHAR* const InBegin, const ANSICHAR* const InEnd, FDateTime& OutDateTime)
+	{
+		if(InEnd - InBegin != 23 || InBegin[4] != '.' || InBegin[7] != '.' || InBegin[10] != '-' || InBegin[13] != '.' || InBegin[16] != '.' || InBegin[19] != ':')
+		{
+			return false;
+		}
+		int32 const Year = ParseDigits(InBegin, 4);
+		int32 const Month = ParseDigits(InBegin + 5, 2);
+		int32 const Day = ParseDigits(InBegin + 8, 2);
+		int32 const Hour = ParseDigits(InBegin + 11, 2);
+		int32 const Minute = ParseDigits(InBegin + 14, 2);
+		int32 const Second = ParseDigits(InBegin + 17, 2);
+		int32 const Millisecond = ParseDigits(InBegin + 20, 3);
+		if( ! FDateTime::Validate(Year, Month, Day, Hour, Minute, Second, Millisecond) )
+		{
+			return false;
+		}
+		OutDateTime = FDateTime(Year, Month, Day, Hour, Minute, Second, Millisecond);
+		return true;
+	}
+
+	/** Parses the seconds since the start of the log time: 0012.34*/
+	bool ParseSeconds(const ANSICHAR* const InBegin, const ANSICHAR* const InEnd, double& OutSeconds)
+	{
+		const ANSICHAR* Pos = InBegin;
+		while(Pos < InEnd && *Pos == ' ')
+		{
+			++Pos;
+		}
+		double Value = 0.0;
+		int32 NumDigits = 0;
+		for(; Pos < InEnd && IsDigit(*Pos); ++Pos, ++NumDigits)
+		{
+			Value = Value * 10.0 + (*Pos - '0');
+		}
+		if(Pos < InEnd && *Pos == '.')
+		{
+			double Scale = 0.1;
+			for(++Pos; Pos < InEnd && IsDigit(*Pos); ++Pos, ++NumDigits, Scale *= 0.1)
+			{
+				Value += (*Pos - '0') * Scale;
+			}
+		}
+		if(NumDigits == 0 || Pos != InEnd)
+		{
+			return false;
+		}
+		OutSeconds = Value;
+		return true;
+	}
+
+	/**
+	* Parses the header of the line written by FOutputDeviceHelper::FormatLogLine: [Time][Frame]Category: Verbosity: Message
+	* @returns: false if the line has neither the time nor the category (continuation line).
+	*/
+	bool ParseHeader(const ANSICHAR* const InBegin, const ANSICHAR* const InEnd, FMyLogReplayChunkRecord& OutRecord, const ANSICHAR*& OutMessage)
+	{
+		const ANSICHAR* Pos = InBegin;
+		bool bHeader = false;
+		if(Pos < InEnd && *Pos == '[')
+		{
+			const ANSICHAR* const Close = Find(Pos + 1, InEnd, "]", 1);
+			FDateTime DateTime;
+			if(Close && ParseDateTime(Pos + 1, Close, DateTime))
+			{
+				OutRecord.Record.Seconds = static_cast<double>(DateTime.GetTicks()) / ETimespan::TicksPerSecond;
+				OutRecord.bDateTime = true;
+				bHeader = true;
+			}
+			else if(Close && ParseSeconds(Pos + 1, Close, OutRecord.Record.Seconds))
+			{
+				bHeader = true;
+			}
+			if(bHeader)
+			{
+				OutRecord.bHasTime = true;
+				Pos = Close + 1;
+				// Frame counter
+				const ANSICHAR* const FrameClose = (Pos < InEnd && *Pos == '[') ? Find(Pos + 1, InEnd, "]", 1) : nullptr;
+				if(FrameClose)
+				{
+					Pos = FrameClose + 1;
+				}
+			}
+		}
+
+		const ANSICHAR* CategoryEnd = Pos;
+		while(CategoryEnd < InEnd && IsIdentifierChar(*CategoryEnd))
+		{
+			++CategoryEnd;
+		}
+		if(CategoryEnd > Pos && StartsWith(CategoryEnd, InEnd, ": ", 2))
+		{
+			bHeader = true;
+			Pos = CategoryEnd + 2;
+			for(const FMyLogReplayVerbosityName& Name : VERBOSITY_NAMES)
+			{
+				if(StartsWith(Pos, InEnd, Name.Name, Name.Len))
+				{
+					OutRecord.Record.Verbosity = Name.Verbosity;
+					Pos += Name.Len;
+					break;
+				}
+			}
+		}
+		OutMessage = Pos;
+		return bHeader;
+	}
+
+	/** Parses the call site of the M_LOG* line: Function: Message (line: Line : File )*/
+	void ParseSite(FMyLogReplayChunk& InOutChunk, const ANSICHAR* const InMessage, const ANSICHAR* const InEnd, FMyLogReplayChunkRecord& InOutRecord)
+	{
+		const ANSICHAR* const Postfix = (InEnd - InMessage > SITE_POSTFIX_LEN && InEnd[-1] == ')') ? FindLast(InMessage, InEnd, SITE_POSTFIX, SITE_POSTFIX_LEN) : nullptr;
+		const ANSICHAR* const FunctionEnd = Postfix ? Find(InMessage, Postfix, ": ", 2) : nullptr;
+		if(FunctionEnd == nullptr)
+		{
+			return;
+		}
+		const ANSICHAR* const LineBegin = Postfix + SITE_POSTFIX_LEN;
+		const ANSICHAR* LineEnd = LineBegin;
+		while(LineEnd < InEnd && IsDigit(*LineEnd))
+		{
+			++LineEnd;
+		}
+		int32 const Line = ParseDigits(LineBegin, FMath::Min<int32>(LineEnd - LineBegin, 9));
+		if(LineEnd == LineBegin || Line < 0)
+		{
+			return;
+		}
+
+		int32 const FunctionLen = FunctionEnd - InMessage;
+		uint64 const Hash = CityHash64WithSeed(InMessage, static_cast<uint32>(FunctionLen), static_cast<uint64>(Line));
+		if(const int32* const Found = InOutChunk.SiteIndices.Find(Hash))
+		{
+			InOutRecord.Record.Site = *Found;
+			return;
+		}
+		InOutRecord.Record.Site = InOutChunk.Sites.Add(FString::Printf(TEXT("%s:%d"), *MakeString(InMessage, FunctionLen), Line));
+		InOutChunk.SiteIndices.Add(Hash, InOutRecord.Record.Site);
+	}
+
+	/** Adds the objects written as name="Name" (the object is added to the record once)*/
+	void ParseObjects(FMyLogReplayChunk& InOutChunk, const ANSICHAR* const InBegin, const ANSICHAR* const InEnd, FMyLogReplayChunkRecord& InOutRecord)
+	{
+		const ANSICHAR* Pos = InBegin;
+		while(const ANSICHAR* const Key = Find(Pos, InEnd, OBJECT_NAME_KEY, OBJECT_NAME_KEY_LEN))
+		{
+			const ANSICHAR* const NameBegin = Key + OBJECT_NAME_KEY_LEN;
+			const ANSICHAR* const NameEnd = Find(NameBegin, InEnd, "\"", 1);
+			if(NameEnd == nullptr)
+			{
+				return;
+			}
+			Pos = NameEnd + 1;
+			// The key must NOT be the end of the other key (e.g. classname=")
+			if(Key > InBegin && IsIdentifierChar(Key[-1]))
+			{
+				continue;
+			}
+
+			uint64 const Hash = CityHash64(NameBegin, static_cast<uint32>(NameEnd - NameBegin));
+			int32 ObjectIndex = INDEX_NONE;
+			if(const int32* const Found = InOutChunk.ObjectIndices.Find(Hash))
+			{
+				ObjectIndex = *Found;
+			}
+			else
+			{
+				ObjectIndex = InOutChunk.Objects.Add(MakeString(NameBegin, NameEnd - NameBegin));
+				InOutChunk.ObjectIndices.Add(Hash, ObjectIndex);
+			}
+
+			bool bAlreadyAdded = false;
+			for(int32 RefIndex = InOutRecord.FirstObject; RefIndex < InOutRecord.FirstObject + InOutRecord.NumObjects; ++RefIndex)
+			{
+				bAlreadyAdded |= (InOutChunk.ObjectRefs[RefIndex] == ObjectIndex);
+			}
+			if( ! bAlreadyAdded )
+			{
+				InOutChunk.ObjectRefs.Add(ObjectIndex);
+				++InOutRecord.NumObjects;
+			}
+		}
+	}
+
+	void ParseChunk(const uint8* const InData, bool const bInFirstChunk, FMyLogReplayChunk& InOutChunk)
+	{
+		const ANSICHAR* const Text = reinterpret_cast<const ANSICHAR*>(InData);
+		InOutChunk.LeadingEnd = InOutChunk.Begin;
+		uint64 LineBegin = InOutChunk.Begin;
+		while(LineBegin < InOutChunk.End)
+		{
+			const ANSICHAR* const NewLine = static_cast<const ANSICHAR*>(memchr(Text + LineBegin, '\n', InOutChunk.End - LineBegin));
+			uint64 const LineEnd = NewLine ? static_cast<uint64>(NewLine - Text) : InOutChunk.End;
+			uint64 const TextEnd = (LineEnd > LineBegin && Text[LineEnd - 1] == '\r') ? LineEnd - 1 : LineEnd;
+
+			FMyLogReplayChunkRecord Record;
+			const ANSICHAR* Message = nullptr;
+			bool const bHeader = ParseHeader(Text + LineBegin, Text + TextEnd, Record, Message);
+			if(bHeader || (bInFirstChunk && InOutChunk.Records.Num() == 0))
+			{
+				Record.Record.Offset = LineBegin;
+				Record.Record.Len = static_cast<uint32>(FMath::Min<uint64>(TextEnd - LineBegin, MAX_uint32));
+				Record.FirstObject = InOutChunk.ObjectRefs.Num();
+				ParseSite(InOutChunk, Message, Text + TextEnd, Record);
+				ParseObjects(InOutChunk, Message, Text + TextEnd, Record);
+				InOutChunk.Records.Add(Record);
+			}
+			else if(InOutChunk.Records.Num() > 0)
+			{
+				FMyLogReplayChunkRecord& LastRecord = InOutChunk.Records.Last();
+				LastRecord.Record.Len = static_cast<uint32>(FMath::Min<uint64>(TextEnd - LastRecord.Record.Offset, MAX_uint32));
+				ParseObjects(InOutChunk, Text + LineBegin, Text + TextEnd, LastRecord);
+			}
+			else
+			{
+				InOutChunk.LeadingEnd = TextEnd;
+				ParseObjects(InOutChunk, Text + LineBegin, Text + TextEnd, InOutChunk.Leading);
+			}
+			LineBegin = LineEnd + 1;
+		}
+	}
+}
+
+FMyLogReplayIndex::FMyLogReplayIndex()
+{
+}
+
+FMyLogReplayIndex::~FMyLogReplayIndex()
+{
+	Reset();
+}
+
+void FMyLogReplayIndex::Reset()
+{
+	// The region must be unmapped before the file is closed
+	MappedRegion.Reset();
+	MappedFile.Reset();
+	LoadedData.Empty();
+	Data = nullptr;
+	Size = 0;
+	Records.Empty();
+	Sites.Empty();
+	SiteRecords.Empty();
+	ObjectNames.Empty();
+	ObjectIndices.Empty();
+	ObjectRecords.Empty();
+	StartDateTime = FDateTime();
+}
+
+bool FMyLogReplayIndex::Open(const FString& InFilename, FString* const OutError)
+{
+	Reset();
+	MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*InFilename));
+	if(MappedFile.IsValid() && MappedFile->GetFileSize() > 0)
+	{
+		MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+	}
+
+	if(MappedRegion.IsValid())
+	{
+		Data = MappedRegion->GetMappedPtr();
+		Size = static_cast<uint64>(MappedRegion->GetMappedSize());
+	}
+	else
+	{
+		// Mapping is NOT supported by the platform (or the file is empty)
+		MappedFile.Reset();
+		if( ! FFileHelper::LoadFileToArray(LoadedData, *InFilename) )
+		{
+			if(OutError)
+			{
+				*OutError = FString::Printf(TEXT("Unable to read \"%s\""), *InFilename);
+			}
+			return false;
+		}
+		Data = LoadedData.GetData();
+		Size = static_cast<uint64>(LoadedData.Num());
+	}
+	Build();
+	return true;
+}
+
+void FMyLogReplayIndex::OpenText(const FString& InText, uint64 const InMinChunkSize)
+{
+	Reset();
+	FTCHARToUTF8 const Text { *InText };
+	LoadedData.Append(reinterpret_cast<const uint8*>(Text.Get()), Text.Length());
+	Data = LoadedData.GetData();
+	Size = static_cast<uint64>(LoadedData.Num());
+	Build(InMinChunkSize);
+}
+
+void FMyLogReplayIndex::Build(uint64 const InMinChunkSize)
+{
+	// The text ends at the first NUL: the preallocated tail of the segment left by the crash is zero-filled
+	if(const void* const Nul = (Size > 0) ? memchr(Data, '\0', Size) : nullptr)
+	{
+		Size = static_cast<uint64>(static_cast<const uint8*>(Nul) - Data);
+	}
+
+	// UTF-8 byte order mark
+	uint64 const Begin = (Size >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF) ? 3 : 0;
+
+	// Chunks start at the line boundaries
+	int32 const NumChunks = static_cast<int32>(FMath::Clamp<uint64>((Size - Begin) / FMath::Max<uint64>(InMinChunkSize, 1), 1, MAX_CHUNKS));
+	TArray<FMyLogReplayChunk> Chunks;
+	Chunks.SetNum(NumChunks);
+	uint64 ChunkBegin = Begin;
+	for(int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	{
+		uint64 ChunkEnd = Size;
+		if(ChunkIndex + 1 < NumChunks)
+		{
+			ChunkEnd = FMath::Max(ChunkBegin, Begin + (Size - Begin) * (ChunkIndex + 1) / NumChunks);
+			const void* const NewLine = (ChunkEnd < Size) ? memchr(Data + ChunkEnd, '\n', Size - ChunkEnd) : nullptr;
+			ChunkEnd = NewLine ? static_cast<uint64>(static_cast<const uint8*>(NewLine) - Data) + 1 : Size;
+		}
+		Chunks[ChunkIndex].Begin = ChunkBegin;
+		Chunks[ChunkIndex].End = ChunkEnd;
+		ChunkBegin = ChunkEnd;
+	}
+
+	const uint8* const ChunkData = Data;
+	ParallelFor(NumChunks, [&Chunks, ChunkData](int32 const InChunkIndex)
+	{
+		ParseChunk(ChunkData, /*bInFirstChunk*/InChunkIndex == 0, Chunks[InChunkIndex]);
+	});
+
+	// Merged in the order of the file, so the record lists stay sorted
+	int32 NumRecords = 0;
+	for(const FMyLogReplayChunk& Chunk : Chunks)
+	{
+		NumRecords += Chunk.Records.Num();
+	}
+	Records.Reserve(NumRecords);
+
+	TMap<FString, int32> SiteIndices;
+	bool bStartFound = false;
+	bool bDateTimes = false;
+	double StartSeconds = 0.0;
+	double PrevSeconds = 0.0;
+	TArray<int32> SiteMap;
+	TArray<int32> ObjectMap;
+	for(const FMyLogReplayChunk& Chunk : Chunks)
+	{
+		SiteMap.Reset();
+		for(const FString& Site : Chunk.Sites)
+		{
+			int32 SiteIndex = INDEX_NONE;
+			if(const int32* const Found = SiteIndices.Find(Site))
+			{
+				SiteIndex = *Found;
+			}
+			else
+			{
+				SiteIndex = Sites.Add(Site);
+				SiteRecords.AddDefaulted();
+				SiteIndices.Add(Site, SiteIndex);
+			}
+			SiteMap.Add(SiteIndex);
+		}
+
+		ObjectMap.Reset();
+		for(const FString& Object : Chunk.Objects)
+		{
+			int32 ObjectIndex = INDEX_NONE;
+			if(const int32* const Found = ObjectIndices.Find(Object))
+			{
+				ObjectIndex = *Found;
+			}
+			else
+			{
+				ObjectIndex = ObjectNames.Add(Object);
+				ObjectRecords.AddDefaulted();
+				ObjectIndices.Add(Object, ObjectIndex);
+			}
+			ObjectMap.Add(ObjectIndex);
+		}
+
+		// Continuation lines of the last record of the previous chunk
+		if(Chunk.LeadingEnd > Chunk.Begin && Records.Num() > 0)
+		{
+			int32 const LastRecordIndex = Records.Num() - 1;
+			FMyLogReplayRecord& LastRecord = Records[LastRecordIndex];
+			LastRecord.Len = static_cast<uint32>(FMath::Min<uint64>(Chunk.LeadingEnd - LastRecord.Offset, MAX_uint32));
+			for(int32 RefIndex = Chunk.Leading.FirstObject; RefIndex < Chunk.Leading.FirstObject + Chunk.Leading.NumObjects; ++RefIndex)
+			{
+				// The object may be already written in the record itself
+				TArray<int32>& LastObjectRecords = ObjectRecords[ObjectMap[Chunk.ObjectRefs[RefIndex]]];
+				if(LastObjectRecords.Num() == 0 || LastObjectRecords.Last() != LastRecordIndex)
+				{
+					LastObjectRecords.Add(LastRecordIndex);
+				}
+			}
+		}
+
+		for(const FMyLogReplayChunkRecord& ChunkRecord : Chunk.Records)
+		{
+			FMyLogReplayRecord Record = ChunkRecord.Record;
+			Record.Site = (Record.Site != INDEX_NONE) ? SiteMap[Record.Site] : INDEX_NONE;
+			if(ChunkRecord.bHasTime && ! bStartFound)
+			{
+				bStartFound = true;
+				bDateTimes = ChunkRecord.bDateTime;
+				StartSeconds = bDateTimes ? Record.Seconds : 0.0;
+				StartDateTime = bDateTimes ? FDateTime(static_cast<int64>(Record.Seconds * ETimespan::TicksPerSecond + 0.5)) : FDateTime();
+			}
+			bool const bTimed = ChunkRecord.bHasTime && ChunkRecord.bDateTime == bDateTimes;
+			Record.Seconds = bTimed ? FMath::Max(Record.Seconds - StartSeconds, PrevSeconds) : PrevSeconds;
+			PrevSeconds = Record.Seconds;
+
+			int32 const RecordIndex = Records.Add(Record);
+			if(Record.Site != INDEX_NONE)
+			{
+				SiteRecords[Record.Site].Add(RecordIndex);
+			}
+			for(int32 RefIndex = ChunkRecord.FirstObject; RefIndex < ChunkRecord.FirstObject + ChunkRecord.NumObjects; ++RefIndex)
+			{
+				ObjectRecords[ObjectMap[Chunk.ObjectRefs[RefIndex]]].Add(RecordIndex);
+			}
+		}
+	}
+}
+
+FString FMyLogReplayIndex::GetRecordText(int32 const InRecordIndex) const
+{
+	const FMyLogReplayRecord& Record = Records[InRecordIndex];
+	return MakeString(reinterpret_cast<const ANSICHAR*>(Data + Record.Offset), static_cast<int32>(Record.Len));
+}
+
+const FString& FMyLogReplayIndex::GetRecordSite(int32 const InRecordIndex) const
+{
+	static FString const NoSite;
+	int32 const SiteIndex = Records[InRecordIndex].Site;
+	return (SiteIndex != INDEX_NONE) ? Sites[SiteIndex] : NoSite;
+}
+
+const TArray<int32>* FMyLogReplayIndex::FindObjectRecords(const FString& InObjectName) const
+{
+	const int32* const ObjectIndex = ObjectIndices.Find(InObjectName);
+	return ObjectIndex ? &ObjectRecords[*ObjectIndex] : nullptr;
+}
+
+void FMyLogReplayIndex::GetTimeRange(const TArray<int32>& InRecordIndices, double const InFromSeconds, double const InToSeconds, int32& OutFirst, int32& OutLast) const
+{
+	auto const GetSeconds = [this](int32 const InRecordIndex) { return Records[InRecordIndex].Seconds; };
+	OutFirst = Algo::LowerBoundBy(InRecordIndices, InFromSeconds, GetSeconds);
+	OutLast = Algo::UpperBoundBy(InRecordIndices, InToSeconds, GetSeconds);
+}
+
+TArray<int32> FMyLogReplayIndex::Query(const FMyLogReplayQuery& InQuery) const
+{
+	TArray<int32> Result;
+
+	// Records of the object are the shortest list, the other filters are checked on them
+	const TArray<int32>* ObjectList = nullptr;
+	if( ! InQuery.Object.IsEmpty() )
+	{
+		ObjectList = FindObjectRecords(InQuery.Object);
+		if(ObjectList == nullptr)
+		{
+			return Result;
+		}
+	}
+
+	TBitArray<> MatchedSites;
+	TArray<int32> SiteList;
+	bool const bFilterSites = ! InQuery.Site.IsEmpty();
+	if(bFilterSites)
+	{
+		MatchedSites.Init(false, Sites.Num());
+		for(int32 SiteIndex = 0; SiteIndex < Sites.Num(); ++SiteIndex)
+		{
+			if(Sites[SiteIndex].MatchesWildcard(InQuery.Site))
+			{
+				MatchedSites[SiteIndex] = true;
+				if(ObjectList == nullptr)
+				{
+					SiteList.Append(SiteRecords[SiteIndex]);
+				}
+			}
+		}
+		SiteList.Sort();
+	}
+
+	auto const Matches = [this, &InQuery, bFilterSites, &MatchedSites](int32 const InRecordIndex)
+	{
+		const FMyLogReplayRecord& Record = Records[InRecordIndex];
+		return (Record.Verbosity <= InQuery.MaxVerbosity) && ( ! bFilterSites || (Record.Site != INDEX_NONE && MatchedSites[Record.Site]) );
+	};
+
+	const TArray<int32>* const List = ObjectList ? ObjectList : (bFilterSites ? &SiteList : nullptr);
+	if(List)
+	{
+		int32 First = 0;
+		int32 Last = 0;
+		GetTimeRange(*List, InQuery.FromSeconds, InQuery.ToSeconds, First, Last);
+		for(int32 ListIndex = First; ListIndex < Last; ++ListIndex)
+		{
+			if(Matches((*List)[ListIndex]))
+			{
+				Result.Add((*List)[ListIndex]);
+			}
+		}
+		return Result;
+	}
+
+	auto const GetSeconds = [](const FMyLogReplayRecord& InRecord) { return InRecord.Seconds; };
+	int32 const First = Algo::LowerBoundBy(Records, InQuery.FromSeconds, GetSeconds);
+	int32 const Last = Algo::UpperBoundBy(Records, InQuery.ToSeconds, GetSeconds);
+	for(int32 RecordIndex = First; RecordIndex < Last; ++RecordIndex)
+	{
+		if(Matches(RecordIndex))
+		{
+			Result.Add(RecordIndex);
+		}
+	}
+	return Result;
+}
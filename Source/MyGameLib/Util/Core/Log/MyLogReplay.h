@@ -0,0 +1,147 @@
+#pragma once
+
+/**
+* Replay of the text logs (the log file or the segments of FMyLogMappedSink).
+*
+* The file is memory-mapped and split into chunks at the line boundaries, the chunks are parsed in parallel.
+* Each record (the line with the header and the continuation lines after it) is indexed by:
+* - the call site of the M_LOG* line ("Function:Line", parsed from the prefix and the postfix of the line);
+* - the names of the objects (name="Name" written by ULogUtilLib::AppendNameAndClass);
+* - the time (the log time prefix: UTC/local date or the seconds since the start).
+*
+* Queries (e.g. all the records of the object between two times) are binary searches over the sorted record lists.
+* @see UMyLogReplayCommandlet
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/DateTime.h"
+#include "Templates/UniquePtr.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/** Record of the log: the line with the header and the continuation lines after it*/
+struct FMyLogReplayRecord
+{
+	/** Offset of the first character of the record in the file*/
+	uint64 Offset = 0;
+
+	/** Length of the record in bytes (without the last line break)*/
+	uint32 Len = 0;
+
+	/** Verbosity parsed from the header (Log if NOT written)*/
+	ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+
+	/** Index of the call site (INDEX_NONE if the record is NOT the M_LOG* line)*/
+	int32 Site = INDEX_NONE;
+
+	/**
+	* Time of the record in seconds since the start of the timeline (@see FMyLogReplayIndex::GetStartDateTime).
+	* Records without the time take the time of the previous record,
+	* time earlier than the previous one is clamped, so the times are never decreasing.
+	*/
+	double Seconds = 0.0;
+};
+
+/** Filter of FMyLogReplayIndex::Query (empty strings match everything)*/
+struct FMyLogReplayQuery
+{
+	/** Exact name of the object (as in name="Name")*/
+	FString Object;
+
+	/** Wildcard of the call site "Function:Line" (e.g. "*ComputeSlideVector*")*/
+	FString Site;
+
+	/** Inclusive range of the time in seconds since the start of the timeline*/
+	double FromSeconds = -MAX_dbl;
+	double ToSeconds = MAX_dbl;
+
+	/** Records with a higher verbosity are skipped*/
+	ELogVerbosity::Type MaxVerbosity = ELogVerbosity::All;
+};
+
+/**
+* Index of the text log.
+*/
+class FMyLogReplayIndex
+{
+public:
+	/** Files are split into the chunks of at least this size to be parsed in parallel*/
+	static constexpr uint64 MIN_CHUNK_SIZE = 16 * 1024 * 1024;
+
+	FMyLogReplayIndex();
+	~FMyLogReplayIndex();
+
+	FMyLogReplayIndex(const FMyLogReplayIndex&) = delete;
+	FMyLogReplayIndex& operator=(const FMyLogReplayIndex&) = delete;
+
+	/**
+	* Maps the file and indexes it (the file is loaded to the memory if the platform does NOT support the mapping).
+	* @returns: false if failed to open the file.
+	*/
+	bool Open(const FString& InFilename, FString* OutError = nullptr);
+
+	/**
+	* Indexes the text (kept by the index as UTF-8).
+	* @param InMinChunkSize: @see MIN_CHUNK_SIZE (smaller chunks are for the tests of the chunk boundaries).
+	*/
+	void OpenText(const FString& InText, uint64 InMinChunkSize = MIN_CHUNK_SIZE);
+
+	/** Number of the records*/
+	int32 Num() const { return Records.Num(); }
+
+	const FMyLogReplayRecord& GetRecord(int32 const InRecordIndex) const { return Records[InRecordIndex]; }
+
+	/** Text of the record (the line and its continuation lines)*/
+	FString GetRecordText(int32 InRecordIndex) const;
+
+	/** Call site of the record in the "Function:Line" form (empty if none)*/
+	const FString& GetRecordSite(int32 InRecordIndex) const;
+
+	int32 NumSites() const { return Sites.Num(); }
+	int32 NumObjects() const { return ObjectNames.Num(); }
+
+	/** Records of the object in the order of the log (nullptr if the object is NOT logged)*/
+	const TArray<int32>* FindObjectRecords(const FString& InObjectName) const;
+
+	/** Time of the first timed record (FDateTime() if the log times are NOT dates)*/
+	const FDateTime& GetStartDateTime() const { return StartDateTime; }
+
+	/** Time of the last record in seconds since the start of the timeline*/
+	double GetDurationSeconds() const { return Records.Num() > 0 ? Records.Last().Seconds : 0.0; }
+
+	/**
+	* Returns indices of the records matching the query in the order of the log.
+	*/
+	TArray<int32> Query(const FMyLogReplayQuery& InQuery) const;
+
+private:
+	void Reset();
+
+	/** Parses the mapped (or loaded) data (up to the first NUL)*/
+	void Build(uint64 InMinChunkSize = MIN_CHUNK_SIZE);
+
+	/** Range of the records between the given times inside of the sorted list of the record indices*/
+	void GetTimeRange(const TArray<int32>& InRecordIndices, double InFromSeconds, double InToSeconds, int32& OutFirst, int32& OutLast) const;
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** Data of the file loaded to the memory (or the indexed text)*/
+	TArray<uint8> LoadedData;
+
+	const uint8* Data = nullptr;
+	uint64 Size = 0;
+
+	TArray<FMyLogReplayRecord> Records;
+
+	/** "Function:Line" by the site index*/
+	TArray<FString> Sites;
+	TArray<TArray<int32>> SiteRecords;
+
+	TArray<FString> ObjectNames;
+	TMap<FString, int32> ObjectIndices;
+	TArray<TArray<int32>> ObjectRecords;
+
+	FDateTime StartDateTime;
+};
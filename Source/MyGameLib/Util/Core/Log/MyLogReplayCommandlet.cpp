@@ -0,0 +1,79 @@
+#include "MyLogReplayCommandlet.h"
+#include "MyLogReplay.h"
+#include "Util/Core/MyDebugMacros.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+
+UMyLogReplayCommandlet::UMyLogReplayCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UMyLogReplayCommandlet::Main(const FString& Params)
+{
+	FString InPath;
+	if( ! FParse::Value(*Params, TEXT("In="), InPath) )
+	{
+		M_LOG_ERROR(TEXT("Usage: -run=MyLogReplay -In=<File.log> [-Object=<Name>] [-Site=<Wildcard>] [-From=<Seconds>] [-To=<Seconds>] [-Out=<File.log>]"));
+		return 1;
+	}
+
+	FMyLogReplayIndex Index;
+	FString Error;
+	double const IndexStartSeconds = FPlatformTime::Seconds();
+	if( ! Index.Open(InPath, &Error) )
+	{
+		M_LOG_ERROR(TEXT("%s"), *Error);
+		return 1;
+	}
+	M_LOG(TEXT("%d records (%d call sites, %d objects, %.3f seconds) indexed from \"%s\" in %.1f ms"), Index.Num(), Index.NumSites(), Index.NumObjects(), Index.GetDurationSeconds(), *InPath, (FPlatformTime::Seconds() - IndexStartSeconds) * 1000.0);
+	M_LOG_IF(Index.GetStartDateTime() != FDateTime(), TEXT("Timeline starts at %s"), *Index.GetStartDateTime().ToString());
+
+	FMyLogReplayQuery Query;
+	FParse::Value(*Params, TEXT("Object="), Query.Object);
+	FParse::Value(*Params, TEXT("Site="), Query.Site);
+	FString Seconds;
+	if(FParse::Value(*Params, TEXT("From="), Seconds))
+	{
+		Query.FromSeconds = FCString::Atod(*Seconds);
+	}
+	if(FParse::Value(*Params, TEXT("To="), Seconds))
+	{
+		Query.ToSeconds = FCString::Atod(*Seconds);
+	}
+
+	double const QueryStartSeconds = FPlatformTime::Seconds();
+	TArray<int32> const RecordIndices = Index.Query(Query);
+	M_LOG(TEXT("%d records matched in %.3f ms"), RecordIndices.Num(), (FPlatformTime::Seconds() - QueryStartSeconds) * 1000.0);
+
+	TArray<FString> Lines;
+	Lines.Reserve(RecordIndices.Num());
+	for(int32 const RecordIndex : RecordIndices)
+	{
+		Lines.Add(FString::Printf(TEXT("[%.3f] %s"), Index.GetRecord(RecordIndex).Seconds, *Index.GetRecordText(RecordIndex)));
+	}
+
+	FString OutPath;
+	if(FParse::Value(*Params, TEXT("Out="), OutPath))
+	{
+		if( ! FFileHelper::SaveStringArrayToFile(Lines, *OutPath) )
+		{
+			M_LOG_ERROR(TEXT("Unable to write \"%s\""), *OutPath);
+			return 1;
+		}
+		M_LOG(TEXT("%d records written to \"%s\""), Lines.Num(), *OutPath);
+	}
+	else
+	{
+		for(const FString& Line : Lines)
+		{
+			M_LOG(TEXT("%s"), *Line);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "MyLogReplayCommandlet.generated.h"
+
+/**
+* Indexes the text log and prints the records matching the query (@see FMyLogReplayIndex).
+*
+* Usage: UE4Editor-Cmd.exe <Project> -run=MyLogReplay -In=<File.log> [-Object=<Name>] [-Site=<Wildcard>] [-From=<Seconds>] [-To=<Seconds>] [-Out=<File.log>]
+* Times are the seconds since the first record of the log, sites are "Function:Line" (e.g. -Site=*ComputeSlideVector*).
+* Without -Out the records are written to the output log.
+*/
+UCLASS()
+class UMyLogReplayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMyLogReplayCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
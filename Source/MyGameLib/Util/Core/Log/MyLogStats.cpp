@@ -0,0 +1,285 @@
+#include "MyLogStats.h"
+#include "MyLogCallSite.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarMyLogStats
+	(
+		TEXT("MyLog.Stats"),
+		0,
+		TEXT("Count the calls, the bytes written and the formatting time of each MyLog call site (0 - off, 1 - on)"),
+		ECVF_Default
+	);
+
+	/** Number of call sites printed by MyLog.Stats.Top by default*/
+	constexpr int32 DEFAULT_DUMP_MAX_SITES = 20;
+
+	double CyclesToMs(uint64 const InCycles)
+	{
+		return static_cast<double>(InCycles) * FPlatformTime::GetSecondsPerCycle64() * 1000.0;
+	}
+
+	FName GetCategoryName(const FLogCategoryBase* const InCategory)
+	{
+		return InCategory ? InCategory->GetCategoryName() : FName(TEXT("None"));
+	}
+
+	template<class SummaryT>
+	void SortSummaries(TArray<SummaryT>& InOutSummaries, EMyLogStatsSortKey const InSortKey)
+	{
+		InOutSummaries.Sort([InSortKey](const SummaryT& InA, const SummaryT& InB)
+		{
+			switch(InSortKey)
+			{
+			case EMyLogStatsSortKey::Bytes:
+				return InA.NumBytes > InB.NumBytes;
+
+			case EMyLogStatsSortKey::Time:
+				return InA.FormatMs > InB.FormatMs;
+
+			default:
+				return InA.NumCalls > InB.NumCalls;
+			}
+		});
+	}
+
+	/**
+	* Parses the sort key argument (calls by default).
+	*/
+	EMyLogStatsSortKey ParseSortKey(const TArray<FString>& InArgs, int32 const InArgIndex, FOutputDevice& InAr)
+	{
+		EMyLogStatsSortKey SortKey = EMyLogStatsSortKey::Calls;
+		if(InArgs.IsValidIndex(InArgIndex) && ! LexTryParseString(SortKey, *InArgs[InArgIndex]) )
+		{
+			InAr.Logf(ELogVerbosity::Warning, TEXT("Unknown sort key \"%s\" (Calls, Bytes or Time expected), sorting by calls"), *InArgs[InArgIndex]);
+		}
+		return SortKey;
+	}
+
+	void SaveCsvCommand(const TArray<FString>& InArgs, FOutputDevice& InAr)
+	{
+		FString const Filename = (InArgs.Num() > 0) ? InArgs[0] : FMyLogStats::GetDefaultCsvFilename();
+		if( ! FMyLogStats::SaveCsv(Filename) )
+		{
+			InAr.Logf(ELogVerbosity::Error, TEXT("Failed to write MyLog stats to \"%s\""), *Filename);
+			return;
+		}
+		InAr.Logf(TEXT("MyLog stats written to \"%s\""), *Filename);
+	}
+
+	/**
+	* MyLog.Stats.Top [Count] [SortKey]: the number and the sort key are told apart, so either may be omitted or go first.
+	*/
+	void DumpTopCommand(const TArray<FString>& InArgs, FOutputDevice& InAr)
+	{
+		int32 MaxSites = DEFAULT_DUMP_MAX_SITES;
+		EMyLogStatsSortKey SortKey = EMyLogStatsSortKey::Calls;
+		for(int32 ArgIndex = 0; ArgIndex < InArgs.Num(); ++ArgIndex)
+		{
+			if(InArgs[ArgIndex].IsNumeric())
+			{
+				MaxSites = FCString::Atoi(*InArgs[ArgIndex]);
+			}
+			else
+			{
+				SortKey = ParseSortKey(InArgs, ArgIndex, InAr);
+			}
+		}
+		FMyLogStats::DumpSites(InAr, MaxSites, SortKey);
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const TopCommand
+	(
+		TEXT("MyLog.Stats.Top"),
+		TEXT("Prints the most expensive log call sites (optional arguments: number of sites, sort key: Calls, Bytes or Time, e.g. \"MyLog.Stats.Top Bytes 10\")"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			DumpTopCommand(InArgs, InAr);
+		})
+	);
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const CategoriesCommand
+	(
+		TEXT("MyLog.Stats.Categories"),
+		TEXT("Prints the log stats merged by category (optional argument: sort key: Calls, Bytes or Time)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			FMyLogStats::DumpCategories(InAr, ParseSortKey(InArgs, 0, InAr));
+		})
+	);
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const CsvCommand
+	(
+		TEXT("MyLog.Stats.Csv"),
+		TEXT("Writes the stats of the log call sites to the given CSV file (or <ProjectLogDir>/<ProjectName>-LogStats-<DateTime>.csv)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			SaveCsvCommand(InArgs, InAr);
+		})
+	);
+
+	FAutoConsoleCommand const ResetCommand
+	(
+		TEXT("MyLog.Stats.Reset"),
+		TEXT("Clears the stats of the log call sites"),
+		FConsoleCommandDelegate::CreateStatic(&FMyLogStats::Reset)
+	);
+}
+
+const TCHAR* LexToString(EMyLogStatsSortKey const InKey)
+{
+	switch(InKey)
+	{
+	case EMyLogStatsSortKey::Calls:
+		return TEXT("Calls");
+
+	case EMyLogStatsSortKey::Bytes:
+		return TEXT("Bytes");
+
+	case EMyLogStatsSortKey::Time:
+		return TEXT("Time");
+
+	default:
+		break;
+	}
+	return TEXT("Unknown");
+}
+
+bool LexTryParseString(EMyLogStatsSortKey& OutKey, const TCHAR* const InString)
+{
+	for(EMyLogStatsSortKey const Key : { EMyLogStatsSortKey::Calls, EMyLogStatsSortKey::Bytes, EMyLogStatsSortKey::Time })
+	{
+		if(FCString::Stricmp(InString, LexToString(Key)) == 0)
+		{
+			OutKey = Key;
+			return true;
+		}
+	}
+	return false;
+}
+
+// ~FMyLogStats Begin
+bool FMyLogStats::IsEnabled()
+{
+	return CVarMyLogStats.GetValueOnAnyThread() != 0;
+}
+
+void FMyLogStats::AddCall(const FMyLogCallSite& InSite, const FLogCategoryBase& InCategory, uint64 const InFormatCycles)
+{
+	FMyLogSiteCounters& Counters = InSite.GetCounters();
+	Counters.NumCalls.fetch_add(1, std::memory_order_relaxed);
+	Counters.FormatCycles.fetch_add(InFormatCycles, std::memory_order_relaxed);
+	Counters.Category.store(&InCategory, std::memory_order_relaxed);
+}
+
+void FMyLogStats::AddBytes(const FMyLogCallSite& InSite, int32 const InNumBytes)
+{
+	InSite.GetCounters().NumBytes.fetch_add(static_cast<uint64>(InNumBytes), std::memory_order_relaxed);
+}
+
+TArray<FMyLogSiteStatsSummary> FMyLogStats::GetSiteSummaries(EMyLogStatsSortKey const InSortKey)
+{
+	TArray<FMyLogSiteStatsSummary> Summaries;
+	for(const FMyLogCallSite* Site = FMyLogCallSite::GetFirst(); Site; Site = Site->GetNext())
+	{
+		const FMyLogSiteCounters& Counters = Site->GetCounters();
+		uint64 const NumCalls = Counters.NumCalls.load(std::memory_order_relaxed);
+		if(NumCalls == 0)
+		{
+			continue;
+		}
+		FMyLogSiteStatsSummary& Summary = Summaries.AddDefaulted_GetRef();
+		Summary.Site = Site;
+		Summary.Category = GetCategoryName(Counters.Category.load(std::memory_order_relaxed));
+		Summary.NumCalls = NumCalls;
+		Summary.NumBytes = Counters.NumBytes.load(std::memory_order_relaxed);
+		Summary.FormatMs = CyclesToMs(Counters.FormatCycles.load(std::memory_order_relaxed));
+	}
+	SortSummaries(Summaries, InSortKey);
+	return Summaries;
+}
+
+TArray<FMyLogCategoryStatsSummary> FMyLogStats::GetCategorySummaries(EMyLogStatsSortKey const InSortKey)
+{
+	TMap<FName, FMyLogCategoryStatsSummary> SummariesByCategory;
+	for(const FMyLogSiteStatsSummary& SiteSummary : GetSiteSummaries(EMyLogStatsSortKey::Calls))
+	{
+		FMyLogCategoryStatsSummary& Summary = SummariesByCategory.FindOrAdd(SiteSummary.Category);
+		Summary.Category = SiteSummary.Category;
+		++Summary.NumSites;
+		Summary.NumCalls += SiteSummary.NumCalls;
+		Summary.NumBytes += SiteSummary.NumBytes;
+		Summary.FormatMs += SiteSummary.FormatMs;
+	}
+	TArray<FMyLogCategoryStatsSummary> Summaries;
+	SummariesByCategory.GenerateValueArray(Summaries);
+	SortSummaries(Summaries, InSortKey);
+	return Summaries;
+}
+
+void FMyLogStats::DumpSites(FOutputDevice& InAr, int32 const InMaxSites, EMyLogStatsSortKey const InSortKey)
+{
+	TArray<FMyLogSiteStatsSummary> const Summaries = GetSiteSummaries(InSortKey);
+	InAr.Logf(TEXT("%10s %12s %12s %10s  %-16s Call site (sorted by %s)"), TEXT("Calls"), TEXT("Bytes"), TEXT("Format(ms)"), TEXT("Avg(us)"), TEXT("Category"), LexToString(InSortKey));
+	int32 const NumPrinted = FMath::Min(Summaries.Num(), FMath::Max(InMaxSites, 0));
+	for(int32 SummaryIndex = 0; SummaryIndex < NumPrinted; ++SummaryIndex)
+	{
+		const FMyLogSiteStatsSummary& S = Summaries[SummaryIndex];
+		InAr.Logf(TEXT("%10llu %12llu %12.3f %10.2f  %-16s %s%s"),
+			S.NumCalls, S.NumBytes, S.FormatMs, S.FormatMs * 1000.0 / S.NumCalls, *S.Category.ToString(), *S.Site->Prefix, *S.Site->Postfix);
+	}
+	InAr.Logf(TEXT("%d of %d call sites printed"), NumPrinted, Summaries.Num());
+}
+
+void FMyLogStats::DumpCategories(FOutputDevice& InAr, EMyLogStatsSortKey const InSortKey)
+{
+	TArray<FMyLogCategoryStatsSummary> const Summaries = GetCategorySummaries(InSortKey);
+	InAr.Logf(TEXT("%10s %12s %12s %8s  Category (sorted by %s)"), TEXT("Calls"), TEXT("Bytes"), TEXT("Format(ms)"), TEXT("Sites"), LexToString(InSortKey));
+	for(const FMyLogCategoryStatsSummary& S : Summaries)
+	{
+		InAr.Logf(TEXT("%10llu %12llu %12.3f %8d  %s"), S.NumCalls, S.NumBytes, S.FormatMs, S.NumSites, *S.Category.ToString());
+	}
+}
+
+FString FMyLogStats::ToCsv()
+{
+	TArray<FMyLogSiteStatsSummary> const Summaries = GetSiteSummaries(EMyLogStatsSortKey::Calls);
+	FString Csv { TEXT("Function,File,Line,Category,Calls,Bytes,FormatMs\n") };
+	for(const FMyLogSiteStatsSummary& S : Summaries)
+	{
+		// Function and file names never contain quotes, so quoting is enough
+		Csv += FString::Printf(TEXT("\"%s\",\"%s\",%d,%s,%llu,%llu,%.6f\n"),
+			ANSI_TO_TCHAR(S.Site->Function), ANSI_TO_TCHAR(S.Site->File), S.Site->Line, *S.Category.ToString(), S.NumCalls, S.NumBytes, S.FormatMs);
+	}
+	return Csv;
+}
+
+bool FMyLogStats::SaveCsv(const FString& InFilename)
+{
+	return FFileHelper::SaveStringToFile(ToCsv(), *InFilename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+FString FMyLogStats::GetDefaultCsvFilename()
+{
+	return FPaths::Combine(FPaths::ProjectLogDir(), FString::Printf(TEXT("%s-LogStats-%s.csv"), FApp::GetProjectName(), *FDateTime::Now().ToString()));
+}
+
+void FMyLogStats::Reset()
+{
+	for(const FMyLogCallSite* Site = FMyLogCallSite::GetFirst(); Site; Site = Site->GetNext())
+	{
+		FMyLogSiteCounters& Counters = Site->GetCounters();
+		Counters.NumCalls.store(0, std::memory_order_relaxed);
+		Counters.NumBytes.store(0, std::memory_order_relaxed);
+		Counters.FormatCycles.store(0, std::memory_order_relaxed);
+	}
+}
+// ~FMyLogStats End
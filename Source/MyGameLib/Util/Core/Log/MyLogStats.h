@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+struct FMyLogCallSite;
+class FOutputDevice;
+
+/**
+* Cost counters of the call site (updated only when MyLog.Stats is on).
+*/
+struct FMyLogSiteCounters
+{
+	/** Number of the formatted lines*/
+	std::atomic<uint64> NumCalls { 0 };
+
+	/** Number of the characters written to the log devices (bytes of the UTF-8 log for the ASCII text)*/
+	std::atomic<uint64> NumBytes { 0 };
+
+	/** Time spent formatting the lines*/
+	std::atomic<uint64> FormatCycles { 0 };
+
+	/** Category the lines are logged to*/
+	std::atomic<const FLogCategoryBase*> Category { nullptr };
+};
+
+/** What the stats are sorted by*/
+enum class EMyLogStatsSortKey : uint8
+{
+	Calls,
+	Bytes,
+	Time
+};
+
+const TCHAR* LexToString(EMyLogStatsSortKey InKey);
+
+/**
+* @returns: false if the string is not the name of the key (the key is left unchanged).
+*/
+bool LexTryParseString(EMyLogStatsSortKey& OutKey, const TCHAR* InString);
+
+struct FMyLogSiteStatsSummary
+{
+	const FMyLogCallSite* Site = nullptr;
+	FName Category;
+	uint64 NumCalls = 0;
+	uint64 NumBytes = 0;
+	double FormatMs = 0.0;
+};
+
+struct FMyLogCategoryStatsSummary
+{
+	FName Category;
+	int32 NumSites = 0;
+	uint64 NumCalls = 0;
+	uint64 NumBytes = 0;
+	double FormatMs = 0.0;
+};
+
+/**
+* Cost accounting of the log call sites.
+*
+* When enabled by MyLog.Stats, each line of the M_LOG* macros (and so of ULogUtilLib functions, that log by the macros)
+* adds the time spent formatting and the number of characters written to the counters of its call site.
+* Counters are the relaxed atomics inside the call site, so no lock and no lookup is involved.
+*
+* Limitations:
+* - lines of the ULogUtilLib functions (LogFloatC, LogVectorC...) are accounted to the call site inside of the function
+* (LogUtilLib.cpp), NOT to its caller: log by M_LOG_VALUE (or the M_LOG* macros) to see the cost of each caller;
+* - only the formatting is timed: the arguments (e.g. *Object->GetName()) are evaluated before the line is formatted,
+* so their cost is NOT counted.
+*
+* Printed by MyLog.Stats.Top and MyLog.Stats.Categories, written by MyLog.Stats.Csv, cleared by MyLog.Stats.Reset.
+*/
+class FMyLogStats
+{
+public:
+	/** Is accounting enabled by the console variable*/
+	static bool IsEnabled();
+
+	/** Accounts the formatted line*/
+	static void AddCall(const FMyLogCallSite& InSite, const FLogCategoryBase& InCategory, uint64 InFormatCycles);
+
+	/** Accounts the line written to the log devices*/
+	static void AddBytes(const FMyLogCallSite& InSite, int32 InNumBytes);
+
+	/**
+	* @returns: call sites with at least one call (sorted descending).
+	*/
+	static TArray<FMyLogSiteStatsSummary> GetSiteSummaries(EMyLogStatsSortKey InSortKey);
+
+	/**
+	* Stats of the sites merged by category (sorted descending).
+	*/
+	static TArray<FMyLogCategoryStatsSummary> GetCategorySummaries(EMyLogStatsSortKey InSortKey);
+
+	/** Prints the most expensive call sites*/
+	static void DumpSites(FOutputDevice& InAr, int32 InMaxSites, EMyLogStatsSortKey InSortKey);
+
+	/** Prints the categories*/
+	static void DumpCategories(FOutputDevice& InAr, EMyLogStatsSortKey InSortKey);
+
+	/**
+	* CSV of the call sites: Function,File,Line,Category,Calls,Bytes,FormatMs (sorted by the calls).
+	*/
+	static FString ToCsv();
+
+	/** @returns: false if failed to write*/
+	static bool SaveCsv(const FString& InFilename);
+
+	/** <ProjectLogDir>/<ProjectName>-LogStats-<DateTime>.csv*/
+	static FString GetDefaultCsvFilename();
+
+	/** Clears the counters of all the call sites*/
+	static void Reset();
+};
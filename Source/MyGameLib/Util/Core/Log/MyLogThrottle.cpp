@@ -0,0 +1,149 @@
+#include "MyLogThrottle.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/OutputDevice.h"
+
+namespace
+{
+	std::atomic<FMyLogThrottle*> GFirstThrottle { nullptr };
+
+	uint64 GetCyclesPerSecond()
+	{
+		static uint64 const CyclesPerSecond = static_cast<uint64>(1.0 / FPlatformTime::GetSecondsPerCycle64());
+		return CyclesPerSecond;
+	}
+
+	void ListThrottles(const TArray<FString>& InArgs, FOutputDevice& InAr)
+	{
+		bool const bOnlySuppressed = ! InArgs.Contains(TEXT("All"));
+		int32 NumListed = 0;
+		for(const FMyLogThrottle* Throttle = FMyLogThrottle::GetFirst(); Throttle; Throttle = Throttle->GetNext())
+		{
+			if(bOnlySuppressed && Throttle->GetNumSuppressed() == 0)
+			{
+				continue;
+			}
+			InAr.Logf(TEXT("%s (line: %d : %s ) %s %u: %u emitted, %u suppressed"),
+				ANSI_TO_TCHAR(Throttle->GetFunction()), Throttle->GetLine(), ANSI_TO_TCHAR(Throttle->GetFile()),
+				LexToString(Throttle->GetMode()), Throttle->GetLimit(), Throttle->GetNumEmitted(), Throttle->GetNumSuppressed());
+			++NumListed;
+		}
+		InAr.Logf(TEXT("%d throttled call sites listed"), NumListed);
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const ListThrottlesCommand
+	(
+		TEXT("MyLog.Throttle.List"),
+		TEXT("Lists the throttled log call sites with the number of suppressed lines (pass \"All\" to list the sites without suppressed lines too)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			ListThrottles(InArgs, InAr);
+		})
+	);
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const ResetThrottlesCommand
+	(
+		TEXT("MyLog.Throttle.Reset"),
+		TEXT("Resets all throttled log call sites: the FirstN sites log again, the counters are cleared"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>&, UWorld*, FOutputDevice& InAr)
+		{
+			FMyLogThrottle::ResetAll();
+			InAr.Logf(TEXT("Throttled call sites reset"));
+		})
+	);
+}
+
+FMyLogThrottle::FMyLogThrottle(const ANSICHAR* const InFunction, const ANSICHAR* const InFile, int32 const InLine, EMyLogThrottleMode const InMode, uint32 const InLimit) :
+	Function ( InFunction )
+,	File ( InFile )
+,	Line ( InLine )
+,	Mode ( InMode )
+,	Limit ( InLimit )
+{
+	checkf(Mode != EMyLogThrottleMode::EveryNth || Limit > 0, TEXT("Every N-th throttle must have positive N in %s"), TEXT(__FUNCTION__));
+	WindowStartCycles.store(FPlatformTime::Cycles64(), std::memory_order_relaxed);
+	Next = GFirstThrottle.load(std::memory_order_relaxed);
+	while( ! GFirstThrottle.compare_exchange_weak(Next, this, std::memory_order_release, std::memory_order_relaxed) )
+	{
+	}
+}
+
+const FMyLogThrottle* FMyLogThrottle::GetFirst()
+{
+	return GFirstThrottle.load(std::memory_order_acquire);
+}
+
+bool FMyLogThrottle::ShouldLog()
+{
+	bool bPassed = false;
+	switch(Mode)
+	{
+	case EMyLogThrottleMode::FirstN:
+		// Once the limit is reached the counter is only read
+		bPassed = Count.load(std::memory_order_relaxed) < Limit && Count.fetch_add(1, std::memory_order_relaxed) < Limit;
+		break;
+
+	case EMyLogThrottleMode::EveryNth:
+		bPassed = (Count.fetch_add(1, std::memory_order_relaxed) % Limit) == 0;
+		break;
+
+	case EMyLogThrottleMode::PerSecond:
+	{
+		uint64 const NowCycles = FPlatformTime::Cycles64();
+		uint64 WindowStart = WindowStartCycles.load(std::memory_order_relaxed);
+		if(NowCycles - WindowStart >= GetCyclesPerSecond())
+		{
+			// Only the thread that moved the window resets the count
+			if(WindowStartCycles.compare_exchange_strong(WindowStart, NowCycles, std::memory_order_relaxed))
+			{
+				Count.store(0, std::memory_order_relaxed);
+			}
+		}
+		bPassed = Count.fetch_add(1, std::memory_order_relaxed) < Limit;
+		break;
+	}
+
+	default:
+		checkNoEntry();
+	}
+
+	(bPassed ? NumEmitted : NumSuppressed).fetch_add(1, std::memory_order_relaxed);
+	return bPassed;
+}
+
+void FMyLogThrottle::Reset()
+{
+	Count.store(0, std::memory_order_relaxed);
+	WindowStartCycles.store(FPlatformTime::Cycles64(), std::memory_order_relaxed);
+	NumEmitted.store(0, std::memory_order_relaxed);
+	NumSuppressed.store(0, std::memory_order_relaxed);
+}
+
+void FMyLogThrottle::ResetAll()
+{
+	for(FMyLogThrottle* Throttle = GFirstThrottle.load(std::memory_order_acquire); Throttle; Throttle = Throttle->Next)
+	{
+		Throttle->Reset();
+	}
+}
+
+const TCHAR* LexToString(EMyLogThrottleMode const InMode)
+{
+	switch(InMode)
+	{
+	case EMyLogThrottleMode::PerSecond:
+		return TEXT("PerSecond");
+
+	case EMyLogThrottleMode::EveryNth:
+		return TEXT("EveryNth");
+
+	case EMyLogThrottleMode::FirstN:
+		return TEXT("FirstN");
+
+	default:
+		break;
+	}
+	checkNoEntry();
+	return TEXT("Unknown");
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Util/Core/MyDebugMacros.h"
+#include <atomic>
+
+/**
+* How the throttled M_LOG* macros limit the call site.
+*/
+enum class EMyLogThrottleMode : uint8
+{
+	/** At most Limit lines per second*/
+	PerSecond = 0,
+
+	/** Every Limit-th hit (the first hit is logged)*/
+	EveryNth,
+
+	/** Only the first Limit hits*/
+	FirstN
+};
+
+/**
+* Throttling state of the call site (static per call site, @see M_LOG_THROTTLE_PASSED).
+* Counters are relaxed atomics: the limits are approximate under contention, but never lock.
+*/
+class FMyLogThrottle
+{
+public:
+	FMyLogThrottle(const ANSICHAR* InFunction, const ANSICHAR* InFile, int32 InLine, EMyLogThrottleMode InMode, uint32 InLimit);
+
+	/**
+	* Counts the hit as emitted or suppressed.
+	* @returns: true if the line should be logged.
+	*/
+	bool ShouldLog();
+
+	/** Starts over: clears the counter of the mode and the statistics (as if never hit)*/
+	void Reset();
+
+	/** Resets all registered throttles (@see MyLog.Throttle.Reset)*/
+	static void ResetAll();
+
+	const ANSICHAR* GetFunction() const { return Function; }
+	const ANSICHAR* GetFile() const { return File; }
+	int32 GetLine() const { return Line; }
+	EMyLogThrottleMode GetMode() const { return Mode; }
+	uint32 GetLimit() const { return Limit; }
+	uint32 GetNumEmitted() const { return NumEmitted.load(std::memory_order_relaxed); }
+	uint32 GetNumSuppressed() const { return NumSuppressed.load(std::memory_order_relaxed); }
+	uint32 GetNumHits() const { return GetNumEmitted() + GetNumSuppressed(); }
+
+	/** Next registered throttle (throttles are never unregistered)*/
+	const FMyLogThrottle* GetNext() const { return Next; }
+
+	/** First registered throttle*/
+	static const FMyLogThrottle* GetFirst();
+
+private:
+	const ANSICHAR* Function;
+	const ANSICHAR* File;
+	int32 Line;
+	EMyLogThrottleMode Mode;
+	uint32 Limit;
+
+	/** Statistics only (the decision is made by the counter of the mode)*/
+	std::atomic<uint32> NumEmitted { 0 };
+	std::atomic<uint32> NumSuppressed { 0 };
+
+	/**
+	* Counter of the mode:
+	* FirstN: hits up to the limit (saturated, so it never wraps to pass again);
+	* EveryNth: all hits;
+	* PerSecond: hits in the current one-second window.
+	*/
+	std::atomic<uint32> Count { 0 };
+
+	/** PerSecond: start of the current one-second window*/
+	std::atomic<uint64> WindowStartCycles { 0 };
+
+	FMyLogThrottle* Next = nullptr;
+};
+
+const TCHAR* LexToString(EMyLogThrottleMode InMode);
+
+/**
+* Counts the hit of the throttle of this call site.
+* @returns: true if the line should be logged.
+*
+* @param Mode: EMyLogThrottleMode
+* @param Limit: number of lines per second, N for every N-th, or number of first hits.
+*/
+#define M_LOG_THROTTLE_PASSED(Mode, Limit) (M_LOG_THROTTLE(Mode, Limit).ShouldLog())
+
+/**
+* The throttle of this call site (FMyLogThrottle&), created on the first hit.
+*/
+#define M_LOG_THROTTLE(Mode, Limit)\
+	([&](const ANSICHAR* InMyLogFunction) -> FMyLogThrottle&\
+	{\
+		static FMyLogThrottle MyLogThrottle { InMyLogFunction, __FILE__, __LINE__, (Mode), static_cast<uint32>(Limit) };\
+		return MyLogThrottle;\
+	})(__FUNCTION__)
+
+/**
+* Counts the hit only if the category is active at the level
+* (so the lines suppressed by the verbosity are counted neither as emitted nor as suppressed).
+*/
+#define M_LOG_THROTTLE_PASSED_IF_ACTIVE(LogCategory, LogLevel, Mode, Limit) (M_LOG_IS_ACTIVE(LogCategory, LogLevel) && M_LOG_THROTTLE_PASSED(Mode, Limit))
+
+// ~Throttled logging macros Begin
+#define M_LOG_PER_SECOND(MaxPerSecond, FormatString, ...) M_LOG_IF(M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Log, EMyLogThrottleMode::PerSecond, MaxPerSecond), FormatString, ##__VA_ARGS__)
+#define M_LOG_EVERY_NTH(N, FormatString, ...) M_LOG_IF(M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Log, EMyLogThrottleMode::EveryNth, N), FormatString, ##__VA_ARGS__)
+#define M_LOG_FIRST_N(N, FormatString, ...) M_LOG_IF(M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Log, EMyLogThrottleMode::FirstN, N), FormatString, ##__VA_ARGS__)
+
+#define M_LOG_WARN_PER_SECOND(MaxPerSecond, FormatString, ...) M_LOG_WARN_IF(M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Warning, EMyLogThrottleMode::PerSecond, MaxPerSecond), FormatString, ##__VA_ARGS__)
+#define M_LOG_WARN_EVERY_NTH(N, FormatString, ...) M_LOG_WARN_IF(M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Warning, EMyLogThrottleMode::EveryNth, N), FormatString, ##__VA_ARGS__)
+#define M_LOG_WARN_FIRST_N(N, FormatString, ...) M_LOG_WARN_IF(M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Warning, EMyLogThrottleMode::FirstN, N), FormatString, ##__VA_ARGS__)
+
+#define M_LOG_ERROR_PER_SECOND(MaxPerSecond, FormatString, ...) M_LOG_ERROR_IF(M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Error, EMyLogThrottleMode::PerSecond, MaxPerSecond), FormatString, ##__VA_ARGS__)
+#define M_LOG_ERROR_EVERY_NTH(N, FormatString, ...) M_LOG_ERROR_IF(M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Error, EMyLogThrottleMode::EveryNth, N), FormatString, ##__VA_ARGS__)
+#define M_LOG_ERROR_FIRST_N(N, FormatString, ...) M_LOG_ERROR_IF(M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Error, EMyLogThrottleMode::FirstN, N), FormatString, ##__VA_ARGS__)
+
+#define M_LOGFUNC_PER_SECOND(MaxPerSecond) M_LOGFUNC_IF(M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Log, EMyLogThrottleMode::PerSecond, MaxPerSecond))
+#define M_LOGFUNC_EVERY_NTH(N) M_LOGFUNC_IF(M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Log, EMyLogThrottleMode::EveryNth, N))
+#define M_LOGFUNC_FIRST_N(N) M_LOGFUNC_IF(M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Log, EMyLogThrottleMode::FirstN, N))
+// ~Throttled logging macros End
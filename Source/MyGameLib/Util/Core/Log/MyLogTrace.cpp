@@ -0,0 +1,163 @@
+#include "MyLogTrace.h"
+#include "MyLogProfiler.h"
+#include "MyLogCallSite.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/ThreadManager.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	/** Reserved characters per event when building the JSON*/
+	constexpr int32 RESERVED_LEN_PER_EVENT = 96;
+
+	FString EscapeJson(const FString& InText)
+	{
+		FString Escaped;
+		Escaped.Reserve(InText.Len());
+		for(TCHAR const Char : InText)
+		{
+			switch(Char)
+			{
+			case TEXT('"'):
+				Escaped += TEXT("\\\"");
+				break;
+
+			case TEXT('\\'):
+				Escaped += TEXT("\\\\");
+				break;
+
+			default:
+				if(Char < 0x20)
+				{
+					Escaped += FString::Printf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+				}
+				else
+				{
+					Escaped.AppendChar(Char);
+				}
+				break;
+			}
+		}
+		return Escaped;
+	}
+
+	void StartTrace(const TArray<FString>& /*InArgs*/, FOutputDevice& InAr)
+	{
+		FMyLogProfiler::StartCapture();
+		InAr.Logf(TEXT("MyLog trace capture started"));
+	}
+
+	void StopTrace(const TArray<FString>& InArgs, FOutputDevice& InAr)
+	{
+		if( ! FMyLogProfiler::IsCapturing() )
+		{
+			InAr.Logf(TEXT("MyLog trace capture is NOT started (use MyLog.Trace.Start)"));
+			return;
+		}
+		FMyLogTraceCapture const Capture = FMyLogProfiler::StopCapture();
+		FString const Filename = (InArgs.Num() > 0) ? InArgs[0] : MyLogTrace::GetDefaultTraceFilename();
+		if( ! MyLogTrace::SaveChromeTrace(Capture, Filename) )
+		{
+			InAr.Logf(ELogVerbosity::Error, TEXT("Failed to write MyLog trace to \"%s\""), *Filename);
+			return;
+		}
+		InAr.Logf(TEXT("MyLog trace of %d events written to \"%s\" (%llu events dropped)"), Capture.Events.Num(), *Filename, Capture.NumDropped);
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const StartTraceCommand
+	(
+		TEXT("MyLog.Trace.Start"),
+		TEXT("Starts capturing the scopes of M_LOGFUNC*/M_LOGBLOCK* on all threads"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			StartTrace(InArgs, InAr);
+		})
+	);
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const StopTraceCommand
+	(
+		TEXT("MyLog.Trace.Stop"),
+		TEXT("Stops capturing and writes the Chrome trace JSON (optional argument: file name, project log directory by default)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			StopTrace(InArgs, InAr);
+		})
+	);
+}
+
+namespace MyLogTrace
+{
+	FString ToChromeTraceJson(const FMyLogTraceCapture& InCapture)
+	{
+		double const MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1.0e6;
+		TMap<const FMyLogCallSite*, FString> EscapedNames;
+		TMap<uint32, int32> ThreadDepths;
+
+		FString Json;
+		Json.Reserve(InCapture.Events.Num() * RESERVED_LEN_PER_EVENT);
+		Json += TEXT("{\"traceEvents\":[\n");
+		bool bFirstEvent = true;
+		for(const FMyLogTraceEvent& Event : InCapture.Events)
+		{
+			int32& Depth = ThreadDepths.FindOrAdd(Event.ThreadId);
+			if( ! Event.bEnter && Depth == 0 )
+			{
+				// The scope was entered before the capture started
+				continue;
+			}
+			Depth += Event.bEnter ? 1 : -1;
+
+			FString* pName = EscapedNames.Find(Event.Site);
+			if(pName == nullptr)
+			{
+				pName = &EscapedNames.Add(Event.Site, EscapeJson(ANSI_TO_TCHAR(Event.Site->Function)));
+			}
+			double const Timestamp = static_cast<double>(Event.Cycles - InCapture.StartCycles) * MicrosecondsPerCycle;
+			if( ! bFirstEvent )
+			{
+				Json += TEXT(",\n");
+			}
+			bFirstEvent = false;
+			if(Event.bEnter)
+			{
+				Json += FString::Printf(TEXT("{\"name\":\"%s\",\"cat\":\"MyLog\",\"ph\":\"B\",\"ts\":%.3f,\"pid\":0,\"tid\":%u,\"args\":{\"line\":%d}}"),
+					**pName, Timestamp, Event.ThreadId, Event.Site->Line);
+			}
+			else
+			{
+				Json += FString::Printf(TEXT("{\"ph\":\"E\",\"ts\":%.3f,\"pid\":0,\"tid\":%u}"), Timestamp, Event.ThreadId);
+			}
+		}
+
+		// Names of the threads as metadata events
+		for(const TPair<uint32, int32>& Pair : ThreadDepths)
+		{
+			FString const ThreadName = FThreadManager::GetThreadName(Pair.Key);
+			if( ! bFirstEvent )
+			{
+				Json += TEXT(",\n");
+			}
+			bFirstEvent = false;
+			Json += FString::Printf(TEXT("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"%s\"}}"),
+				Pair.Key, *EscapeJson(ThreadName.IsEmpty() ? FString::Printf(TEXT("Thread %u"), Pair.Key) : ThreadName));
+		}
+		Json += TEXT("\n],\"displayTimeUnit\":\"ms\"}\n");
+		return Json;
+	}
+
+	bool SaveChromeTrace(const FMyLogTraceCapture& InCapture, const FString& InFilename)
+	{
+		return FFileHelper::SaveStringToFile(ToChromeTraceJson(InCapture), *InFilename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	FString GetDefaultTraceFilename()
+	{
+		return FPaths::Combine(FPaths::ProjectLogDir(), FString::Printf(TEXT("%s-%s.trace.json"), FApp::GetProjectName(), *FDateTime::Now().ToString()));
+	}
+} // MyLogTrace
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FMyLogTraceCapture;
+
+/**
+* Export of the captured scopes (M_LOGFUNC*, M_LOGBLOCK*) in the Chrome Trace Event format
+* (opened by chrome://tracing, Perfetto UI and other trace viewers).
+*
+* Captured by MyLog.Trace.Start/MyLog.Trace.Stop console commands (@see FMyLogProfiler::StartCapture),
+* the file is saved to the project log directory by default.
+*/
+namespace MyLogTrace
+{
+	/**
+	* Converts the capture into the Chrome Trace Event JSON:
+	* nested begin/end events per thread named by the function of the call site, thread names as metadata.
+	* Exits of the scopes entered before the capture are skipped.
+	*/
+	FString ToChromeTraceJson(const FMyLogTraceCapture& InCapture);
+
+	/**
+	* @returns: false if the file cannot be written.
+	*/
+	bool SaveChromeTrace(const FMyLogTraceCapture& InCapture, const FString& InFilename);
+
+	/** Project log directory/<Project>-<Date>.trace.json*/
+	FString GetDefaultTraceFilename();
+} // MyLogTrace
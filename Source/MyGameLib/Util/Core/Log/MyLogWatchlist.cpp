@@ -0,0 +1,500 @@
+#include "MyLogWatchlist.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/OutputDevice.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/Object.h"
+#include <atomic>
+
+namespace
+{
+	/** Number of the slots of the table (twice the greatest number of the watched objects, so the probes are short)*/
+	constexpr int32 NUM_SLOTS_LOG2 = 7;
+	constexpr int32 NUM_SLOTS = 1 << NUM_SLOTS_LOG2;
+	static_assert(NUM_SLOTS >= FMyLogWatchlist::MAX_WATCHED * 2, "The table must be at most half full");
+
+	/** Key of the free slot (the serial number of the watched object is never zero)*/
+	constexpr uint64 FREE_KEY = 0;
+
+	uint64 MakeKey(int32 const InObjectIndex, int32 const InSerialNumber)
+	{
+		return (static_cast<uint64>(static_cast<uint32>(InSerialNumber)) << 32) | static_cast<uint32>(InObjectIndex);
+	}
+
+	int32 GetObjectIndex(uint64 const InKey)
+	{
+		return static_cast<int32>(static_cast<uint32>(InKey));
+	}
+
+	int32 GetSerialNumber(uint64 const InKey)
+	{
+		return static_cast<int32>(static_cast<uint32>(InKey >> 32));
+	}
+
+	/**
+	* Flat hash of the watched keys.
+	* Once published, the keys are only inserted (to the free slots, under the lock): the readers see the key or the free slot.
+	* Removal of the keys republishes the table.
+	*/
+	struct FMyLogWatchTable
+	{
+		std::atomic<uint64> Slots[NUM_SLOTS] = {};
+		std::atomic<int32> Num { 0 };
+
+		/** Wildcards without the wildcard characters: matched by the name of the created object without the string*/
+		TArray<FName> ExactNames;
+
+		/** Wildcards waiting for the objects created later (immutable once published)*/
+		TArray<FString> Wildcards;
+
+		bool HasWildcards() const { return ExactNames.Num() > 0 || Wildcards.Num() > 0; }
+
+		static uint32 GetFirstSlot(uint64 const InKey)
+		{
+			// Fibonacci hashing of the object index (the serial number only validates the key)
+			return (static_cast<uint32>(InKey) * 2654435769U) >> (32 - NUM_SLOTS_LOG2);
+		}
+
+		bool Contains(uint64 const InKey) const
+		{
+			for(uint32 SlotIndex = GetFirstSlot(InKey); ; SlotIndex = (SlotIndex + 1) & (NUM_SLOTS - 1))
+			{
+				uint64 const SlotKey = Slots[SlotIndex].load(std::memory_order_relaxed);
+				if(SlotKey == InKey)
+				{
+					return true;
+				}
+				if(SlotKey == FREE_KEY)
+				{
+					return false;
+				}
+			}
+		}
+
+		/**
+		* @note: must be called under the GetCriticalSection (the only writer).
+		*/
+		void Insert(uint64 const InKey)
+		{
+			checkf(Num.load(std::memory_order_relaxed) < NUM_SLOTS / 2, TEXT("Watch table is full in %s"), TEXT(__FUNCTION__));
+			uint32 SlotIndex = GetFirstSlot(InKey);
+			while(Slots[SlotIndex].load(std::memory_order_relaxed) != FREE_KEY)
+			{
+				SlotIndex = (SlotIndex + 1) & (NUM_SLOTS - 1);
+			}
+			Slots[SlotIndex].store(InKey, std::memory_order_release);
+			Num.fetch_add(1, std::memory_order_release);
+		}
+
+		/**
+		* Does the name of the created object match any of the wildcards
+		* (the exact names are compared as the names, the string is built only for the wildcards with the wildcard characters).
+		*/
+		bool MatchesName(FName const InName) const
+		{
+			if(ExactNames.Contains(InName))
+			{
+				return true;
+			}
+			if(Wildcards.Num() == 0)
+			{
+				return false;
+			}
+			// Reused by the thread, so the matching does NOT allocate once the buffer is grown
+			static thread_local FString NameString;
+			NameString.Reset();
+			InName.AppendString(NameString);
+			return Wildcards.ContainsByPredicate([](const FString& InWildcard)
+			{
+				return NameString.MatchesWildcard(InWildcard);
+			});
+		}
+	};
+
+	/** Published table (nullptr while the watchlist is inactive)*/
+	std::atomic<const FMyLogWatchTable*> GTable { nullptr };
+
+	/**
+	* Authoritative state of the watchlist (the tables are built of it).
+	*/
+	struct FMyLogWatchState
+	{
+		TSet<uint64> Keys;
+		TArray<FString> Wildcards;
+
+		TUniquePtr<FMyLogWatchTable> Table;
+
+		/**
+		* Replaced tables are kept alive, as the readers do not take the lock.
+		* Freed after the garbage collection following the one they're retired before (@see FreeRetiredTables),
+		* the readers hold the table only for the duration of the check.
+		*/
+		TArray<TUniquePtr<FMyLogWatchTable>> RetiredTables;
+
+		/** Number of the retired tables at the last garbage collection*/
+		int32 NumRetiredAtLastGC = 0;
+	};
+
+	FCriticalSection& GetCriticalSection()
+	{
+		static FCriticalSection CriticalSection;
+		return CriticalSection;
+	}
+
+	/** @note: guarded by GetCriticalSection*/
+	FMyLogWatchState& GetState()
+	{
+		static FMyLogWatchState State;
+		return State;
+	}
+
+	/**
+	* Builds the table of the state and publishes it.
+	* @note: must be called under the GetCriticalSection.
+	*/
+	void PublishTable(FMyLogWatchState& InOutState)
+	{
+		TUniquePtr<FMyLogWatchTable> NewTable;
+		if(InOutState.Keys.Num() > 0 || InOutState.Wildcards.Num() > 0)
+		{
+			NewTable = MakeUnique<FMyLogWatchTable>();
+			for(uint64 const Key : InOutState.Keys)
+			{
+				NewTable->Insert(Key);
+			}
+			for(const FString& Wildcard : InOutState.Wildcards)
+			{
+				if(Wildcard.Contains(TEXT("*")) || Wildcard.Contains(TEXT("?")))
+				{
+					NewTable->Wildcards.Add(Wildcard);
+				}
+				else
+				{
+					NewTable->ExactNames.Add(FName(*Wildcard));
+				}
+			}
+		}
+		GTable.store(NewTable.Get(), std::memory_order_release);
+		if(InOutState.Table.IsValid())
+		{
+			InOutState.RetiredTables.Add(MoveTemp(InOutState.Table));
+		}
+		InOutState.Table = MoveTemp(NewTable);
+	}
+
+	/**
+	* Frees the tables retired before the previous garbage collection (called on the game thread after the garbage collection).
+	* @note: must be called under the GetCriticalSection.
+	*/
+	void FreeRetiredTables(FMyLogWatchState& InOutState)
+	{
+		InOutState.RetiredTables.RemoveAt(0, InOutState.NumRetiredAtLastGC);
+		InOutState.NumRetiredAtLastGC = InOutState.RetiredTables.Num();
+	}
+
+	/**
+	* @returns: key of the object, or FREE_KEY if the object is never watched (the serial number is NOT allocated).
+	*/
+	uint64 FindKey(const UObject* const InObject)
+	{
+		int32 const ObjectIndex = static_cast<int32>(InObject->GetUniqueID());
+		const FUObjectItem* const Item = GUObjectArray.IndexToObject(ObjectIndex);
+		int32 const SerialNumber = Item ? Item->GetSerialNumber() : 0;
+		return (SerialNumber != 0) ? MakeKey(ObjectIndex, SerialNumber) : FREE_KEY;
+	}
+
+	/**
+	* @returns: key of the object (the serial number is allocated the same way as the weak pointer does).
+	*/
+	uint64 AllocateKey(int32 const InObjectIndex)
+	{
+		return MakeKey(InObjectIndex, GUObjectArray.AllocateSerialNumber(InObjectIndex));
+	}
+
+	/**
+	* @returns: the watched object of the key, or nullptr if the object is destroyed.
+	*/
+	UObject* GetKeyObject(uint64 const InKey)
+	{
+		FUObjectItem* const Item = GUObjectArray.IndexToObject(GetObjectIndex(InKey));
+		if(Item == nullptr || Item->GetSerialNumber() != GetSerialNumber(InKey))
+		{
+			return nullptr;
+		}
+		return static_cast<UObject*>(Item->Object);
+	}
+
+	/**
+	* @returns: false if the watchlist is full.
+	* @note: must be called under the GetCriticalSection (the table is NOT published).
+	*/
+	bool AddKey(FMyLogWatchState& InOutState, uint64 const InKey)
+	{
+		if(InOutState.Keys.Contains(InKey))
+		{
+			return true;
+		}
+		if(InOutState.Keys.Num() >= FMyLogWatchlist::MAX_WATCHED)
+		{
+			return false;
+		}
+		InOutState.Keys.Add(InKey);
+		return true;
+	}
+
+	/**
+	* Watches the created objects which name matches any of the wildcards.
+	* The name is matched by the published table without the lock, the matched key is inserted into the published table.
+	*/
+	class FMyLogWatchCreateListener : public FUObjectArray::FUObjectCreateListener
+	{
+	public:
+		virtual void NotifyUObjectCreated(const UObjectBase* const InObject, int32 const InIndex) override
+		{
+			const FMyLogWatchTable* const Table = GTable.load(std::memory_order_acquire);
+			if(Table == nullptr || ! Table->HasWildcards() || ! Table->MatchesName(InObject->GetFName()) )
+			{
+				return;
+			}
+			FScopeLock const Lock { &GetCriticalSection() };
+			FMyLogWatchState& State = GetState();
+			// The table is replaced only under the lock: the matched wildcard may be removed meanwhile
+			if(State.Table.IsValid() && State.Table->MatchesName(InObject->GetFName()))
+			{
+				uint64 const Key = AllocateKey(InIndex);
+				if( ! State.Keys.Contains(Key) && AddKey(State, Key) )
+				{
+					State.Table->Insert(Key);
+				}
+			}
+		}
+
+		virtual void OnUObjectArrayShutdown() override
+		{
+			GUObjectArray.RemoveUObjectCreateListener(this);
+		}
+	};
+
+	void RegisterListenersOnce()
+	{
+		static bool const bRegistered = []()
+		{
+			static FMyLogWatchCreateListener CreateListener;
+			GUObjectArray.AddUObjectCreateListener(&CreateListener);
+			FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([]()
+			{
+				// Keys of the destroyed objects are never matched, but they take the place of the watched objects
+				FScopeLock const Lock { &GetCriticalSection() };
+				FMyLogWatchState& State = GetState();
+				int32 const NumKeysBefore = State.Keys.Num();
+				for(auto It = State.Keys.CreateIterator(); It; ++It)
+				{
+					if(GetKeyObject(*It) == nullptr)
+					{
+						It.RemoveCurrent();
+					}
+				}
+				if(State.Keys.Num() != NumKeysBefore)
+				{
+					PublishTable(State);
+				}
+				FreeRetiredTables(State);
+			});
+			return true;
+		}();
+		(void)bRegistered;
+	}
+
+	void AddByNameCommand(const TArray<FString>& InArgs, FOutputDevice& InAr)
+	{
+		if(InArgs.Num() == 0)
+		{
+			InAr.Logf(TEXT("Wildcard of the object name is expected (e.g. TUPawn_*)"));
+			return;
+		}
+		for(const FString& Wildcard : InArgs)
+		{
+			int32 const NumWatched = FMyLogWatchlist::AddByName(Wildcard);
+			InAr.Logf(TEXT("%s: %d existing objects watched (%d watched total)"), *Wildcard, NumWatched, FMyLogWatchlist::Num());
+		}
+	}
+
+	void RemoveByNameCommand(const TArray<FString>& InArgs, FOutputDevice& InAr)
+	{
+		if(InArgs.Num() == 0)
+		{
+			InAr.Logf(TEXT("Wildcard of the object name is expected (e.g. TUPawn_*)"));
+			return;
+		}
+		for(const FString& Wildcard : InArgs)
+		{
+			int32 const NumUnwatched = FMyLogWatchlist::RemoveByName(Wildcard);
+			InAr.Logf(TEXT("%s: %d objects unwatched (%d watched total)"), *Wildcard, NumUnwatched, FMyLogWatchlist::Num());
+		}
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const AddCommand
+	(
+		TEXT("MyLog.Watchlist.Add"),
+		TEXT("Narrows the per-object logging to the objects which name matches any of the given wildcards (also applied to the objects created later)"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			AddByNameCommand(InArgs, InAr);
+		})
+	);
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const RemoveCommand
+	(
+		TEXT("MyLog.Watchlist.Remove"),
+		TEXT("Forgets the given wildcards and unwatches the objects which name matches any of them"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& InArgs, UWorld*, FOutputDevice& InAr)
+		{
+			RemoveByNameCommand(InArgs, InAr);
+		})
+	);
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice const ListCommand
+	(
+		TEXT("MyLog.Watchlist.List"),
+		TEXT("Prints the wildcards and the watched objects"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>&, UWorld*, FOutputDevice& InAr)
+		{
+			FMyLogWatchlist::Dump(InAr);
+		})
+	);
+
+	FAutoConsoleCommand const ClearCommand
+	(
+		TEXT("MyLog.Watchlist.Clear"),
+		TEXT("Unwatches all the objects (the per-object logging is decided as without the watchlist)"),
+		FConsoleCommandDelegate::CreateStatic(&FMyLogWatchlist::Clear)
+	);
+}
+
+bool FMyLogWatchlist::IsActive()
+{
+	return GTable.load(std::memory_order_acquire) != nullptr;
+}
+
+bool FMyLogWatchlist::IsWatched(const UObject* const InObject)
+{
+	const FMyLogWatchTable* const Table = GTable.load(std::memory_order_acquire);
+	if(Table == nullptr || Table->Num.load(std::memory_order_relaxed) == 0 || InObject == nullptr)
+	{
+		return false;
+	}
+	uint64 const Key = FindKey(InObject);
+	return Key != FREE_KEY && Table->Contains(Key);
+}
+
+bool FMyLogWatchlist::ShouldLog(const UObject* const InObject, bool const bInShouldLogIfInactive)
+{
+	if( ! IsActive() )
+	{
+		return bInShouldLogIfInactive;
+	}
+	return InObject && (IsWatched(InObject) || IsWatched(InObject->GetOuter()));
+}
+
+bool FMyLogWatchlist::Add(const UObject* const InObject)
+{
+	checkf(InObject, TEXT("nullptr is invalid in %s"), TEXT(__FUNCTION__));
+	RegisterListenersOnce();
+	FScopeLock const Lock { &GetCriticalSection() };
+	FMyLogWatchState& State = GetState();
+	if( ! AddKey(State, AllocateKey(static_cast<int32>(InObject->GetUniqueID()))) )
+	{
+		return false;
+	}
+	PublishTable(State);
+	return true;
+}
+
+void FMyLogWatchlist::Remove(const UObject* const InObject)
+{
+	checkf(InObject, TEXT("nullptr is invalid in %s"), TEXT(__FUNCTION__));
+	uint64 const Key = FindKey(InObject);
+	FScopeLock const Lock { &GetCriticalSection() };
+	FMyLogWatchState& State = GetState();
+	if(Key != FREE_KEY && State.Keys.Remove(Key) > 0)
+	{
+		PublishTable(State);
+	}
+}
+
+int32 FMyLogWatchlist::AddByName(const FString& InWildcard)
+{
+	RegisterListenersOnce();
+	int32 NumWatched = 0;
+	FScopeLock const Lock { &GetCriticalSection() };
+	FMyLogWatchState& State = GetState();
+	State.Wildcards.AddUnique(InWildcard);
+	for(TObjectIterator<UObject> It; It; ++It)
+	{
+		if(It->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject) || ! It->GetName().MatchesWildcard(InWildcard))
+		{
+			continue;
+		}
+		if( ! AddKey(State, AllocateKey(static_cast<int32>(It->GetUniqueID()))) )
+		{
+			break;
+		}
+		++NumWatched;
+	}
+	PublishTable(State);
+	return NumWatched;
+}
+
+int32 FMyLogWatchlist::RemoveByName(const FString& InWildcard)
+{
+	int32 NumUnwatched = 0;
+	FScopeLock const Lock { &GetCriticalSection() };
+	FMyLogWatchState& State = GetState();
+	State.Wildcards.Remove(InWildcard);
+	for(auto It = State.Keys.CreateIterator(); It; ++It)
+	{
+		const UObject* const Object = GetKeyObject(*It);
+		if(Object == nullptr || Object->GetName().MatchesWildcard(InWildcard))
+		{
+			It.RemoveCurrent();
+			++NumUnwatched;
+		}
+	}
+	PublishTable(State);
+	return NumUnwatched;
+}
+
+int32 FMyLogWatchlist::Num()
+{
+	FScopeLock const Lock { &GetCriticalSection() };
+	return GetState().Keys.Num();
+}
+
+void FMyLogWatchlist::Clear()
+{
+	FScopeLock const Lock { &GetCriticalSection() };
+	FMyLogWatchState& State = GetState();
+	State.Keys.Reset();
+	State.Wildcards.Reset();
+	PublishTable(State);
+}
+
+void FMyLogWatchlist::Dump(FOutputDevice& InAr)
+{
+	FScopeLock const Lock { &GetCriticalSection() };
+	const FMyLogWatchState& State = GetState();
+	for(const FString& Wildcard : State.Wildcards)
+	{
+		InAr.Logf(TEXT("Wildcard: %s"), *Wildcard);
+	}
+	for(uint64 const Key : State.Keys)
+	{
+		const UObject* const Object = GetKeyObject(Key);
+		InAr.Logf(TEXT("Object: %s"), Object ? *Object->GetPathName() : TEXT("(destroyed)"));
+	}
+	InAr.Logf(TEXT("%d objects watched, %d wildcards (%s)"), State.Keys.Num(), State.Wildcards.Num(), IsActive() ? TEXT("active") : TEXT("inactive"));
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FOutputDevice;
+
+/**
+* Global watchlist of the objects the per-object logging is narrowed to.
+*
+* Watched objects are keyed by the object index and the serial number (like the weak pointer)
+* in the open addressing flat hash, so the check is O(1) and takes no lock:
+* the table is copied on each removal or change of the wildcards and published by the atomic pointer,
+* the replaced tables are freed after the garbage collection.
+*
+* Objects are watched by the code (Add) or by the name wildcards from the console (MyLog.Watchlist.Add);
+* the wildcard is also applied to the objects created later (matched by the name without the lock,
+* the matched object is inserted into the published table without copying it).
+*
+* While the watchlist is empty (and there's no wildcards) the filter is inactive
+* and the logging is decided as before (e.g. by the ETUFlags::ExtLog of the actor).
+*/
+class FMyLogWatchlist
+{
+public:
+	/** Greatest number of the watched objects (the watchlist is intended for the few objects)*/
+	static constexpr int32 MAX_WATCHED = 64;
+
+	/** Is anything watched (or any wildcard is waiting for the objects)*/
+	static bool IsActive();
+
+	/** Is the given object itself watched (false for nullptr)*/
+	static bool IsWatched(const UObject* InObject);
+
+	/**
+	* Should the per-object logging of the given object be done.
+	* The object is watched if the object itself or its outer (e.g. the owner actor of the component) is watched.
+	*
+	* @param bInShouldLogIfInactive: the result when the watchlist is inactive.
+	*/
+	static bool ShouldLog(const UObject* InObject, bool bInShouldLogIfInactive = true);
+
+	/**
+	* @returns: false if the watchlist is full.
+	*/
+	static bool Add(const UObject* InObject);
+	static void Remove(const UObject* InObject);
+
+	/**
+	* Watches the existing objects which name matches the wildcard and the objects created later.
+	* @returns: number of the existing objects watched.
+	*/
+	static int32 AddByName(const FString& InWildcard);
+
+	/**
+	* Forgets the wildcard and unwatches the objects which name matches it.
+	* @returns: number of the objects unwatched.
+	*/
+	static int32 RemoveByName(const FString& InWildcard);
+
+	/** Number of the watched objects*/
+	static int32 Num();
+
+	/** Unwatches all the objects and forgets all the wildcards*/
+	static void Clear();
+
+	/** Prints the wildcards and the watched objects*/
+	static void Dump(FOutputDevice& InAr);
+};
+
+// ~Watchlist logging macros Begin
+#define M_LOGFUNC_WATCHED(Object) M_LOGFUNC_IF(FMyLogWatchlist::ShouldLog((Object)))
+#define M_LOGFUNC_WATCHED_IF(Object, ShouldLogIfInactive) M_LOGFUNC_IF(FMyLogWatchlist::ShouldLog((Object), (ShouldLogIfInactive)))
+// ~Watchlist logging macros End
@@ -7,13 +7,6 @@ bool UMyLoggingTypes::ShouldLog(ELogFlags InFlags, bool bErrorOrWarn)
 	return ELogFlags::None == (InFlags & ELogFlags::DisableLog);
 }
 
-bool UMyLoggingTypes::ShouldLogVerbosity(ELogFlags InFlags, ELogVerbosity::Type InVerbosity)
-{
-	CheckFlagsValid(InFlags);
-	bool const bWarnOrError = IsVerbosityWarnOrError(InVerbosity);
-	return ShouldLog(InFlags, bWarnOrError);
-}
-
 bool UMyLoggingTypes::AreFlagsValid(ELogFlags InFlags)
 {
 	ELogFlags constexpr MASK = ELogFlags::LogEverSuccess | ELogFlags::DisableLog;
@@ -31,17 +24,3 @@ void UMyLoggingTypes::CheckFlagsValid(ELogFlags InFlags)
 	checkf(AreFlagsValid(InFlags), TEXT("Log flags must be valid"));
 }
 
-bool UMyLoggingTypes::IsVerbosityWarnOrError(ELogVerbosity::Type InVerbosity)
-{
-	switch(InVerbosity)
-	{
-	case ELogVerbosity::Type::Fatal:
-	case ELogVerbosity::Type::Error:
-	case ELogVerbosity::Type::Warning:
-		return true;
-
-	default:
-		return false;
-	}
-	checkNoEntry();
-}
\ No newline at end of file
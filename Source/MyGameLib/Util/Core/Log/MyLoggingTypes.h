@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Logging/LogMacros.h"
+#include "Misc/AssertionMacros.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "MyLoggingTypes.generated.h"
 
@@ -28,6 +29,17 @@ public:
 	UFUNCTION(BlueprintPure, Category = MyLoggingTypes)
 	static bool ShouldLog(ELogFlags InFlags, bool bErrorOrWarn);
 
-	static bool ShouldLogVerbosity(ELogFlags InFlags, ELogVerbosity::Type InVerbosity);
-	static bool IsVerbosityWarnOrError(ELogVerbosity::Type InVerbosity);
+	/**
+	* @note: inline (called by the M_LOG*_IF_FLAGS macros, so the check is folded when the flags are known at compile time).
+	*/
+	static bool ShouldLogVerbosity(ELogFlags const InFlags, ELogVerbosity::Type const InVerbosity)
+	{
+		checkf(AreFlagsValid(InFlags), TEXT("Log flags must be valid"));
+		return IsVerbosityWarnOrError(InVerbosity) || ELogFlags::None == (InFlags & ELogFlags::DisableLog);
+	}
+
+	static bool IsVerbosityWarnOrError(ELogVerbosity::Type const InVerbosity)
+	{
+		return InVerbosity == ELogVerbosity::Type::Fatal || InVerbosity == ELogVerbosity::Type::Error || InVerbosity == ELogVerbosity::Type::Warning;
+	}
 };
@@ -0,0 +1,157 @@
+#include "MyObjectDescriptorCache.h"
+#include "Util/Core/LogUtilLib.h"
+
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/Class.h"
+#include <atomic>
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarMyLogDescriptorCache
+	(
+		TEXT("MyLog.DescriptorCache"),
+		0,
+		TEXT("Cache the name and class strings of the logged objects per logging thread (0 - off, 1 - on)"),
+		ECVF_Default
+	);
+
+	/** Number of the descriptors cached by each thread (direct-mapped by the object index)*/
+	constexpr int32 NUM_THREAD_DESCRIPTORS_LOG2 = 8;
+	constexpr int32 NUM_THREAD_DESCRIPTORS = 1 << NUM_THREAD_DESCRIPTORS_LOG2;
+
+	/**
+	* Cached strings of the object.
+	*/
+	struct FMyObjectDescriptor
+	{
+		/** Validation (the index may be reused by the other object, the object may be renamed)*/
+		int32 ObjectIndex = INDEX_NONE;
+		FName Name;
+		const UClass* Class = nullptr;
+
+		/** Empty until described*/
+		FString NameAndClass;
+
+		/** Flags of FlagsText (flags text is rebuilt when the flags change)*/
+		EObjectFlags Flags = RF_NoFlags;
+		FString FlagsText;
+		bool bHasFlagsText = false;
+
+		bool IsValidFor(int32 const InObjectIndex, const UObject* const InObject) const
+		{
+			return ObjectIndex == InObjectIndex && Name == InObject->GetFName() && Class == InObject->GetClass();
+		}
+	};
+
+	/**
+	* Descriptors of the calling thread.
+	*/
+	struct FMyThreadDescriptorCache
+	{
+		FMyObjectDescriptor Descriptors[NUM_THREAD_DESCRIPTORS];
+		int32 Num = 0;
+
+		/** @see GGeneration*/
+		uint32 Generation = 0;
+	};
+
+	/** Incremented by Reset: the cache of the thread is cleared when the thread sees the new generation*/
+	std::atomic<uint32> GGeneration { 0 };
+
+	void RegisterGarbageCollectionCallbackOnce()
+	{
+		static bool const bRegistered = []()
+		{
+			FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FMyObjectDescriptorCache::Reset);
+			return true;
+		}();
+		(void)bRegistered;
+	}
+
+	FMyThreadDescriptorCache& GetThreadCache()
+	{
+		RegisterGarbageCollectionCallbackOnce();
+		static thread_local FMyThreadDescriptorCache Cache;
+		uint32 const Generation = GGeneration.load(std::memory_order_acquire);
+		if(Cache.Generation != Generation)
+		{
+			// Strings are reset, NOT freed: the buffers are reused by the next descriptors
+			for(FMyObjectDescriptor& Descriptor : Cache.Descriptors)
+			{
+				Descriptor.ObjectIndex = INDEX_NONE;
+				Descriptor.NameAndClass.Reset();
+				Descriptor.bHasFlagsText = false;
+			}
+			Cache.Num = 0;
+			Cache.Generation = Generation;
+		}
+		return Cache;
+	}
+
+	/**
+	* @returns: descriptor of the object in the cache of the calling thread (the slot of the other object is taken over).
+	*/
+	FMyObjectDescriptor& FindOrAddDescriptor(const UObject* const InObject)
+	{
+		FMyThreadDescriptorCache& Cache = GetThreadCache();
+		int32 const ObjectIndex = static_cast<int32>(InObject->GetUniqueID());
+		FMyObjectDescriptor& Descriptor = Cache.Descriptors[ObjectIndex & (NUM_THREAD_DESCRIPTORS - 1)];
+		if( ! Descriptor.IsValidFor(ObjectIndex, InObject) )
+		{
+			if(Descriptor.ObjectIndex == INDEX_NONE)
+			{
+				++Cache.Num;
+			}
+			Descriptor.ObjectIndex = ObjectIndex;
+			Descriptor.Name = InObject->GetFName();
+			Descriptor.Class = InObject->GetClass();
+			Descriptor.NameAndClass.Reset();
+			Descriptor.bHasFlagsText = false;
+		}
+		return Descriptor;
+	}
+}
+
+bool FMyObjectDescriptorCache::IsEnabled()
+{
+	return CVarMyLogDescriptorCache.GetValueOnAnyThread() != 0;
+}
+
+void FMyObjectDescriptorCache::AppendNameAndClass(FString& InOut, const UObject* const InObject)
+{
+	checkf(InObject, TEXT("nullptr is invalid in %s"), TEXT(__FUNCTION__));
+	FMyObjectDescriptor& Descriptor = FindOrAddDescriptor(InObject);
+	if(Descriptor.NameAndClass.IsEmpty())
+	{
+		// Descriptor may be created by AppendObjectFlags
+		Descriptor.NameAndClass.Reserve(ULogUtilLib::APPEND_RESERVED_LEN);
+		ULogUtilLib::AppendNameAndClassUncached(Descriptor.NameAndClass, InObject);
+	}
+	InOut.Append(Descriptor.NameAndClass);
+}
+
+void FMyObjectDescriptorCache::AppendObjectFlags(FString& InOut, const UObject* const InObject)
+{
+	checkf(InObject, TEXT("nullptr is invalid in %s"), TEXT(__FUNCTION__));
+	FMyObjectDescriptor& Descriptor = FindOrAddDescriptor(InObject);
+	EObjectFlags const Flags = InObject->GetFlags();
+	if( ! Descriptor.bHasFlagsText || Descriptor.Flags != Flags )
+	{
+		Descriptor.FlagsText.Reset();
+		ULogUtilLib::AppendObjectFlagsString(Descriptor.FlagsText, Flags);
+		Descriptor.Flags = Flags;
+		Descriptor.bHasFlagsText = true;
+	}
+	InOut.Append(Descriptor.FlagsText);
+}
+
+int32 FMyObjectDescriptorCache::Num()
+{
+	return GetThreadCache().Num;
+}
+
+void FMyObjectDescriptorCache::Reset()
+{
+	GGeneration.fetch_add(1, std::memory_order_release);
+}
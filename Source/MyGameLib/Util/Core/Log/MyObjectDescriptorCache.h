@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+
+/**
+* Cache of the log descriptors of the objects (@see ULogUtilLib::AppendNameAndClass, GetWeakNameAndClassSafe).
+*
+* Each logging thread caches the descriptors in its own direct-mapped table by the object index (no locks),
+* validated by the name and the class (the strings depend only on them, so renamed objects are described again
+* and no serial number is allocated); the caches are cleared after each garbage collection.
+* So repeated logging of the same object costs the index and the name comparison instead of formatting.
+*
+* Enabled by MyLog.DescriptorCache (off by default).
+*/
+class FMyObjectDescriptorCache
+{
+public:
+	/** Is caching enabled by the console variable*/
+	static bool IsEnabled();
+
+	/**
+	* Appends name="Name" class="Class" of the object (@see ULogUtilLib::AppendNameAndClass).
+	*/
+	static void AppendNameAndClass(FString& InOut, const UObject* InObject);
+
+	/**
+	* Appends the flags of the object (@see ULogUtilLib::AppendObjectFlagsString).
+	*/
+	static void AppendObjectFlags(FString& InOut, const UObject* InObject);
+
+	/** Number of the descriptors cached by the calling thread*/
+	static int32 Num();
+
+	/** Forgets all the descriptors (the cache of each thread is cleared the next time the thread uses it)*/
+	static void Reset();
+};
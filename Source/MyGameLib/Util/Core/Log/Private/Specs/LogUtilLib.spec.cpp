@@ -1,5 +1,46 @@
 #include "AutomationTest.h"
 #include "Util/Core/LogUtilLib.h"
+#include "Misc/OutputDeviceRedirector.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	/**
+	* Collects the lines of the MyLog category.
+	*/
+	class FLogUtilLibSpecCaptureDevice : public FOutputDevice
+	{
+	public:
+		TArray<FString> Lines;
+
+		virtual void Serialize(const TCHAR* const InData, ELogVerbosity::Type, const FName& InCategory) override
+		{
+			if(InCategory == MyLog.GetCategoryName())
+			{
+				Lines.Add(InData);
+			}
+		}
+	};
+
+	TArray<const UObject*> CreateRangeObjects(const TCHAR* const InNamePrefix, int32 const InNum)
+	{
+		TArray<const UObject*> Objects;
+		for(int32 ObjectIndex = 0; ObjectIndex < InNum; ++ObjectIndex)
+		{
+			Objects.Add(NewObject<UPackage>(GetTransientPackage(), *FString::Printf(TEXT("%s%d"), InNamePrefix, ObjectIndex), RF_Transient));
+		}
+		return Objects;
+	}
+
+	TArray<FString> LogRangeCaptured(const TArray<const UObject*>& InObjects, ELogRangeFlags const InFlags)
+	{
+		FLogUtilLibSpecCaptureDevice Device;
+		GLog->AddOutputDevice(&Device);
+		ULogUtilLib::LogObjectRange(InObjects, InFlags);
+		GLog->RemoveOutputDevice(&Device);
+		return Device.Lines;
+	}
+}
 
 DEFINE_SPEC(LogUtilLibSpec, "MyUtil.Core.Log.LogUtilLibSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
 
@@ -19,6 +60,71 @@ void LogUtilLibSpec::Define()
 		//});
 	});
 
+	Describe("Append API", [this]()
+	{
+		It("should produce the same text as the Get functions", [this]()
+		{
+			const UObject* const Object = GetDefault<UObject>();
+			FString const Expected = FString::Printf(TEXT("Key : (name=\"%s\" class=\"%s\")"), *Object->GetName(), *Object->GetClass()->GetName());
+			TestEqual(TEXT("GetKeyedNameAndClassC"), ULogUtilLib::GetKeyedNameAndClassC(TEXT("Key"), Object), Expected);
+
+			FString& Line = ULogUtilLib::GetScratchString();
+			ULogUtilLib::AppendKeyedNameAndClassC(Line, TEXT("Key"), Object);
+			TestEqual(TEXT("AppendKeyedNameAndClassC"), Line, Expected);
+		});
+
+		It("should compose the key-value pairs", [this]()
+		{
+			FString& Line = ULogUtilLib::GetScratchString();
+			ULogUtilLib::AppendKeyInt32C(Line, TEXT("I"), -5);
+			Line.Append(TEXT("; "));
+			ULogUtilLib::AppendKeyFloatC(Line, TEXT("F"), 1.5F);
+			Line.Append(TEXT("; "));
+			ULogUtilLib::AppendKeyYesNoC(Line, TEXT("B"), true);
+			Line.Append(TEXT("; "));
+			ULogUtilLib::AppendKeyNameC(Line, TEXT("N"), FName(TEXT("Name"), 2));
+			TestEqual(TEXT("Composite line"), Line, FString(TEXT("I : -5; F : 1.500000; B : YES; N : \"Name_1\"")));
+			TestEqual(TEXT("GetKeyDoubleC"), ULogUtilLib::GetKeyDoubleC(TEXT("D"), 0.25), FString(TEXT("D : 0.250000")));
+		});
+
+		It("should reset the scratch string", [this]()
+		{
+			ULogUtilLib::GetScratchString().Append(TEXT("Garbage"));
+			TestTrue(TEXT("Scratch string must be empty"), ULogUtilLib::GetScratchString().IsEmpty());
+		});
+
+		It("should keep the flags format", [this]()
+		{
+			TestEqual(TEXT("No flags"), ULogUtilLib::GetObjectFlagsStringScoped(RF_NoFlags), FString(TEXT("{None}")));
+			TestEqual(TEXT("Flags"), ULogUtilLib::GetObjectFlagsString(RF_Public | RF_Standalone), FString(TEXT("Public | Standalone | ")));
+		});
+	});
+
+	Describe("M_LOG_VALUE", [this]()
+	{
+		It("should log the same value as the function, at the call site of the caller", [this]()
+		{
+			FLogUtilLibSpecCaptureDevice Device;
+			GLog->AddOutputDevice(&Device);
+			M_LOG_VALUE(FVector, TEXT("LogUtilLibSpec_Value"), FVector(1.0F, 2.0F, 3.0F));
+			ULogUtilLib::LogVectorC(TEXT("LogUtilLibSpec_Value"), FVector(1.0F, 2.0F, 3.0F));
+			GLog->RemoveOutputDevice(&Device);
+			if( ! TestEqual(TEXT("Lines"), Device.Lines.Num(), 2) )
+			{
+				return;
+			}
+			auto GetKeyValue = [](const FString& InLine)
+			{
+				int32 const KeyStart = InLine.Find(TEXT("LogUtilLibSpec_Value"));
+				int32 const PostfixStart = InLine.Find(TEXT(" (line: "));
+				return InLine.Mid(KeyStart, PostfixStart - KeyStart);
+			};
+			TestEqual(TEXT("Key and value"), GetKeyValue(Device.Lines[0]), GetKeyValue(Device.Lines[1]));
+			TestTrue(TEXT("Macro line is of the caller"), Device.Lines[0].Contains(TEXT("LogUtilLib.spec.cpp")));
+			TestFalse(TEXT("Function line is of LogUtilLib.cpp"), Device.Lines[1].Contains(TEXT("LogUtilLib.spec.cpp")));
+		});
+	});
+
 	Describe("LogObjectRange", [this]()
 	{
 		It("should correctly process nullptr", [this]()
@@ -27,5 +133,42 @@ void LogUtilLibSpec::Define()
 			int32 TotalObjects = ULogUtilLib::LogObjectRange(A);
 			TestEqual(TEXT("Must return count of objects processsed"), TotalObjects, A.Num());
 		});
+
+		It("should format the element with the index", [this]()
+		{
+			FString Text;
+			ULogUtilLib::AppendRangeElement(Text, nullptr, 3, ELogRangeFlags::LogIndex);
+			TestEqual(TEXT("Text"), Text, FString(TEXT("3: nullptr")));
+		});
+
+		It("should emit the parallel formatted elements in the order of the range", [this]()
+		{
+			constexpr int32 NUM_OBJECTS = 200;
+			TArray<const UObject*> const Objects = CreateRangeObjects(TEXT("LogUtilLibSpec_Ordered_"), NUM_OBJECTS);
+			TArray<FString> const Lines = LogRangeCaptured(Objects, ELogRangeFlags::Default | ELogRangeFlags::Parallel);
+			int32 ObjectIndex = 0;
+			for(const FString& Line : Lines)
+			{
+				if(ObjectIndex < NUM_OBJECTS && Line.Contains(FString::Printf(TEXT("%d: {"), ObjectIndex)) && Line.Contains(Objects[ObjectIndex]->GetName()))
+				{
+					++ObjectIndex;
+				}
+			}
+			TestEqual(TEXT("Number of the elements logged in order"), ObjectIndex, NUM_OBJECTS);
+			TestTrue(TEXT("Summary"), Lines.Num() > 0 && Lines.Last().Contains(FString::Printf(TEXT("Total %d objects logged"), NUM_OBJECTS)));
+		});
+
+		It("should pack the parallel formatted elements with OneLine", [this]()
+		{
+			constexpr int32 NUM_OBJECTS = 100;
+			TArray<const UObject*> const Objects = CreateRangeObjects(TEXT("LogUtilLibSpec_OneLine_"), NUM_OBJECTS);
+			TArray<FString> const Lines = LogRangeCaptured(Objects, ELogRangeFlags::OneLine | ELogRangeFlags::Parallel);
+			int32 NumElementLines = 0;
+			for(const FString& Line : Lines)
+			{
+				NumElementLines += Line.Contains(TEXT("LogUtilLibSpec_OneLine_")) ? 1 : 0;
+			}
+			TestTrue(TEXT("Elements are packed"), NumElementLines > 0 && NumElementLines < NUM_OBJECTS);
+		});
 	});
 }
@@ -0,0 +1,129 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyBinaryLog.h"
+#include "Serialization/MemoryWriter.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_SPEC(MyBinaryLogSpec, "MyUtil.Core.Log.MyBinaryLogSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyBinaryLogSpec::Define()
+{
+	Describe("Decode", [this]()
+	{
+		It("should reconstruct the same text as the text log", [this]()
+		{
+			TArray<uint8> Data;
+			FMemoryWriter Archive { Data };
+			static FMyBinaryLogFormat const VectorFormat { __FUNCTION__, __FILE__, __LINE__, MyLog, ELogVerbosity::Log, TEXT("%s : \"%s\"") };
+			static FMyBinaryLogFormat const MixedFormat { __FUNCTION__, __FILE__, __LINE__, MyLog, ELogVerbosity::Warning, TEXT("%d%% %f %s") };
+			FVector const Vector { 1.0F, 2.5F, -3.0F };
+			FName const Name { TEXT("TestName"), 3 };
+			{
+				FMyBinaryLogWriter Writer { &Archive, /*bInOwnsArchive*/false };
+				Writer.Write(VectorFormat, TEXT("Location"), Vector);
+				Writer.Write(VectorFormat, TEXT("Location"), Vector);
+				Writer.Write(MixedFormat, 42, 0.5F, Name);
+			}
+
+			TArray<FString> Lines;
+			FString Error;
+			TestTrue(TEXT("Decode must succeed"), MyBinaryLog::Decode(Data, Lines, &Error));
+			if( ! TestEqual(TEXT("Number of lines"), Lines.Num(), 3) )
+			{
+				return;
+			}
+			FString const ExpectedVectorMessage = VectorFormat.Site.Prefix + FString::Printf(TEXT("%s : \"%s\""), TEXT("Location"), *Vector.ToString()) + VectorFormat.Site.Postfix;
+			TestTrue(TEXT("Vector line"), Lines[0].EndsWith(FString(TEXT("MyLog: ")) + ExpectedVectorMessage));
+			TestTrue(TEXT("Repeated line"), Lines[1].EndsWith(ExpectedVectorMessage));
+			FString const ExpectedMixedMessage = FString::Printf(TEXT("42%% %f %s"), 0.5F, *Name.ToString());
+			TestTrue(TEXT("Mixed line"), Lines[2].Contains(FString(TEXT("MyLog: Warning: ")) + MixedFormat.Site.Prefix + ExpectedMixedMessage));
+		});
+
+		It("should apply the width and the precision of the format", [this]()
+		{
+			TArray<uint8> Data;
+			FMemoryWriter Archive { Data };
+			static FMyBinaryLogFormat const Format { __FUNCTION__, __FILE__, __LINE__, MyLog, ELogVerbosity::Log, TEXT("%.2f|%5d|%-6s|%e") };
+			{
+				FMyBinaryLogWriter Writer { &Archive, /*bInOwnsArchive*/false };
+				Writer.Write(Format, 3.14159F, 42, TEXT("abc"), 1234.5);
+			}
+
+			TArray<FString> Lines;
+			TestTrue(TEXT("Decode must succeed"), MyBinaryLog::Decode(Data, Lines));
+			FString const ExpectedMessage = FString::Printf(TEXT("%.2f|%5d|%-6s|%e"), 3.14159F, 42, TEXT("abc"), 1234.5);
+			TestTrue(TEXT("Line"), Lines.Num() == 1 && Lines[0].Contains(ExpectedMessage));
+		});
+
+		It("should write the strings above the interning limit inline", [this]()
+		{
+			constexpr int32 NUM_STRINGS = 2000;
+			TArray<uint8> Data;
+			FMemoryWriter Archive { Data };
+			static FMyBinaryLogFormat const Format { __FUNCTION__, __FILE__, __LINE__, MyLog, ELogVerbosity::Log, TEXT("%s") };
+			FString const LongString = FString::ChrN(1000, TEXT('x'));
+			{
+				FMyBinaryLogWriter Writer { &Archive, /*bInOwnsArchive*/false };
+				for(int32 StringIndex = 0; StringIndex < NUM_STRINGS; ++StringIndex)
+				{
+					Writer.Write(Format, FString::Printf(TEXT("String_%d"), StringIndex));
+				}
+				Writer.Write(Format, LongString);
+			}
+
+			TArray<FString> Lines;
+			TestTrue(TEXT("Decode must succeed"), MyBinaryLog::Decode(Data, Lines));
+			if( ! TestEqual(TEXT("Number of lines"), Lines.Num(), NUM_STRINGS + 1) )
+			{
+				return;
+			}
+			TestTrue(TEXT("Interned string"), Lines[0].EndsWith(TEXT("String_0") + Format.Site.Postfix));
+			TestTrue(TEXT("Inline string"), Lines[NUM_STRINGS - 1].EndsWith(FString::Printf(TEXT("String_%d"), NUM_STRINGS - 1) + Format.Site.Postfix));
+			TestTrue(TEXT("Long string"), Lines[NUM_STRINGS].EndsWith(LongString + Format.Site.Postfix));
+		});
+
+		It("should report the corrupted data", [this]()
+		{
+			TArray<uint8> const Garbage { 1, 2, 3, 4, 5, 6, 7, 8 };
+			TArray<FString> Lines;
+			TestFalse(TEXT("Decode must fail"), MyBinaryLog::Decode(Garbage, Lines));
+		});
+	});
+}
+
+DEFINE_SPEC(MyBinaryLogBenchmark, "MyUtil.Core.Log.MyBinaryLogBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void MyBinaryLogBenchmark::Define()
+{
+	It("should report ns and bytes per vector line for the text and the binary log", [this]()
+	{
+		constexpr int32 NUM_LINES = 100000;
+		static FMyBinaryLogFormat const Format { __FUNCTION__, __FILE__, __LINE__, MyLog, ELogVerbosity::Log, TEXT("%s : \"%s\"") };
+
+		int64 TextBytes = 0;
+		double const TextStartSeconds = FPlatformTime::Seconds();
+		for(int32 LineIndex = 0; LineIndex < NUM_LINES; ++LineIndex)
+		{
+			FVector const Vector { static_cast<float>(LineIndex), 2.0F, 3.0F };
+			FMyLogLine Line;
+			MyLog::FormatLine(Line, Format.Site, TEXT("%s : \"%s\""), TEXT("Location"), *Vector.ToString());
+			TextBytes += Line.Len() * sizeof(TCHAR);
+		}
+		double const TextSeconds = FPlatformTime::Seconds() - TextStartSeconds;
+
+		TArray<uint8> Data;
+		Data.Reserve(NUM_LINES * 64);
+		FMemoryWriter Archive { Data };
+		double const BinaryStartSeconds = FPlatformTime::Seconds();
+		{
+			FMyBinaryLogWriter Writer { &Archive, /*bInOwnsArchive*/false };
+			for(int32 LineIndex = 0; LineIndex < NUM_LINES; ++LineIndex)
+			{
+				Writer.Write(Format, TEXT("Location"), FVector { static_cast<float>(LineIndex), 2.0F, 3.0F });
+			}
+		}
+		double const BinarySeconds = FPlatformTime::Seconds() - BinaryStartSeconds;
+
+		AddInfo(FString::Printf(TEXT("Text: %.1f ns/line, %.1f bytes/line"), TextSeconds * 1.0e9 / NUM_LINES, static_cast<double>(TextBytes) / NUM_LINES));
+		AddInfo(FString::Printf(TEXT("Binary: %.1f ns/line, %.1f bytes/line"), BinarySeconds * 1.0e9 / NUM_LINES, static_cast<double>(Data.Num()) / NUM_LINES));
+	});
+}
@@ -0,0 +1,92 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyBitmaskFormatter.h"
+#include "Util/Core/LogUtilLib.h"
+#include "Util/TestUtil/TUTypesLib.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	enum class EMyBitmaskFormatterSpecFlags : uint8
+	{
+		None = 0,
+		First = 1 << 0,
+		Second = 1 << 1,
+		Unnamed = 1 << 7
+	};
+
+	const FMyBitName SPEC_FLAG_NAMES[] =
+	{
+		FMyBitName{ static_cast<uint64>(EMyBitmaskFormatterSpecFlags::First), TEXT("First") },
+		FMyBitName{ static_cast<uint64>(EMyBitmaskFormatterSpecFlags::Second), TEXT("Second") }
+	};
+}
+
+DEFINE_SPEC(MyBitmaskFormatterSpec, "MyUtil.Core.Log.MyBitmaskFormatterSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyBitmaskFormatterSpec::Define()
+{
+	Describe("Static table", [this]()
+	{
+		It("should format the named bits", [this]()
+		{
+			TMyBitmaskFormatter<EMyBitmaskFormatterSpecFlags> const Formatter { MakeArrayView(SPEC_FLAG_NAMES) };
+			TestEqual(TEXT("None"), Formatter.ToString(EMyBitmaskFormatterSpecFlags::None), FString(TEXT("None")));
+			TestEqual(TEXT("First"), Formatter.ToString(EMyBitmaskFormatterSpecFlags::First), FString(TEXT("First | ")));
+			TestEqual(TEXT("Both"), Formatter.ToString(static_cast<EMyBitmaskFormatterSpecFlags>(3)), FString(TEXT("First | Second | ")));
+			TestEqual(TEXT("Unnamed bit is skipped"), Formatter.ToString(EMyBitmaskFormatterSpecFlags::Unnamed), FString());
+		});
+
+		It("should return the same text when memoized", [this]()
+		{
+			TMyBitmaskFormatter<EMyBitmaskFormatterSpecFlags> const Formatter { MakeArrayView(SPEC_FLAG_NAMES), TEXT(",") };
+			// More distinct masks than the memo holds, twice
+			for(int32 Pass = 0; Pass < 2; ++Pass)
+			{
+				for(uint64 Value = 0; Value < 2 * FMyBitmaskFormatter::MEMO_CAPACITY; ++Value)
+				{
+					FString Expected;
+					if(Value == 0)
+					{
+						Expected = TEXT("None");
+					}
+					Expected += (Value & 1) ? TEXT("First,") : TEXT("");
+					Expected += (Value & 2) ? TEXT("Second,") : TEXT("");
+					TestEqual(FString::Printf(TEXT("Mask %llu pass %d"), Value, Pass), Formatter.ToString(Value), Expected);
+				}
+			}
+		});
+	});
+
+	Describe("UEnum", [this]()
+	{
+		It("should take the names of the single bit entries", [this]()
+		{
+			TMyBitmaskFormatter<ETUFlags> const Formatter { StaticEnum<ETUFlags>(), TEXT("|") };
+			TestEqual(TEXT("Number of bits"), Formatter.NumBits(), 1);
+			TestEqual(TEXT("ExtLog"), Formatter.ToString(ETUFlags::ExtLog), FString(TEXT("ExtLog|")));
+			TestEqual(TEXT("GetTUFlagsString"), UTUTypesLib::GetTUFlagsString(ETUFlags::ExtLog), FString(TEXT("ExtLog|")));
+			TestEqual(TEXT("GetTUFlagsString of none"), UTUTypesLib::GetTUFlagsString(ETUFlags::None), FString(TEXT("None")));
+		});
+	});
+}
+
+DEFINE_SPEC(MyBitmaskFormatterBenchmark, "MyUtil.Core.Log.MyBitmaskFormatterBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void MyBitmaskFormatterBenchmark::Define()
+{
+	It("should report ns per object flags string", [this]()
+	{
+		constexpr int32 NUM_CALLS = 100000;
+		EObjectFlags const Flags = RF_Public | RF_Standalone | RF_Transactional | RF_WasLoaded | RF_LoadCompleted;
+		FString Text;
+		Text.Reserve(ULogUtilLib::APPEND_RESERVED_LEN);
+		double const StartSeconds = FPlatformTime::Seconds();
+		for(int32 CallIndex = 0; CallIndex < NUM_CALLS; ++CallIndex)
+		{
+			Text.Reset();
+			ULogUtilLib::AppendObjectFlagsString(Text, Flags);
+		}
+		double const Seconds = FPlatformTime::Seconds() - StartSeconds;
+		AddInfo(FString::Printf(TEXT("AppendObjectFlagsString (memoized): %.1f ns"), Seconds * 1.0e9 / NUM_CALLS));
+	});
+}
@@ -0,0 +1,219 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyFloatFormat.h"
+#include "Math/Vector.h"
+#include "Math/Vector2D.h"
+#include "Math/Vector4.h"
+#include "Math/Rotator.h"
+#include "Math/Quat.h"
+#include "Math/Plane.h"
+#include "Math/RotationMatrix.h"
+#include "Math/ScaleMatrix.h"
+#include "Math/Transform.h"
+#include "Math/RandomStream.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	/** Random floats of the typical magnitudes (world coordinates, angles, normals) and some arbitrary bit patterns*/
+	TArray<float> MakeTestValues(int32 const InNum)
+	{
+		FRandomStream Random { 12345 };
+		TArray<float> Values;
+		Values.Reserve(InNum + 8);
+		Values.Append({ 0.0F, -0.0F, 0.5F, -0.0625F, 0.0005F, 1.0e-10F, 123456789.0F, -3.4e38F });
+		for(int32 Index = 0; Index < InNum; ++Index)
+		{
+			switch(Index % 3)
+			{
+			case 0:
+				Values.Add(Random.FRandRange(-100000.0F, 100000.0F));
+				break;
+
+			case 1:
+				Values.Add(Random.FRandRange(-1.0F, 1.0F));
+				break;
+
+			default:
+			{
+				uint32 const Bits = Random.GetUnsignedInt();
+				float Value = 0.0F;
+				FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+				Values.Add(FMath::IsFinite(Value) ? Value : 1.0F);
+				break;
+			}
+			}
+		}
+		return Values;
+	}
+}
+
+DEFINE_SPEC(MyFloatFormatSpec, "MyUtil.Core.Log.MyFloatFormatSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyFloatFormatSpec::Define()
+{
+	Describe("FormatFixed", [this]()
+	{
+		It("should produce the same text as printf", [this]()
+		{
+			TCHAR Buffer[MyFloatFormat::MAX_FLOAT_LEN + 1];
+			for(float const Value : MakeTestValues(10000))
+			{
+				for(int32 Precision = 0; Precision <= MyFloatFormat::MAX_PRECISION; ++Precision)
+				{
+					MyFloatFormat::FormatFixed(Buffer, Value, Precision);
+					FString const Expected = FString::Printf(TEXT("%.*f"), Precision, Value);
+					if( ! TestEqual(FString::Printf(TEXT("%.9g with precision %d"), Value, Precision), FString(Buffer), Expected) )
+					{
+						return;
+					}
+				}
+			}
+		});
+	});
+
+	Describe("FormatShortest", [this]()
+	{
+		It("should read back as the same float", [this]()
+		{
+			TCHAR Buffer[MyFloatFormat::MAX_FLOAT_LEN + 1];
+			for(float const Value : MakeTestValues(10000))
+			{
+				MyFloatFormat::FormatShortest(Buffer, Value);
+				if( ! TestTrue(FString::Printf(TEXT("%.9g read back from \"%s\""), Value, Buffer), FCString::Atof(Buffer) == Value) )
+				{
+					return;
+				}
+			}
+		});
+
+		It("should use the fewest decimals", [this]()
+		{
+			TCHAR Buffer[MyFloatFormat::MAX_FLOAT_LEN + 1];
+			MyFloatFormat::FormatShortest(Buffer, 0.1F);
+			TestEqual(TEXT("0.1"), FString(Buffer), FString(TEXT("0.1")));
+			MyFloatFormat::FormatShortest(Buffer, -2.5F);
+			TestEqual(TEXT("-2.5"), FString(Buffer), FString(TEXT("-2.5")));
+			MyFloatFormat::FormatShortest(Buffer, 100.0F);
+			TestEqual(TEXT("100"), FString(Buffer), FString(TEXT("100")));
+		});
+	});
+
+	Describe("FormatGeneral", [this]()
+	{
+		It("should produce the same text as printf", [this]()
+		{
+			TArray<float> Values = MakeTestValues(10000);
+			// The exponent boundaries and the values rounded up to the next power of ten
+			Values.Append({ 1.0e-4F, 9.99999e-5F, 999999.5F, 999999.4F, 9.999996F, 123456.5F, 1.0e6F });
+			TCHAR Buffer[MyFloatFormat::MAX_FLOAT_LEN + 1];
+			for(float const Value : Values)
+			{
+				MyFloatFormat::FormatGeneral(Buffer, Value);
+				if( ! TestEqual(FString::Printf(TEXT("%.9g"), Value), FString(Buffer), FString::Printf(TEXT("%g"), Value)) )
+				{
+					return;
+				}
+			}
+		});
+	});
+
+	Describe("ToText", [this]()
+	{
+		It("should produce the same text as ToString", [this]()
+		{
+			FVector const Vector { 1.0F, -2.25F, 12345.678F };
+			TestEqual(TEXT("FVector"), FString(*MyFloatFormat::ToText(Vector)), Vector.ToString());
+			FVector2D const Vector2D { 0.333F, -7.0F };
+			TestEqual(TEXT("FVector2D"), FString(*MyFloatFormat::ToText(Vector2D)), Vector2D.ToString());
+			FVector4 const Vector4 { 1.0F, 2.0F, 3.5F, -4.125F };
+			TestEqual(TEXT("FVector4"), FString(*MyFloatFormat::ToText(Vector4)), Vector4.ToString());
+			FRotator const Rotator { 10.5F, -90.0F, 179.999F };
+			TestEqual(TEXT("FRotator"), FString(*MyFloatFormat::ToText(Rotator)), Rotator.ToString());
+			FQuat const Quat = Rotator.Quaternion();
+			TestEqual(TEXT("FQuat"), FString(*MyFloatFormat::ToText(Quat)), Quat.ToString());
+			FMatrix const Matrix = FRotationMatrix { Rotator } * FScaleMatrix { FVector { 0.001F, 1234567.0F, -3.0F } };
+			TestEqual(TEXT("FMatrix"), FString(*MyFloatFormat::ToText(Matrix)), Matrix.ToString());
+			FTransform const Transform { Quat, Vector, FVector { 1.0F, 0.5F, 2.0F } };
+			TestEqual(TEXT("FTransform"), FString(*MyFloatFormat::ToText(Transform)), Transform.ToString());
+		});
+
+		It("should format the plane and the matrix", [this]()
+		{
+			TestEqual(TEXT("FPlane"), FString(*MyFloatFormat::ToText(FPlane { 0.0F, 0.0F, 1.0F, 5.0F })), FString(TEXT("X=0.000 Y=0.000 Z=1.000 W=5.000")));
+			TestEqual
+			(
+				TEXT("FMatrix"), FString(*MyFloatFormat::ToText(FMatrix::Identity, /*InPrecision*/1)),
+				FString(TEXT("[1.0 0.0 0.0 0.0] [0.0 1.0 0.0 0.0] [0.0 0.0 1.0 0.0] [0.0 0.0 0.0 1.0] "))
+			);
+		});
+	});
+}
+
+DEFINE_SPEC(MyFloatFormatBenchmark, "MyUtil.Core.Log.MyFloatFormatBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void MyFloatFormatBenchmark::Define()
+{
+	It("should report ns per value for ToString/Printf and MyFloatFormat", [this]()
+	{
+		constexpr int32 NUM_VALUES = 20000;
+		TArray<float> const Values = MakeTestValues(NUM_VALUES + 16);
+		int64 NumChars = 0;
+
+		// Formats each value by both paths and reports the time per value
+		auto Measure = [this, &NumChars](const TCHAR* const InTypeName, auto InOldPath, auto InNewPath)
+		{
+			double const OldStartSeconds = FPlatformTime::Seconds();
+			for(int32 Index = 0; Index < NUM_VALUES; ++Index)
+			{
+				NumChars += InOldPath(Index).Len();
+			}
+			double const OldSeconds = FPlatformTime::Seconds() - OldStartSeconds;
+
+			double const NewStartSeconds = FPlatformTime::Seconds();
+			for(int32 Index = 0; Index < NUM_VALUES; ++Index)
+			{
+				NumChars += InNewPath(Index).Len();
+			}
+			double const NewSeconds = FPlatformTime::Seconds() - NewStartSeconds;
+
+			AddInfo(FString::Printf(TEXT("%s: ToString %.1f ns, MyFloatFormat %.1f ns"), InTypeName, OldSeconds * 1.0e9 / NUM_VALUES, NewSeconds * 1.0e9 / NUM_VALUES));
+		};
+
+		auto GetVector = [&Values](int32 const InIndex) { return FVector { Values[InIndex], Values[InIndex + 1], Values[InIndex + 2] }; };
+		auto GetRotator = [&Values](int32 const InIndex) { return FRotator { Values[InIndex], Values[InIndex + 1], Values[InIndex + 2] }; };
+
+		Measure(TEXT("float"),
+			[&Values](int32 const InIndex) { return FString::Printf(TEXT("%f"), Values[InIndex]); },
+			[&Values](int32 const InIndex) { FMyMathText Text; Text.AppendFloat(Values[InIndex], MyFloatFormat::ROTATOR_PRECISION); return Text; });
+		Measure(TEXT("float (shortest)"),
+			[&Values](int32 const InIndex) { return FString::Printf(TEXT("%.9g"), Values[InIndex]); },
+			[&Values](int32 const InIndex) { FMyMathText Text; Text.AppendFloat(Values[InIndex], MyFloatFormat::SHORTEST); return Text; });
+		Measure(TEXT("FVector"),
+			[&GetVector](int32 const InIndex) { return GetVector(InIndex).ToString(); },
+			[&GetVector](int32 const InIndex) { return MyFloatFormat::ToText(GetVector(InIndex)); });
+		Measure(TEXT("FVector2D"),
+			[&Values](int32 const InIndex) { return FVector2D { Values[InIndex], Values[InIndex + 1] }.ToString(); },
+			[&Values](int32 const InIndex) { return MyFloatFormat::ToText(FVector2D { Values[InIndex], Values[InIndex + 1] }); });
+		Measure(TEXT("FVector4"),
+			[&Values](int32 const InIndex) { return FVector4 { Values[InIndex], Values[InIndex + 1], Values[InIndex + 2], Values[InIndex + 3] }.ToString(); },
+			[&Values](int32 const InIndex) { return MyFloatFormat::ToText(FVector4 { Values[InIndex], Values[InIndex + 1], Values[InIndex + 2], Values[InIndex + 3] }); });
+		Measure(TEXT("FRotator"),
+			[&GetRotator](int32 const InIndex) { return GetRotator(InIndex).ToString(); },
+			[&GetRotator](int32 const InIndex) { return MyFloatFormat::ToText(GetRotator(InIndex)); });
+		Measure(TEXT("FQuat"),
+			[&Values](int32 const InIndex) { return FQuat { Values[InIndex], Values[InIndex + 1], Values[InIndex + 2], Values[InIndex + 3] }.ToString(); },
+			[&Values](int32 const InIndex) { return MyFloatFormat::ToText(FQuat { Values[InIndex], Values[InIndex + 1], Values[InIndex + 2], Values[InIndex + 3] }); });
+		Measure(TEXT("FPlane"),
+			[&Values](int32 const InIndex) { return FPlane { Values[InIndex], Values[InIndex + 1], Values[InIndex + 2], Values[InIndex + 3] }.ToString(); },
+			[&Values](int32 const InIndex) { return MyFloatFormat::ToText(FPlane { Values[InIndex], Values[InIndex + 1], Values[InIndex + 2], Values[InIndex + 3] }); });
+		Measure(TEXT("FMatrix"),
+			[&GetRotator](int32 const InIndex) { return FRotationMatrix { GetRotator(InIndex) }.ToString(); },
+			[&GetRotator](int32 const InIndex) { return MyFloatFormat::ToText(FRotationMatrix { GetRotator(InIndex) }); });
+		Measure(TEXT("FTransform"),
+			[&GetRotator, &GetVector](int32 const InIndex) { return FTransform { GetRotator(InIndex), GetVector(InIndex + 3), GetVector(InIndex + 6) }.ToString(); },
+			[&GetRotator, &GetVector](int32 const InIndex) { return MyFloatFormat::ToText(FTransform { GetRotator(InIndex), GetVector(InIndex + 3), GetVector(InIndex + 6) }); });
+
+		// Keeps the results alive
+		TestTrue(TEXT("Something is formatted"), NumChars > 0);
+	});
+}
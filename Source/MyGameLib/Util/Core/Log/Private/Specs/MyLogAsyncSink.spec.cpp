@@ -0,0 +1,93 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyLogAsyncSink.h"
+#include "Util/Core/MyDebugMacros.h"
+#include "Misc/OutputDeviceRedirector.h"
+#include "Misc/Guid.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformProcess.h"
+
+namespace
+{
+	/**
+	* Collects the lines containing the marker with their timestamps.
+	*/
+	class FMyLogAsyncSinkSpecDevice : public FOutputDevice
+	{
+	public:
+		explicit FMyLogAsyncSinkSpecDevice(const FString& InMarker) :
+			Marker ( InMarker )
+		{
+		}
+
+		FString Marker;
+		TArray<FString> Lines;
+		TArray<double> Times;
+
+		virtual void Serialize(const TCHAR* const InData, ELogVerbosity::Type const InVerbosity, const FName& InCategory) override
+		{
+			Serialize(InData, InVerbosity, InCategory, FPlatformTime::Seconds() - GStartTime);
+		}
+
+		virtual void Serialize(const TCHAR* const InData, ELogVerbosity::Type, const FName&, double const InTime) override
+		{
+			if(FCString::Strstr(InData, *Marker))
+			{
+				Lines.Add(InData);
+				Times.Add(InTime);
+			}
+		}
+	};
+}
+
+DEFINE_SPEC(MyLogAsyncSinkSpec, "MyUtil.Core.Log.MyLogAsyncSinkSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogAsyncSinkSpec::Define()
+{
+	Describe("FMyLogAsyncRing", [this]()
+	{
+		It("should round the capacity up to the power of two", [this]()
+		{
+			FMyLogAsyncRing const Ring { 5 };
+			TestEqual(TEXT("Capacity"), Ring.GetCapacity(), 8U);
+		});
+
+		It("should reject the line when full and drain the lines in order", [this]()
+		{
+			FMyLogAsyncRing Ring { 4 };
+			for(int32 Index = 0; Index < 4; ++Index)
+			{
+				TestTrue(TEXT("Push must succeed while there's space"), Ring.TryPush(MyLog, ELogVerbosity::Log, *FString::FromInt(Index)));
+			}
+			TestFalse(TEXT("Push must fail when full"), Ring.TryPush(MyLog, ELogVerbosity::Log, TEXT("Overflow")));
+			TestEqual(TEXT("Number of the records when full"), Ring.Num(), 4U);
+
+			TArray<FString> Drained;
+			int32 const NumDrained = Ring.Drain([&Drained](const FMyLogAsyncRecord& InRecord)
+			{
+				Drained.Add(InRecord.Text);
+			});
+			TestEqual(TEXT("All lines must be drained"), NumDrained, 4);
+			TestEqual(TEXT("Lines must be drained in order"), Drained, TArray<FString>{ TEXT("0"), TEXT("1"), TEXT("2"), TEXT("3") });
+			TestTrue(TEXT("Ring must be empty after the drain"), Ring.IsEmpty());
+			TestEqual(TEXT("Number of the records after the drain"), Ring.Num(), 0U);
+			TestTrue(TEXT("Push must succeed after the drain"), Ring.TryPush(MyLog, ELogVerbosity::Log, TEXT("Next")));
+		});
+	});
+
+	Describe("FMyLogAsyncSink", [this]()
+	{
+		It("should write all the pushed lines on flush", [this]()
+		{
+			FMyLogAsyncSink& Sink = FMyLogAsyncSink::Get();
+			if( ! Sink.IsRunning() )
+			{
+				AddInfo(TEXT("Async sink is NOT running on this platform"));
+				return;
+			}
+			TestTrue(TEXT("Push must succeed"), Sink.Push(MyLog, ELogVerbosity::Log, TEXT("MyLogAsyncSinkSpec: pushed line")));
+			Sink.Flush();
+			// Flush must return only when everything is written, so the second flush has nothing to do
+			Sink.Flush();
+		});
+	});
+}
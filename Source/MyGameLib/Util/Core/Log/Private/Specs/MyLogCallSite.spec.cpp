@@ -0,0 +1,127 @@
+#include "AutomationTest.h"
+#include "Util/Core/MyDebugMacros.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	/**
+	* @returns: nanoseconds per one line built.
+	*/
+	template<class BuildLineFuncT>
+	double MeasureNsPerLine(int32 const InNumLines, BuildLineFuncT InBuildLine)
+	{
+		int32 TotalLen = 0;
+		double const StartSeconds = FPlatformTime::Seconds();
+		for(int32 LineIndex = 0; LineIndex < InNumLines; ++LineIndex)
+		{
+			TotalLen += InBuildLine(LineIndex);
+		}
+		double const ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+		check(TotalLen > 0);
+		return ElapsedSeconds * 1.0e9 / InNumLines;
+	}
+}
+
+DEFINE_SPEC(MyLogCallSiteSpec, "MyUtil.Core.Log.MyLogCallSiteSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogCallSiteSpec::Define()
+{
+	Describe("FormatLine", [this]()
+	{
+		It("should produce the same text as the string debug macros", [this]()
+		{
+			// Both on the same line, so __LINE__ is the same
+			M_DECLARE_LOG_CALL_SITE(Site); FString const Expected = M_DEBUG_LOG_PREFIX + FString::Printf(TEXT("Value=%d Name=%s"), 5, TEXT("Test")) + M_DEBUG_LOG_POSTFIX;
+			FMyLogLine Line;
+			MyLog::FormatLine(Line, Site, TEXT("Value=%d Name=%s"), 5, TEXT("Test"));
+			TestEqual(TEXT("Line text"), FString(Line.GetData()), Expected);
+			TestFalse(TEXT("Short line must NOT be truncated"), Line.IsTruncated());
+		});
+
+		It("should truncate too long message and keep the postfix", [this]()
+		{
+			M_DECLARE_LOG_CALL_SITE(Site);
+			FString const LongMessage = FString::ChrN(FMyLogLine::CAPACITY * 2, TEXT('x'));
+			FMyLogLine Line;
+			MyLog::FormatLine(Line, Site, TEXT("%s"), *LongMessage);
+			TestTrue(TEXT("Line must be truncated"), Line.IsTruncated());
+			TestTrue(TEXT("Line must fit the capacity"), Line.Len() < FMyLogLine::CAPACITY);
+			TestEqual(TEXT("Length must match the text"), FCString::Strlen(Line.GetData()), Line.Len());
+			TestTrue(TEXT("Postfix must be kept"), FString(Line.GetData()).EndsWith(Site.Postfix));
+		});
+	});
+
+	Describe("Registry", [this]()
+	{
+		It("should register the call site", [this]()
+		{
+			M_DECLARE_LOG_CALL_SITE_LEVEL(Site, Warning);
+			bool bFound = false;
+			for(const FMyLogCallSite* Registered = FMyLogCallSite::GetFirst(); Registered; Registered = Registered->GetNext())
+			{
+				bFound = bFound || (Registered == &Site);
+			}
+			TestTrue(TEXT("Site must be registered"), bFound);
+			TestEqual(TEXT("Verbosity"), static_cast<int32>(Site.Verbosity), static_cast<int32>(ELogVerbosity::Warning));
+		});
+
+		It("should disable and enable the matching sites including the sites registered later", [this]()
+		{
+			FString const Wildcard = TEXT("MyLogCallSite.spec.cpp");
+			M_DECLARE_LOG_CALL_SITE(Site);
+			TestTrue(TEXT("Matched sites must be counted"), MyLog::SetSitesEnabled(Wildcard, false) > 0);
+			TestFalse(TEXT("Matching site must be disabled"), Site.IsEnabled());
+
+			auto const GetLateSite = []() -> const FMyLogCallSite&
+			{
+				M_DECLARE_LOG_CALL_SITE(LateSite);
+				return LateSite;
+			};
+			TestFalse(TEXT("Site registered after the rule must be disabled"), GetLateSite().IsEnabled());
+
+			MyLog::SetSitesEnabled(Wildcard, true);
+			TestTrue(TEXT("Matching site must be enabled again"), Site.IsEnabled());
+			TestTrue(TEXT("Late site must be enabled again"), GetLateSite().IsEnabled());
+			TestTrue(TEXT("Rule must be removed"), MyLog::RemoveSitesRule(Wildcard));
+		});
+	});
+}
+
+DEFINE_SPEC(MyLogCallSiteBenchmark, "MyUtil.Core.Log.MyLogCallSiteBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogCallSiteBenchmark::Define()
+{
+	It("should report ns per line for the string macros and the call site", [this]()
+	{
+		constexpr int32 NUM_LINES = 100000;
+		double const StringMacrosNs = MeasureNsPerLine(NUM_LINES, [](int32 const InIndex)
+		{
+			FString const Line = FString::Printf(TEXT("%s%s%s"), *M_DEBUG_LOG_PREFIX, *FString::Printf(TEXT("Index=%d Value=%f"), InIndex, 0.5F), *M_DEBUG_LOG_POSTFIX);
+			return Line.Len();
+		});
+		double const CallSiteNs = MeasureNsPerLine(NUM_LINES, [](int32 const InIndex)
+		{
+			M_DECLARE_LOG_CALL_SITE(Site);
+			FMyLogLine Line;
+			MyLog::FormatLine(Line, Site, TEXT("Index=%d Value=%f"), InIndex, 0.5F);
+			return Line.Len();
+		});
+
+		double const DisabledSiteNs = MeasureNsPerLine(NUM_LINES, [](int32 const InIndex)
+		{
+			M_DECLARE_LOG_CALL_SITE(Site);
+			Site.SetEnabled(false);
+			if(Site.IsEnabled())
+			{
+				FMyLogLine Line;
+				MyLog::FormatLine(Line, Site, TEXT("Index=%d Value=%f"), InIndex, 0.5F);
+				return Line.Len();
+			}
+			return 1;
+		});
+
+		AddInfo(FString::Printf(TEXT("String macros (M_DEBUG_LOG_PREFIX/POSTFIX): %.1f ns/line"), StringMacrosNs));
+		AddInfo(FString::Printf(TEXT("Call site (FMyLogLine): %.1f ns/line"), CallSiteNs));
+		AddInfo(FString::Printf(TEXT("Disabled call site: %.1f ns/line"), DisabledSiteNs));
+	});
+}
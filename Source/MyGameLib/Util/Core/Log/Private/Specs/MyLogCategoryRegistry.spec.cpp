@@ -0,0 +1,126 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyLogCategoryRegistry.h"
+#include "Util/Core/XprUtilLib.h"
+#include "UObject/Package.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	/**
+	* Collects the lines written to the sink of the category.
+	*/
+	class FMyLogCategorySpecDevice : public FOutputDevice
+	{
+	public:
+		TArray<FString> Lines;
+		TArray<FName> Categories;
+
+		virtual void Serialize(const TCHAR* const InData, ELogVerbosity::Type, const FName& InCategory) override
+		{
+			Lines.Add(InData);
+			Categories.Add(InCategory);
+		}
+	};
+}
+
+DEFINE_SPEC(MyLogCategoryRegistrySpec, "MyUtil.Core.Log.MyLogCategoryRegistrySpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogCategoryRegistrySpec::Define()
+{
+	It("should return the same category for the same name", [this]()
+	{
+		FMyLogDynamicCategory& Category = FMyLogCategoryRegistry::FindOrAdd(TEXT("MyLogCategoryRegistrySpec_Same"));
+		TestEqual(TEXT("FindOrAdd"), &FMyLogCategoryRegistry::FindOrAdd(TEXT("MyLogCategoryRegistrySpec_Same"), ELogVerbosity::Verbose), &Category);
+		TestEqual(TEXT("Find"), FMyLogCategoryRegistry::Find(TEXT("MyLogCategoryRegistrySpec_Same")), &Category);
+		TestEqual(TEXT("UXprUtilLib"), &UXprUtilLib::GetDynamicLogCategory(TEXT("MyLogCategoryRegistrySpec_Same")), &Category);
+		TestEqual(TEXT("Name"), Category.GetName(), FName(TEXT("MyLogCategoryRegistrySpec_Same")));
+		TestTrue(TEXT("Default verbosity of the first call is kept"), Category.GetVerbosity() == ELogVerbosity::Log);
+		TestNull(TEXT("Find of the unregistered"), FMyLogCategoryRegistry::Find(TEXT("MyLogCategoryRegistrySpec_Unregistered")));
+	});
+
+	It("should name the category of the class", [this]()
+	{
+		FMyLogDynamicCategory& Category = FMyLogCategoryRegistry::FindOrAddForClass(UPackage::StaticClass());
+		TestEqual(TEXT("Name"), Category.GetName(), FName(TEXT("MyLog_Package")));
+	});
+
+	It("should write only the lines NOT suppressed by the verbosity to the sink", [this]()
+	{
+		FMyLogDynamicCategory& Category = FMyLogCategoryRegistry::FindOrAdd(TEXT("MyLogCategoryRegistrySpec_Sink"));
+		FMyLogCategorySpecDevice Device;
+		Category.SetSink(&Device);
+		Category.SetVerbosity(ELogVerbosity::Log);
+
+		M_LOG_DYN(Category, Log, TEXT("Written %d"), 1);
+		M_LOG_DYN(Category, Verbose, TEXT("Suppressed %d"), 2);
+		UXprUtilLib::LogByCategory(Category, ELogVerbosity::Warning, TEXT("Written by UXprUtilLib"));
+		Category.SetVerbosity(ELogVerbosity::VeryVerbose);
+		M_LOG_DYN(Category, Verbose, TEXT("Written %d"), 3);
+		Category.SetSink(nullptr);
+		Category.SetVerbosity(ELogVerbosity::Log);
+
+		TArray<FString> const Expected { TEXT("Written 1"), TEXT("Written by UXprUtilLib"), TEXT("Written 3") };
+		TestEqual(TEXT("Lines"), Device.Lines, Expected);
+		TestTrue(TEXT("Category of the lines"), Device.Categories.Num() > 0 && Device.Categories[0] == Category.GetName());
+	});
+
+	It("should count the lines by the call site as M_LOG does", [this]()
+	{
+		IConsoleVariable* const CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("MyLog.Stats"));
+		if( ! TestNotNull(TEXT("MyLog.Stats"), CVar) )
+		{
+			return;
+		}
+		FMyLogDynamicCategory& Category = FMyLogCategoryRegistry::FindOrAdd(TEXT("MyLogCategoryRegistrySpec_Stats"));
+		FMyLogCategorySpecDevice Device;
+		Category.SetSink(&Device);
+		int32 const OldValue = CVar->GetInt();
+		CVar->Set(1);
+		static FMyLogCallSite const Site { __FUNCTION__, __FILE__, __LINE__ };
+		// The static site keeps its counters between the runs of the test, so only the increment is checked
+		auto const OldNumCalls = Site.GetCounters().NumCalls.load();
+		auto const OldNumBytes = Site.GetCounters().NumBytes.load();
+		Category.Logf(Site, ELogVerbosity::Log, TEXT("Counted %d"), 1);
+		CVar->Set(OldValue);
+		Category.SetSink(nullptr);
+
+		TestEqual(TEXT("Lines"), Device.Lines, TArray<FString>{ TEXT("Counted 1") });
+		TestTrue(TEXT("Calls"), Site.GetCounters().NumCalls.load() == OldNumCalls + 1);
+		TestTrue(TEXT("Bytes"), Site.GetCounters().NumBytes.load() > OldNumBytes);
+	});
+}
+
+DEFINE_SPEC(MyLogCategoryRegistryBenchmark, "MyUtil.Core.Log.MyLogCategoryRegistryBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogCategoryRegistryBenchmark::Define()
+{
+	It("should report ns per suppressed and per written line", [this]()
+	{
+		constexpr int32 NUM_LINES = 1000000;
+		FMyLogDynamicCategory& Category = FMyLogCategoryRegistry::FindOrAdd(TEXT("MyLogCategoryRegistryBenchmark"));
+		FMyLogCategorySpecDevice Device;
+		Device.Lines.Reserve(NUM_LINES);
+		Device.Categories.Reserve(NUM_LINES);
+		Category.SetSink(&Device);
+		Category.SetVerbosity(ELogVerbosity::Log);
+
+		double const SuppressedStartSeconds = FPlatformTime::Seconds();
+		for(int32 LineIndex = 0; LineIndex < NUM_LINES; ++LineIndex)
+		{
+			M_LOG_DYN(Category, Verbose, TEXT("Line %d"), LineIndex);
+		}
+		double const SuppressedSeconds = FPlatformTime::Seconds() - SuppressedStartSeconds;
+
+		double const WrittenStartSeconds = FPlatformTime::Seconds();
+		for(int32 LineIndex = 0; LineIndex < NUM_LINES; ++LineIndex)
+		{
+			M_LOG_DYN(Category, Log, TEXT("Line %d"), LineIndex);
+		}
+		double const WrittenSeconds = FPlatformTime::Seconds() - WrittenStartSeconds;
+		Category.SetSink(nullptr);
+
+		TestEqual(TEXT("Number of the lines written"), Device.Lines.Num(), NUM_LINES);
+		AddInfo(FString::Printf(TEXT("Dynamic category: suppressed %.1f ns, written %.1f ns"), SuppressedSeconds * 1.0e9 / NUM_LINES, WrittenSeconds * 1.0e9 / NUM_LINES));
+	});
+}
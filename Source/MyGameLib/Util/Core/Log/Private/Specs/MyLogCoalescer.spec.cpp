@@ -0,0 +1,90 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyLogCoalescer.h"
+#include "Util/Core/Log/MyLogCallSite.h"
+#include "Util/Core/MyDebugMacros.h"
+#include "Misc/OutputDeviceRedirector.h"
+
+namespace
+{
+	/**
+	* Collects the lines that contain the marker.
+	*/
+	class FMyLogCoalescerSpecDevice : public FOutputDevice
+	{
+	public:
+		TArray<FString> Lines;
+
+		virtual void Serialize(const TCHAR* const InData, ELogVerbosity::Type, const FName&) override
+		{
+			if(FCString::Strstr(InData, TEXT("MyLogCoalescerSpec_Summary")))
+			{
+				Lines.Add(InData);
+			}
+		}
+	};
+}
+
+DEFINE_SPEC(MyLogCoalescerSpec, "MyUtil.Core.Log.MyLogCoalescerSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogCoalescerSpec::Define()
+{
+	It("should reject the consecutive duplicates of the call site", [this]()
+	{
+		static FMyLogCallSite const Site { __FUNCTION__, __FILE__, __LINE__ };
+		FMyLogCoalescer::Flush();
+		TestTrue(TEXT("First line"), FMyLogCoalescer::Add(Site, MyLog, ELogVerbosity::Log, TEXT("MyLogCoalescerSpec: line")));
+		TestFalse(TEXT("Duplicate"), FMyLogCoalescer::Add(Site, MyLog, ELogVerbosity::Log, TEXT("MyLogCoalescerSpec: line")));
+		TestFalse(TEXT("Second duplicate"), FMyLogCoalescer::Add(Site, MyLog, ELogVerbosity::Log, TEXT("MyLogCoalescerSpec: line")));
+		TestTrue(TEXT("Different text"), FMyLogCoalescer::Add(Site, MyLog, ELogVerbosity::Log, TEXT("MyLogCoalescerSpec: other line")));
+		TestTrue(TEXT("The previous text again"), FMyLogCoalescer::Add(Site, MyLog, ELogVerbosity::Log, TEXT("MyLogCoalescerSpec: line")));
+		FMyLogCoalescer::Flush();
+	});
+
+	It("should NOT coalesce the same text of the different call sites", [this]()
+	{
+		static FMyLogCallSite const FirstSite { __FUNCTION__, __FILE__, __LINE__ };
+		static FMyLogCallSite const SecondSite { __FUNCTION__, __FILE__, __LINE__ };
+		FMyLogCoalescer::Flush();
+		TestTrue(TEXT("First site"), FMyLogCoalescer::Add(FirstSite, MyLog, ELogVerbosity::Log, TEXT("MyLogCoalescerSpec: line")));
+		TestTrue(TEXT("Second site"), FMyLogCoalescer::Add(SecondSite, MyLog, ELogVerbosity::Log, TEXT("MyLogCoalescerSpec: line")));
+		FMyLogCoalescer::Flush();
+	});
+
+	It("should write the summary of the duplicates on the flush", [this]()
+	{
+		static FMyLogCallSite const Site { __FUNCTION__, __FILE__, __LINE__ };
+		FMyLogCoalescer::Flush();
+		FMyLogCoalescerSpecDevice Device;
+		GLog->AddOutputDevice(&Device);
+		// LogTemp: the summary goes to GLog (MyLog lines may be taken by the sinks)
+		FMyLogCoalescer::Add(Site, LogTemp, ELogVerbosity::Log, TEXT("MyLogCoalescerSpec_Summary: line"));
+		for(int32 RepeatIndex = 0; RepeatIndex < 3; ++RepeatIndex)
+		{
+			FMyLogCoalescer::Add(Site, LogTemp, ELogVerbosity::Log, TEXT("MyLogCoalescerSpec_Summary: line"));
+		}
+		FMyLogCoalescer::Flush();
+		GLog->FlushThreadedLogs();
+		GLog->RemoveOutputDevice(&Device);
+
+		if( ! TestEqual(TEXT("Only the summary must be written"), Device.Lines.Num(), 1) )
+		{
+			return;
+		}
+		const FString& Summary = Device.Lines[0];
+		FString const ExpectedStart = TEXT("MyLogCoalescerSpec_Summary: line [repeated 3 times over ");
+		TestTrue(TEXT("Summary text and count"), Summary.StartsWith(ExpectedStart) && Summary.EndsWith(TEXT(" ms]")));
+		FString const SpanText = Summary.Mid(ExpectedStart.Len(), Summary.Len() - ExpectedStart.Len() - 4);
+		TestTrue(TEXT("Span must be the number of ms"), SpanText.IsNumeric() && FCString::Atod(*SpanText) >= 0.0);
+	});
+
+	It("should start the new run after the flush", [this]()
+	{
+		static FMyLogCallSite const Site { __FUNCTION__, __FILE__, __LINE__ };
+		FMyLogCoalescer::Flush();
+		TestTrue(TEXT("First line"), FMyLogCoalescer::Add(Site, MyLog, ELogVerbosity::Log, TEXT("MyLogCoalescerSpec: line")));
+		TestFalse(TEXT("Duplicate"), FMyLogCoalescer::Add(Site, MyLog, ELogVerbosity::Log, TEXT("MyLogCoalescerSpec: line")));
+		FMyLogCoalescer::Flush();
+		TestTrue(TEXT("Line after the flush"), FMyLogCoalescer::Add(Site, MyLog, ELogVerbosity::Log, TEXT("MyLogCoalescerSpec: line")));
+		FMyLogCoalescer::Flush();
+	});
+}
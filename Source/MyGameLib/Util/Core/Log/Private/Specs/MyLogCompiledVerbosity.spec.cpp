@@ -0,0 +1,112 @@
+#include "AutomationTest.h"
+#include "Util/Core/MyDebugMacros.h"
+
+static_assert(M_LOG_IS_COMPILED_IN(Fatal), "Fatal must always be compiled in");
+static_assert(M_LOG_IS_COMPILED_IN(Log) || ! M_LOG_SCOPES_COMPILED_IN, "Scoped helpers must NOT be compiled in without the Log level");
+
+// Expansion of the scoped helper as the string literal: checked at compile time in every configuration
+#define M_SPEC_EXPANSION_STRING_IMPL(...) #__VA_ARGS__
+#define M_SPEC_EXPANSION_STRING(...) M_SPEC_EXPANSION_STRING_IMPL(__VA_ARGS__)
+#if M_LOG_SCOPES_COMPILED_IN
+static_assert(sizeof(M_SPEC_EXPANSION_STRING(M_LOGFUNC_NAMED_STRING_IF_TO(Spec, true, MyLog, TEXT("Scope")))) > 1, "Scoped helper must declare the call site when the Log level is compiled in");
+#else
+static_assert(sizeof(M_SPEC_EXPANSION_STRING(M_LOGFUNC_NAMED_STRING_IF_TO(Spec, true, MyLog, TEXT("Scope")))) == 1, "Scoped helper must expand to nothing (NO call site, NO message) when the Log level is NOT compiled in");
+#endif // M_LOG_SCOPES_COMPILED_IN
+
+namespace
+{
+	int32 GNumEvaluated = 0;
+
+	/** @returns: the flags disabling the lines below the warnings (so the spec writes nothing)*/
+	ELogFlags CountFlags()
+	{
+		++GNumEvaluated;
+		return ELogFlags::DisableLog;
+	}
+
+	const FMyLogCallSite* FindSite(const ANSICHAR* const InFile, int32 const InLine)
+	{
+		for(const FMyLogCallSite* Site = FMyLogCallSite::GetFirst(); Site; Site = Site->GetNext())
+		{
+			if(Site->Line == InLine && FCStringAnsi::Strcmp(Site->File, InFile) == 0)
+			{
+				return Site;
+			}
+		}
+		return nullptr;
+	}
+
+	int32 CountArg()
+	{
+		++GNumEvaluated;
+		return 0;
+	}
+
+// ~Lowered compiled-in verbosity Begin
+// M_LOG_IS_COMPILED_IN reads the threshold where it's expanded, so the stripped branch is checked by the local redefinition
+// (M_LOG_SCOPES_COMPILED_IN is fixed when MyDebugMacros.h is included, so the scopes are NOT affected)
+#pragma push_macro("MY_LOG_COMPILED_IN_VERBOSITY")
+#undef MY_LOG_COMPILED_IN_VERBOSITY
+#define MY_LOG_COMPILED_IN_VERBOSITY Warning
+
+	static_assert(M_LOG_IS_COMPILED_IN(Error), "Error must be compiled in with the Warning threshold");
+	static_assert(M_LOG_IS_COMPILED_IN(Warning), "Warning must be compiled in with the Warning threshold");
+	static_assert( ! M_LOG_IS_COMPILED_IN(Display), "Display must be stripped with the Warning threshold");
+	static_assert( ! M_LOG_IS_COMPILED_IN(Log), "Log must be stripped with the Warning threshold");
+	static_assert( ! M_LOG_IS_COMPILED_IN(Verbose), "Verbose must be stripped with the Warning threshold");
+	static_assert( ! M_LOG_IS_COMPILED_IN(VeryVerbose), "VeryVerbose must be stripped with the Warning threshold");
+
+	/** Logs the stripped levels: @returns: the line of the Log level*/
+	int32 LogStrippedLevels()
+	{
+		M_LOG_CUSTOM_TO_IF_FLAGS(CountFlags(), MyLog, Verbose, TEXT("Stripped Verbose %d"), CountArg());
+		M_LOG_CUSTOM_TO_IF_FLAGS(CountFlags(), MyLog, Display, TEXT("Stripped Display %d"), CountArg());
+		int32 const LogLine = __LINE__; M_LOG_CUSTOM_TO(MyLog, Log, TEXT("Stripped Log %d"), CountArg());
+		return LogLine;
+	}
+
+#pragma pop_macro("MY_LOG_COMPILED_IN_VERBOSITY")
+// ~Lowered compiled-in verbosity End
+}
+
+DEFINE_SPEC(MyLogCompiledVerbositySpec, "MyUtil.Core.Log.MyLogCompiledVerbositySpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogCompiledVerbositySpec::Define()
+{
+	It("should NOT evaluate the flags of the levels that are NOT compiled in", [this]()
+	{
+		GNumEvaluated = 0;
+		M_LOG_VERY_VERBOSE_IF_FLAGS(CountFlags(), TEXT("Stripped if VeryVerbose is NOT compiled in"));
+		TestEqual(TEXT("Number of evaluations of VeryVerbose flags"), GNumEvaluated, M_LOG_IS_COMPILED_IN(VeryVerbose) ? 1 : 0);
+
+		GNumEvaluated = 0;
+		M_LOG_CUSTOM_TO_IF_FLAGS(CountFlags(), MyLog, Display, TEXT("Display is compiled in (%s)"), TEXT("flags are evaluated"));
+		TestEqual(TEXT("Number of evaluations of Display flags"), GNumEvaluated, M_LOG_IS_COMPILED_IN(Display) ? 1 : 0);
+	});
+
+	It("should strip the levels below the lowered compiled-in verbosity", [this]()
+	{
+		// The thresholds themselves are checked by the static_asserts above
+		GNumEvaluated = 0;
+		int32 const LogLine = LogStrippedLevels();
+		TestEqual(TEXT("Number of evaluations of the flags and the arguments"), GNumEvaluated, 0);
+		TestNull(TEXT("Call site of the stripped line must NOT be registered"), FindSite(__FILE__, LogLine));
+	});
+
+	It("should compile the scoped helpers to nothing when the Log level is NOT compiled in", [this]()
+	{
+		// The expansion itself is checked by the static_assert above
+		GNumEvaluated = 0;
+		int32 ScopeLine = 0;
+		{
+			ScopeLine = __LINE__; M_LOGBLOCK_IF(false, TEXT("Scope %d"), CountArg());
+		}
+		TestEqual(TEXT("Number of evaluations of the message"), GNumEvaluated, 0);
+		const FMyLogCallSite* const ScopeSite = FindSite(__FILE__, ScopeLine);
+#if M_LOG_SCOPES_COMPILED_IN
+		TestNotNull(TEXT("Call site of the scope must be registered"), ScopeSite);
+#else
+		TestNull(TEXT("Call site of the scope must NOT be registered"), ScopeSite);
+#endif // M_LOG_SCOPES_COMPILED_IN
+	});
+}
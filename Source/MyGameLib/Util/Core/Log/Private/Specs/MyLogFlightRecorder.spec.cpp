@@ -0,0 +1,80 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyLogFlightRecorder.h"
+#include "Util/Core/MyDebugMacros.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_SPEC(MyLogFlightRecorderSpec, "MyUtil.Core.Log.MyLogFlightRecorderSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogFlightRecorderSpec::Define()
+{
+	It("should keep the recorded lines in order", [this]()
+	{
+		FMyLogFlightRecorder::Record(MyLog, ELogVerbosity::Log, TEXT("MyLogFlightRecorderSpec: first"));
+		FMyLogFlightRecorder::Record(MyLog, ELogVerbosity::Warning, TEXT("MyLogFlightRecorderSpec: second"));
+
+		TArray<FString> const Lines = FMyLogFlightRecorder::GetLines();
+		if( ! TestTrue(TEXT("At least two lines"), Lines.Num() >= 2) )
+		{
+			return;
+		}
+		TestTrue(TEXT("First line"), Lines[Lines.Num() - 2].EndsWith(TEXT("MyLog: MyLogFlightRecorderSpec: first")));
+		TestTrue(TEXT("Second line with the verbosity"), Lines.Last().EndsWith(TEXT("MyLog: Warning: MyLogFlightRecorderSpec: second")));
+	});
+
+	It("should overwrite the oldest lines", [this]()
+	{
+		FMyLogFlightRecorder::Record(MyLog, ELogVerbosity::Log, TEXT("MyLogFlightRecorderSpec: overwritten"));
+		int32 const Capacity = FMyLogFlightRecorder::GetCapacity();
+		for(int32 Index = 0; Index < Capacity; ++Index)
+		{
+			FMyLogFlightRecorder::Record(MyLog, ELogVerbosity::Log, *FString::Printf(TEXT("MyLogFlightRecorderSpec: %d"), Index));
+		}
+
+		TArray<FString> const Lines = FMyLogFlightRecorder::GetLines();
+		TestEqual(TEXT("Number of lines"), Lines.Num(), Capacity);
+		TestTrue(TEXT("Oldest line"), Lines[0].EndsWith(TEXT("MyLogFlightRecorderSpec: 0")));
+		TestFalse(TEXT("Overwritten line"), Lines.ContainsByPredicate([](const FString& InLine) { return InLine.EndsWith(TEXT("overwritten")); }));
+	});
+
+	It("should truncate the long lines", [this]()
+	{
+		FString const LongText = FString::ChrN(FMyLogFlightRecorder::TEXT_CAPACITY * 2, TEXT('x'));
+		FMyLogFlightRecorder::Record(MyLog, ELogVerbosity::Log, *LongText);
+		TestTrue(TEXT("Truncated line"), FMyLogFlightRecorder::GetLines().Last().EndsWith(LongText.Left(FMyLogFlightRecorder::TEXT_CAPACITY - 1)));
+	});
+
+	It("should dump the lines to the file", [this]()
+	{
+		FMyLogFlightRecorder::Record(MyLog, ELogVerbosity::Log, TEXT("MyLogFlightRecorderSpec: dumped"));
+		FString const Filename = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("MyLogFlightRecorderSpec.log"));
+		if( ! TestTrue(TEXT("Dump must succeed"), FMyLogFlightRecorder::Dump(Filename)) )
+		{
+			return;
+		}
+		FString Text;
+		TestTrue(TEXT("Dump must be readable"), FFileHelper::LoadFileToString(Text, *Filename));
+		TestTrue(TEXT("Dumped line"), Text.Contains(TEXT("MyLogFlightRecorderSpec: dumped")));
+		IFileManager::Get().Delete(*Filename);
+	});
+}
+
+DEFINE_SPEC(MyLogFlightRecorderBenchmark, "MyUtil.Core.Log.MyLogFlightRecorderBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogFlightRecorderBenchmark::Define()
+{
+	It("should report ns per recorded line", [this]()
+	{
+		constexpr int32 NUM_LINES = 100000;
+		const TCHAR* const Text = TEXT("UTUMovementComponent::UpdateComponentVelocity: Velocity : \"X=1.000 Y=2.000 Z=3.000\" (line: 120 : TUMovementComponent.cpp )");
+		double const StartSeconds = FPlatformTime::Seconds();
+		for(int32 LineIndex = 0; LineIndex < NUM_LINES; ++LineIndex)
+		{
+			FMyLogFlightRecorder::Record(MyLog, ELogVerbosity::Log, Text);
+		}
+		double const Seconds = FPlatformTime::Seconds() - StartSeconds;
+		AddInfo(FString::Printf(TEXT("Record: %.1f ns/line"), Seconds * 1.0e9 / NUM_LINES));
+	});
+}
@@ -0,0 +1,139 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyLogKV.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/Package.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_SPEC(MyLogKVSpec, "MyUtil.Core.Log.MyLogKVSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogKVSpec::Define()
+{
+	Describe("Text", [this]()
+	{
+		It("should format the pairs the same way as the ULogUtilLib::Log* functions did", [this]()
+		{
+			M_DECLARE_LOG_CALL_SITE(Site);
+			FMyLogLine Line;
+			MyLogKV::FormatLine(Line, Site, /*bInJson*/false,
+				TEXT("Int"), 42, TEXT("Float"), 0.5F, TEXT("Double"), 2.25, TEXT("Flag"), true, TEXT("String"), FString(TEXT("Text")), TEXT("Name"), FName(TEXT("TestName")));
+			FString const Expected = Site.Prefix
+				+ FString::Printf(TEXT("Int : %d, Float : %f, Double : %lf, Flag : YES, String : \"Text\", Name : \"TestName\""), 42, 0.5F, 2.25)
+				+ Site.Postfix;
+			TestEqual(TEXT("Line"), FString(Line.GetData()), Expected);
+		});
+
+		It("should quote the math values", [this]()
+		{
+			M_DECLARE_LOG_CALL_SITE(Site);
+			FVector const Vector { 1.0F, 2.5F, -3.0F };
+			FMyLogLine Line;
+			MyLogKV::FormatLine(Line, Site, /*bInJson*/false, TEXT("Location"), Vector);
+			TestEqual(TEXT("Line"), FString(Line.GetData()), Site.Prefix + FString::Printf(TEXT("Location : \"%s\""), *MyFloatFormat::ToText(Vector)) + Site.Postfix);
+		});
+	});
+
+	Describe("JSON", [this]()
+	{
+		It("should write the valid JSON object", [this]()
+		{
+			M_DECLARE_LOG_CALL_SITE(Site);
+			FMyLogLine Line;
+			MyLogKV::FormatLine(Line, Site, /*bInJson*/true,
+				TEXT("Int"), 42, TEXT("Float"), 0.5F, TEXT("Flag"), false, TEXT("Quoted \"Key\""), TEXT("Line\nBreak\\"), TEXT("NaN"), NAN, TEXT("Vector"), FVector { 1.0F, 2.0F, 3.0F });
+			FString const Expected = FString::Printf(TEXT("{\"function\":\"%s\",\"line\":%d,"), ANSI_TO_TCHAR(Site.Function), Site.Line)
+				+ TEXT("\"Int\":42,\"Float\":0.5,\"Flag\":false,\"Quoted \\\"Key\\\"\":\"Line\\u000aBreak\\\\\",\"NaN\":null,\"Vector\":[1,2,3]}");
+			TestEqual(TEXT("Line"), FString(Line.GetData()), Expected);
+		});
+	});
+
+	Describe("Binary", [this]()
+	{
+		It("should build the format of the argument types", [this]()
+		{
+			FString const Format = decltype(MyLogKV::DeclareArgs(TEXT("Int"), 1, TEXT("Float"), 1.0F, TEXT("Name"), FName()))::GetBinaryFormat();
+			TestEqual(TEXT("Format"), Format, FString(TEXT("%s : %d, %s : %f, %s : \"%s\"")));
+		});
+
+		It("should decode to the same text as the text format", [this]()
+		{
+			static const FMyBinaryLogFormat Format { __FUNCTION__, __FILE__, __LINE__, MyLog, ELogVerbosity::Log,
+				decltype(MyLogKV::DeclareArgs(TEXT("Int"), 1, TEXT("Flag"), true, TEXT("Location"), FVector::ZeroVector))::GetBinaryFormat() };
+			FVector const Location { 1.0F, 2.5F, -3.0F };
+
+			TArray<uint8> Data;
+			FMemoryWriter Archive { Data };
+			{
+				FMyBinaryLogWriter Writer { &Archive, /*bInOwnsArchive*/false };
+				Writer.Write(Format, TEXT("Int"), 7, TEXT("Flag"), TMyLogKVValue<bool>::ToBinaryArg(false), TEXT("Location"), Location);
+			}
+			TArray<FString> Lines;
+			TestTrue(TEXT("Decode must succeed"), MyBinaryLog::Decode(Data, Lines));
+			if( ! TestEqual(TEXT("Number of lines"), Lines.Num(), 1) )
+			{
+				return;
+			}
+
+			FMyLogLine Line;
+			MyLogKV::FormatLine(Line, Format.Site, /*bInJson*/false, TEXT("Int"), 7, TEXT("Flag"), false, TEXT("Location"), Location);
+			TestTrue(TEXT("Decoded line"), Lines[0].EndsWith(Line.GetData()));
+		});
+
+		It("should decode the int64, the name and the object values to the same text as the text format", [this]()
+		{
+			UObject* const Object = GetTransientPackage();
+			const UObject* const NullObject = nullptr;
+			int64 const Big = 1LL << 40;
+			FName const Name { TEXT("KVName"), 2 };
+			static const FMyBinaryLogFormat Format { __FUNCTION__, __FILE__, __LINE__, MyLog, ELogVerbosity::Log,
+				decltype(MyLogKV::DeclareArgs(TEXT("Big"), Big, TEXT("Name"), Name, TEXT("Object"), Object, TEXT("Null"), NullObject))::GetBinaryFormat() };
+
+			TArray<uint8> Data;
+			FMemoryWriter Archive { Data };
+			{
+				FMyBinaryLogWriter Writer { &Archive, /*bInOwnsArchive*/false };
+				Writer.Write(Format, TEXT("Big"), TMyLogKVValue<int64>::ToBinaryArg(Big), TEXT("Name"), Name,
+					TEXT("Object"), TMyLogKVValue<UObject*>::ToBinaryArg(Object), TEXT("Null"), TMyLogKVValue<const UObject*>::ToBinaryArg(NullObject));
+			}
+			TArray<FString> Lines;
+			TestTrue(TEXT("Decode must succeed"), MyBinaryLog::Decode(Data, Lines));
+			if( ! TestEqual(TEXT("Number of lines"), Lines.Num(), 1) )
+			{
+				return;
+			}
+
+			FMyLogLine Line;
+			MyLogKV::FormatLine(Line, Format.Site, /*bInJson*/false, TEXT("Big"), Big, TEXT("Name"), Name, TEXT("Object"), Object, TEXT("Null"), NullObject);
+			TestTrue(TEXT("Decoded line"), Lines[0].EndsWith(Line.GetData()));
+		});
+	});
+}
+
+DEFINE_SPEC(MyLogKVBenchmark, "MyUtil.Core.Log.MyLogKVBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogKVBenchmark::Define()
+{
+	It("should report ns per line for the printf and the key-value formatting", [this]()
+	{
+		constexpr int32 NUM_LINES = 100000;
+		M_DECLARE_LOG_CALL_SITE(Site);
+
+		double const PrintfStartSeconds = FPlatformTime::Seconds();
+		for(int32 LineIndex = 0; LineIndex < NUM_LINES; ++LineIndex)
+		{
+			FMyLogLine Line;
+			MyLog::FormatLine(Line, Site, TEXT("%s : %d, %s : %f, %s : %s"), TEXT("Index"), LineIndex, TEXT("Time"), 0.5F, TEXT("bFlag"), TEXT("YES"));
+		}
+		double const PrintfSeconds = FPlatformTime::Seconds() - PrintfStartSeconds;
+
+		double const KVStartSeconds = FPlatformTime::Seconds();
+		for(int32 LineIndex = 0; LineIndex < NUM_LINES; ++LineIndex)
+		{
+			FMyLogLine Line;
+			MyLogKV::FormatLine(Line, Site, /*bInJson*/false, TEXT("Index"), LineIndex, TEXT("Time"), 0.5F, TEXT("bFlag"), true);
+		}
+		double const KVSeconds = FPlatformTime::Seconds() - KVStartSeconds;
+
+		AddInfo(FString::Printf(TEXT("Printf: %.1f ns per line"), PrintfSeconds * 1.0e9 / NUM_LINES));
+		AddInfo(FString::Printf(TEXT("Key-value: %.1f ns per line"), KVSeconds * 1.0e9 / NUM_LINES));
+	});
+}
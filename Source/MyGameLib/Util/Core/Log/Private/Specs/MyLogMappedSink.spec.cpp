@@ -0,0 +1,344 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyLogMappedSink.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include <atomic>
+
+namespace
+{
+	FString GetSpecFilename(const TCHAR* const InName)
+	{
+		return FPaths::Combine(FPaths::AutomationTransientDir(), InName);
+	}
+
+	EMyLogMappedWriteResult WriteLine(FMyLogMappedSegment& InSegment, const FString& InLine)
+	{
+		FTCHARToUTF8 const Text { *InLine };
+		return InSegment.TryWrite(Text.Get(), Text.Length());
+	}
+
+	/** Names of the segment files of the sink (.log and .log.gz)*/
+	TArray<FString> FindSegmentFiles(const FString& InBaseFilename)
+	{
+		TArray<FString> Filenames;
+		IFileManager::Get().FindFiles(Filenames, *(InBaseFilename + TEXT("-*")), /*Files*/true, /*Directories*/false);
+		for(FString& Filename : Filenames)
+		{
+			Filename = FPaths::Combine(FPaths::GetPath(InBaseFilename), Filename);
+		}
+		return Filenames;
+	}
+
+	void DeleteSegmentFiles(const FString& InBaseFilename)
+	{
+		for(const FString& Filename : FindSegmentFiles(InBaseFilename))
+		{
+			IFileManager::Get().Delete(*Filename);
+		}
+	}
+
+	/**
+	* Loads the file (decompressing .gz: the uncompressed size is the last 4 bytes of the gzip file).
+	* @returns: false if failed to load.
+	*/
+	bool LoadSegmentFile(const FString& InFilename, TArray<uint8>& OutData)
+	{
+		if( ! FFileHelper::LoadFileToArray(OutData, *InFilename) )
+		{
+			return false;
+		}
+		if( ! InFilename.EndsWith(TEXT(".gz")) )
+		{
+			return true;
+		}
+		if(OutData.Num() < 4)
+		{
+			return false;
+		}
+		uint32 UncompressedSize = 0;
+		FMemory::Memcpy(&UncompressedSize, OutData.GetData() + OutData.Num() - 4, 4);
+		TArray<uint8> Uncompressed;
+		Uncompressed.SetNumUninitialized(static_cast<int32>(UncompressedSize));
+		if( ! FCompression::UncompressMemory(NAME_Gzip, Uncompressed.GetData(), Uncompressed.Num(), OutData.GetData(), OutData.Num()) )
+		{
+			return false;
+		}
+		OutData = MoveTemp(Uncompressed);
+		return true;
+	}
+
+	/** Is the file closed by the sink: truncated to the written size, so NO zero tail of the preallocated file is left*/
+	bool IsTruncated(const TArray<uint8>& InData)
+	{
+		return InData.Num() > 0 && ! InData.Contains(0);
+	}
+
+	/**
+	* Lines of the segments of the sink containing the marker (the text from the marker on, so without the time and the frame).
+	*/
+	struct FMyLogMappedSinkSpecSegments
+	{
+		TArray<FString> Lines;
+		int32 NumLogFiles = 0;
+		int32 NumCompressedFiles = 0;
+		bool bAllLoaded = true;
+		bool bAllTruncated = true;
+
+		FMyLogMappedSinkSpecSegments(const FString& InBaseFilename, const TCHAR* const InMarker)
+		{
+			for(const FString& Filename : FindSegmentFiles(InBaseFilename))
+			{
+				bool const bCompressed = Filename.EndsWith(TEXT(".gz"));
+				(bCompressed ? NumCompressedFiles : NumLogFiles)++;
+				TArray<uint8> Data;
+				if( ! LoadSegmentFile(Filename, Data) )
+				{
+					bAllLoaded = false;
+					continue;
+				}
+				bAllTruncated = bAllTruncated && IsTruncated(Data);
+				FUTF8ToTCHAR const Text { reinterpret_cast<const ANSICHAR*>(Data.GetData()), Data.Num() };
+				TArray<FString> FileLines;
+				FString(Text.Length(), Text.Get()).ParseIntoArrayLines(FileLines);
+				for(const FString& Line : FileLines)
+				{
+					int32 const MarkerIndex = Line.Find(InMarker, ESearchCase::CaseSensitive);
+					if(MarkerIndex != INDEX_NONE)
+					{
+						Lines.Add(Line.Mid(MarkerIndex));
+					}
+				}
+			}
+		}
+	};
+
+	/**
+	* Writes the numbered lines of the marker by the parallel writers.
+	* @returns: number of the lines refused by the sink.
+	*/
+	int32 WriteParallel(FMyLogMappedSink& InSink, const TCHAR* const InMarker, int32 const InNumWriters, int32 const InNumLinesPerWriter)
+	{
+		std::atomic<int32> NumRefused { 0 };
+		ParallelFor(InNumWriters, [&InSink, &NumRefused, InMarker, InNumLinesPerWriter](int32 const InWriterIndex)
+		{
+			for(int32 LineIndex = 0; LineIndex < InNumLinesPerWriter; ++LineIndex)
+			{
+				if( ! InSink.Write(LogTemp, ELogVerbosity::Log, *FString::Printf(TEXT("%s Writer %d Line %d"), InMarker, InWriterIndex, LineIndex)) )
+				{
+					NumRefused.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		});
+		return NumRefused.load();
+	}
+
+	/** Segment of the sink small enough to rotate every few lines*/
+	constexpr uint64 SPEC_SEGMENT_SIZE = 1024;
+}
+
+DEFINE_SPEC(MyLogMappedSinkSpec, "MyUtil.Core.Log.MyLogMappedSinkSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogMappedSinkSpec::Define()
+{
+	It("should write the lines and truncate the file to the written size", [this]()
+	{
+		FString const Filename = GetSpecFilename(TEXT("MyLogMappedSinkSpec_Lines.log"));
+		{
+			FMyLogMappedSegment Segment { Filename, 1024 };
+			if( ! TestTrue(TEXT("Mapped"), Segment.IsValid()) )
+			{
+				return;
+			}
+			TestTrue(TEXT("First"), WriteLine(Segment, TEXT("First")) == EMyLogMappedWriteResult::Written);
+			TestTrue(TEXT("Second"), WriteLine(Segment, TEXT("Second")) == EMyLogMappedWriteResult::Written);
+			TestTrue(TEXT("Sealed by the call"), Segment.Seal());
+			TestTrue(TEXT("Complete"), Segment.IsComplete());
+			Segment.Close();
+		}
+		FString Text;
+		TestTrue(TEXT("Load"), FFileHelper::LoadFileToString(Text, *Filename));
+		TestEqual(TEXT("Text"), Text, FString(TEXT("First\nSecond\n")));
+		IFileManager::Get().Delete(*Filename);
+	});
+
+	It("should be sealed by the first line that does not fit", [this]()
+	{
+		FString const Filename = GetSpecFilename(TEXT("MyLogMappedSinkSpec_Seal.log"));
+		{
+			FMyLogMappedSegment Segment { Filename, 16 };
+			if( ! TestTrue(TEXT("Mapped"), Segment.IsValid()) )
+			{
+				return;
+			}
+			TestTrue(TEXT("Fits"), WriteLine(Segment, TEXT("0123456789")) == EMyLogMappedWriteResult::Written);
+			TestTrue(TEXT("Seals"), WriteLine(Segment, TEXT("abcdef")) == EMyLogMappedWriteResult::Sealed);
+			TestTrue(TEXT("Full"), WriteLine(Segment, TEXT("x")) == EMyLogMappedWriteResult::Full);
+			TestFalse(TEXT("Sealed again"), Segment.Seal());
+			TestTrue(TEXT("Complete"), Segment.IsComplete());
+			TestEqual(TEXT("Written size"), Segment.GetWrittenSize(), static_cast<uint64>(11));
+			Segment.Close();
+		}
+		IFileManager::Get().Delete(*Filename);
+	});
+
+	It("should let the writer format the line directly into the claimed space", [this]()
+	{
+		FString const Filename = GetSpecFilename(TEXT("MyLogMappedSinkSpec_WriteWith.log"));
+		{
+			FMyLogMappedSegment Segment { Filename, 1024 };
+			if( ! TestTrue(TEXT("Mapped"), Segment.IsValid()) )
+			{
+				return;
+			}
+			const ANSICHAR* const Header = "MyLog: ";
+			FString const Line = TEXT("Direct");
+			int32 const ConvertedLen = FTCHARToUTF8_Convert::ConvertedLength(*Line, Line.Len());
+			EMyLogMappedWriteResult const Result = Segment.TryWriteWith(7 + ConvertedLen, [Header, &Line, ConvertedLen](ANSICHAR* const OutLine)
+			{
+				FMemory::Memcpy(OutLine, Header, 7);
+				ANSICHAR* ConvertedText = OutLine + 7;
+				FTCHARToUTF8_Convert::Convert(ConvertedText, ConvertedLen, *Line, Line.Len());
+			});
+			TestTrue(TEXT("Written"), Result == EMyLogMappedWriteResult::Written);
+			Segment.Seal();
+			Segment.Close();
+		}
+		FString Text;
+		TestTrue(TEXT("Load"), FFileHelper::LoadFileToString(Text, *Filename));
+		TestEqual(TEXT("Text"), Text, FString(TEXT("MyLog: Direct\n")));
+		IFileManager::Get().Delete(*Filename);
+	});
+
+	It("should keep all the lines of the parallel writers", [this]()
+	{
+		constexpr int32 NUM_WRITERS = 8;
+		constexpr int32 NUM_LINES_PER_WRITER = 1000;
+		FString const Filename = GetSpecFilename(TEXT("MyLogMappedSinkSpec_Parallel.log"));
+		{
+			FMyLogMappedSegment Segment { Filename, 1024 * 1024 };
+			if( ! TestTrue(TEXT("Mapped"), Segment.IsValid()) )
+			{
+				return;
+			}
+			ParallelFor(NUM_WRITERS, [&Segment](int32 const InWriterIndex)
+			{
+				for(int32 LineIndex = 0; LineIndex < NUM_LINES_PER_WRITER; ++LineIndex)
+				{
+					WriteLine(Segment, FString::Printf(TEXT("Writer %d Line %d"), InWriterIndex, LineIndex));
+				}
+			});
+			Segment.Seal();
+			TestTrue(TEXT("Complete"), Segment.IsComplete());
+			Segment.Close();
+		}
+		TArray<FString> Lines;
+		TestTrue(TEXT("Load"), FFileHelper::LoadFileToStringArray(Lines, *Filename));
+		TSet<FString> const UniqueLines { Lines };
+		TestEqual(TEXT("Number of lines"), Lines.Num(), NUM_WRITERS * NUM_LINES_PER_WRITER);
+		TestEqual(TEXT("Number of unique lines"), UniqueLines.Num(), NUM_WRITERS * NUM_LINES_PER_WRITER);
+		IFileManager::Get().Delete(*Filename);
+	});
+
+	Describe("FMyLogMappedSink", [this]()
+	{
+		It("should rotate at the segment size and keep every line of the parallel writers exactly once", [this]()
+		{
+			constexpr int32 NUM_WRITERS = 8;
+			constexpr int32 NUM_LINES_PER_WRITER = 200;
+			const TCHAR* const Marker = TEXT("MyLogMappedSinkSpec_Rotation");
+			FString const BaseFilename = GetSpecFilename(Marker);
+			DeleteSegmentFiles(BaseFilename);
+			{
+				FMyLogMappedSink Sink { BaseFilename, SPEC_SEGMENT_SIZE, /*bInCompress*/false };
+				if( ! TestTrue(TEXT("Running"), Sink.IsRunning()) )
+				{
+					return;
+				}
+				TestEqual(TEXT("Refused lines"), WriteParallel(Sink, Marker, NUM_WRITERS, NUM_LINES_PER_WRITER), 0);
+				TestTrue(TEXT("Rotated"), Sink.GetNumRotations() > 0);
+
+				// The sealed segments are collected and closed by the background thread while the sink is running
+				FString const FirstFilename = BaseFilename + TEXT("-000.log");
+				double const DeadlineSeconds = FPlatformTime::Seconds() + 5.0;
+				TArray<uint8> FirstData;
+				while(FFileHelper::LoadFileToArray(FirstData, *FirstFilename) && ! IsTruncated(FirstData) && FPlatformTime::Seconds() < DeadlineSeconds)
+				{
+					FPlatformProcess::Sleep(0.01F);
+				}
+				TestTrue(TEXT("First segment is truncated while the sink is running"), IsTruncated(FirstData));
+			}
+
+			FMyLogMappedSinkSpecSegments const Segments { BaseFilename, Marker };
+			TestTrue(TEXT("All loaded"), Segments.bAllLoaded);
+			TestTrue(TEXT("All segments are truncated"), Segments.bAllTruncated);
+			TestTrue(TEXT("Several segment files"), Segments.NumLogFiles > 1);
+			TestEqual(TEXT("Compressed files"), Segments.NumCompressedFiles, 0);
+			TestEqual(TEXT("Number of lines"), Segments.Lines.Num(), NUM_WRITERS * NUM_LINES_PER_WRITER);
+			TestEqual(TEXT("Number of unique lines"), TSet<FString>{ Segments.Lines }.Num(), NUM_WRITERS * NUM_LINES_PER_WRITER);
+			DeleteSegmentFiles(BaseFilename);
+		});
+
+		It("should compress the closed segments to .log.gz", [this]()
+		{
+			constexpr int32 NUM_WRITERS = 4;
+			constexpr int32 NUM_LINES_PER_WRITER = 50;
+			const TCHAR* const Marker = TEXT("MyLogMappedSinkSpec_Compress");
+			FString const BaseFilename = GetSpecFilename(Marker);
+			DeleteSegmentFiles(BaseFilename);
+			{
+				FMyLogMappedSink Sink { BaseFilename, SPEC_SEGMENT_SIZE, /*bInCompress*/true };
+				if( ! TestTrue(TEXT("Running"), Sink.IsRunning()) )
+				{
+					return;
+				}
+				TestEqual(TEXT("Refused lines"), WriteParallel(Sink, Marker, NUM_WRITERS, NUM_LINES_PER_WRITER), 0);
+			}
+
+			FMyLogMappedSinkSpecSegments const Segments { BaseFilename, Marker };
+			TestTrue(TEXT("All loaded"), Segments.bAllLoaded);
+			TestEqual(TEXT("Uncompressed files"), Segments.NumLogFiles, 0);
+			TestTrue(TEXT("Several compressed files"), Segments.NumCompressedFiles > 1);
+			TestEqual(TEXT("Number of lines"), Segments.Lines.Num(), NUM_WRITERS * NUM_LINES_PER_WRITER);
+			TestEqual(TEXT("Number of unique lines"), TSet<FString>{ Segments.Lines }.Num(), NUM_WRITERS * NUM_LINES_PER_WRITER);
+			DeleteSegmentFiles(BaseFilename);
+		});
+	});
+}
+
+DEFINE_SPEC(MyLogMappedSinkBenchmark, "MyUtil.Core.Log.MyLogMappedSinkBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogMappedSinkBenchmark::Define()
+{
+	It("should report ns per line appended by the parallel writers", [this]()
+	{
+		constexpr int32 NUM_WRITERS = 8;
+		constexpr int32 NUM_LINES_PER_WRITER = 100000;
+		FString const Filename = GetSpecFilename(TEXT("MyLogMappedSinkBenchmark.log"));
+		{
+			FMyLogMappedSegment Segment { Filename, 256 * 1024 * 1024 };
+			if( ! TestTrue(TEXT("Mapped"), Segment.IsValid()) )
+			{
+				return;
+			}
+			FTCHARToUTF8 const Text { TEXT("[2020.01.01-00.00.00:000][  0]MyLog: Verbose: UTUMovementComponent::ComputeSlideVector: Delta : X=1.0 Y=2.0 Z=3.0") };
+			double const StartSeconds = FPlatformTime::Seconds();
+			ParallelFor(NUM_WRITERS, [&Segment, &Text](int32)
+			{
+				for(int32 LineIndex = 0; LineIndex < NUM_LINES_PER_WRITER; ++LineIndex)
+				{
+					Segment.TryWrite(Text.Get(), Text.Length());
+				}
+			});
+			double const Seconds = FPlatformTime::Seconds() - StartSeconds;
+			Segment.Seal();
+			Segment.Close();
+			AddInfo(FString::Printf(TEXT("Mapped segment: %.1f ns per line (%d writers)"), Seconds * 1.0e9 / (NUM_WRITERS * NUM_LINES_PER_WRITER), NUM_WRITERS));
+		}
+		IFileManager::Get().Delete(*Filename);
+	});
+}
@@ -0,0 +1,107 @@
+#include "AutomationTest.h"
+#include "Util/Core/MyDebugMacros.h"
+#include "Util/Core/Log/MyLogProfiler.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+
+namespace
+{
+	void SetProfilingEnabled(bool const bInEnabled)
+	{
+		IConsoleVariable* const CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("MyLog.Profile"));
+		check(CVar);
+		CVar->Set(bInEnabled ? 1 : 0);
+	}
+
+	const FMyLogScopeSummary* FindSummary(const TArray<FMyLogScopeSummary>& InSummaries, int32 const InLine)
+	{
+		return InSummaries.FindByPredicate([InLine](const FMyLogScopeSummary& InSummary)
+		{
+			return InSummary.Site->Line == InLine && FCStringAnsi::Strcmp(InSummary.Site->File, __FILE__) == 0;
+		});
+	}
+}
+
+DEFINE_SPEC(MyLogProfilerSpec, "MyUtil.Core.Log.MyLogProfilerSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogProfilerSpec::Define()
+{
+	Describe("FMyLogLatencyHistogram", [this]()
+	{
+		It("should put each value into the bucket containing it", [this]()
+		{
+			for(uint64 const Cycles : { 0ULL, 1ULL, 3ULL, 4ULL, 7ULL, 8ULL, 9ULL, 1000ULL, 123456789ULL, ~0ULL })
+			{
+				int32 const BucketIndex = FMyLogLatencyHistogram::GetBucketIndex(Cycles);
+				TestTrue(TEXT("Bucket index must be in range"), BucketIndex >= 0 && BucketIndex < FMyLogLatencyHistogram::NUM_BUCKETS);
+				TestTrue(TEXT("Upper bound must NOT be less than the value"), FMyLogLatencyHistogram::GetBucketUpperBound(BucketIndex) >= Cycles);
+				TestTrue(TEXT("Previous bucket must end before the value"), BucketIndex == 0 || FMyLogLatencyHistogram::GetBucketUpperBound(BucketIndex - 1) < Cycles);
+			}
+		});
+
+		It("should return the percentiles by rank", [this]()
+		{
+			FMyLogLatencyHistogram Histogram;
+			for(int32 SampleIndex = 0; SampleIndex < 99; ++SampleIndex)
+			{
+				Histogram.Add(2);
+			}
+			Histogram.Add(1000);
+			TestEqual(TEXT("P50"), static_cast<int64>(Histogram.GetPercentileCycles(0.5)), int64(2));
+			TestEqual(TEXT("P99"), static_cast<int64>(Histogram.GetPercentileCycles(0.99)), int64(2));
+			TestTrue(TEXT("P100 must contain the greatest value"), Histogram.GetPercentileCycles(1.0) >= 1000);
+		});
+	});
+
+	Describe("Scoped helpers", [this]()
+	{
+		BeforeEach([this]()
+		{
+			FMyLogProfiler::Reset();
+			SetProfilingEnabled(true);
+		});
+
+		It("should time the scopes that are NOT logged and split the self time", [this]()
+		{
+			int32 const OuterLine = __LINE__ + 4;
+			int32 const InnerLine = __LINE__ + 6;
+			for(int32 CallIndex = 0; CallIndex < 3; ++CallIndex)
+			{
+				M_LOGFUNC_IF(false);
+				FPlatformProcess::Sleep(0.001F);
+				{
+					M_LOGFUNC_IF(false);
+					FPlatformProcess::Sleep(0.002F);
+				}
+			}
+
+			TArray<FMyLogScopeSummary> const Summaries = FMyLogProfiler::GetScopeSummaries();
+			const FMyLogScopeSummary* const Outer = FindSummary(Summaries, OuterLine);
+			const FMyLogScopeSummary* const Inner = FindSummary(Summaries, InnerLine);
+			if( ! TestNotNull(TEXT("Outer scope must be profiled"), Outer) || ! TestNotNull(TEXT("Inner scope must be profiled"), Inner) )
+			{
+				return;
+			}
+			TestEqual(TEXT("Outer calls"), static_cast<int64>(Outer->NumCalls), int64(3));
+			TestEqual(TEXT("Inner calls"), static_cast<int64>(Inner->NumCalls), int64(3));
+			TestTrue(TEXT("Outer total time must include the inner time"), Outer->TotalMs >= Inner->TotalMs);
+			TestTrue(TEXT("Outer self time must exclude the inner time"), FMath::IsNearlyEqual(Outer->SelfMs, Outer->TotalMs - Inner->TotalMs, 0.01));
+			TestTrue(TEXT("Inner self time must be its total time"), FMath::IsNearlyEqual(Inner->SelfMs, Inner->TotalMs, 0.001));
+			TestTrue(TEXT("P50 must NOT exceed P99"), Inner->P50Ms <= Inner->P99Ms);
+		});
+
+		It("should NOT time the scopes when disabled", [this]()
+		{
+			SetProfilingEnabled(false);
+			int32 const ScopeLine = __LINE__ + 1;
+			M_LOGFUNC_IF(false);
+			TestNull(TEXT("Scope must NOT be profiled"), FindSummary(FMyLogProfiler::GetScopeSummaries(), ScopeLine));
+		});
+
+		AfterEach([this]()
+		{
+			SetProfilingEnabled(false);
+			FMyLogProfiler::Reset();
+		});
+	});
+}
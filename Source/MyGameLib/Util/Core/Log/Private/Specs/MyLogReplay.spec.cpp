@@ -0,0 +1,154 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyLogReplay.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	const TCHAR* const SPEC_LOG =
+		TEXT("Log file open, 01/01/20 00:00:00\r\n")
+		TEXT("[2020.01.01-00.00.00:000][  0]LogInit: Display: Started\r\n")
+		TEXT("[2020.01.01-00.00.01:500][  1]MyLog: ATUActor::BeginPlay: name=\"Actor_1\" class=\"TUActor\" (line: 12 : TUActor.cpp )\r\n")
+		TEXT("[2020.01.01-00.00.02:000][  2]MyLog: Verbose: UTUMovementComponent::TickComponent: Owner: name=\"Actor_1\" class=\"TUActor\" Other: name=\"Actor_2\" class=\"TUActor\" (line: 40 : TUMovementComponent.cpp )\r\n")
+		TEXT("  Continuation: name=\"Actor_3\" class=\"TUActor\"\r\n")
+		TEXT("[2020.01.01-00.00.03:000][  3]MyLog: Warning: ATUActor::BeginPlay: name=\"Actor_2\" class=\"TUActor\" (line: 12 : TUActor.cpp )\r\n")
+		TEXT("[2020.01.01-00.00.04:000][  4]MyLog: UTUMovementComponent::TickComponent: Owner: name=\"Actor_1\" class=\"TUActor\" (line: 40 : TUMovementComponent.cpp )\r\n");
+
+	TArray<int32> QueryObject(const FMyLogReplayIndex& InIndex, const TCHAR* const InObject, double const InFromSeconds, double const InToSeconds)
+	{
+		FMyLogReplayQuery Query;
+		Query.Object = InObject;
+		Query.FromSeconds = InFromSeconds;
+		Query.ToSeconds = InToSeconds;
+		return InIndex.Query(Query);
+	}
+}
+
+DEFINE_SPEC(MyLogReplaySpec, "MyUtil.Core.Log.MyLogReplaySpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogReplaySpec::Define()
+{
+	It("should index the records with the sites, the objects and the times", [this]()
+	{
+		FMyLogReplayIndex Index;
+		Index.OpenText(SPEC_LOG);
+		TestEqual(TEXT("Number of the records"), Index.Num(), 6);
+		TestEqual(TEXT("Number of the sites"), Index.NumSites(), 2);
+		TestEqual(TEXT("Number of the objects"), Index.NumObjects(), 3);
+		TestEqual(TEXT("Duration"), Index.GetDurationSeconds(), 4.0);
+		TestEqual(TEXT("Start"), Index.GetStartDateTime(), FDateTime(2020, 1, 1));
+		TestEqual(TEXT("Site"), Index.GetRecordSite(3), FString(TEXT("UTUMovementComponent::TickComponent:40")));
+		TestTrue(TEXT("Verbosity"), Index.GetRecord(3).Verbosity == ELogVerbosity::Verbose);
+		TestTrue(TEXT("Continuation line is the part of the record"), Index.GetRecordText(3).EndsWith(TEXT("Continuation: name=\"Actor_3\" class=\"TUActor\"")));
+	});
+
+	It("should find the records of the object between the times", [this]()
+	{
+		FMyLogReplayIndex Index;
+		Index.OpenText(SPEC_LOG);
+		TestEqual(TEXT("Actor_1 between 1 and 2 seconds"), QueryObject(Index, TEXT("Actor_1"), 1.0, 2.0), TArray<int32>{ 2, 3 });
+		TestEqual(TEXT("Actor_1 at all times"), QueryObject(Index, TEXT("Actor_1"), -MAX_dbl, MAX_dbl), TArray<int32>{ 2, 3, 5 });
+		TestEqual(TEXT("Actor_3 of the continuation line"), QueryObject(Index, TEXT("Actor_3"), -MAX_dbl, MAX_dbl), TArray<int32>{ 3 });
+		TestEqual(TEXT("Unknown object"), QueryObject(Index, TEXT("Actor_4"), -MAX_dbl, MAX_dbl).Num(), 0);
+	});
+
+	It("should filter the records by the site and the verbosity", [this]()
+	{
+		FMyLogReplayIndex Index;
+		Index.OpenText(SPEC_LOG);
+		FMyLogReplayQuery Query;
+		Query.Site = TEXT("*TickComponent*");
+		TestEqual(TEXT("Site"), Index.Query(Query), TArray<int32>{ 3, 5 });
+		Query.Object = TEXT("Actor_2");
+		TestEqual(TEXT("Site and object"), Index.Query(Query), TArray<int32>{ 3 });
+		FMyLogReplayQuery WarningQuery;
+		WarningQuery.MaxVerbosity = ELogVerbosity::Warning;
+		TestEqual(TEXT("Warnings"), Index.Query(WarningQuery), TArray<int32>{ 4 });
+	});
+
+	It("should index the file", [this]()
+	{
+		FString const Filename = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("MyLogReplaySpec.log"));
+		TestTrue(TEXT("Save"), FFileHelper::SaveStringToFile(SPEC_LOG, *Filename, FFileHelper::EEncodingOptions::ForceUTF8));
+		{
+			FMyLogReplayIndex Index;
+			TestTrue(TEXT("Open"), Index.Open(Filename));
+			TestEqual(TEXT("Number of the records"), Index.Num(), 6);
+			TestEqual(TEXT("First record"), Index.GetRecordText(0), FString(TEXT("Log file open, 01/01/20 00:00:00")));
+		}
+		IFileManager::Get().Delete(*Filename);
+	});
+
+	It("should index the same records whatever the chunks are", [this]()
+	{
+		FMyLogReplayIndex SingleChunkIndex;
+		SingleChunkIndex.OpenText(SPEC_LOG);
+		// Small chunks start at every few lines, so the continuation line starts the chunk with some of the sizes
+		for(uint64 MinChunkSize = 1; MinChunkSize <= 256; MinChunkSize *= 2)
+		{
+			FMyLogReplayIndex Index;
+			Index.OpenText(SPEC_LOG, MinChunkSize);
+			FString const What = FString::Printf(TEXT(" (chunk size %llu)"), MinChunkSize);
+			if( ! TestEqual(TEXT("Number of the records") + What, Index.Num(), SingleChunkIndex.Num()) )
+			{
+				continue;
+			}
+			for(int32 RecordIndex = 0; RecordIndex < Index.Num(); ++RecordIndex)
+			{
+				TestEqual(TEXT("Record text") + What, Index.GetRecordText(RecordIndex), SingleChunkIndex.GetRecordText(RecordIndex));
+			}
+			TestEqual(TEXT("Actor_3 of the continuation line") + What, QueryObject(Index, TEXT("Actor_3"), -MAX_dbl, MAX_dbl), TArray<int32>{ 3 });
+			TestEqual(TEXT("Actor_1") + What, QueryObject(Index, TEXT("Actor_1"), -MAX_dbl, MAX_dbl), TArray<int32>{ 2, 3, 5 });
+		}
+	});
+
+	It("should stop at the zero-filled tail of the segment", [this]()
+	{
+		FString const Filename = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("MyLogReplaySpec_Segment.log"));
+		FTCHARToUTF8 const Text { SPEC_LOG };
+		TArray<uint8> Segment;
+		Segment.Append(reinterpret_cast<const uint8*>(Text.Get()), Text.Length());
+		// The segment is preallocated and NOT truncated by the crash
+		Segment.AddZeroed(64 * 1024);
+		TestTrue(TEXT("Save"), FFileHelper::SaveArrayToFile(Segment, *Filename));
+		{
+			FMyLogReplayIndex Index;
+			TestTrue(TEXT("Open"), Index.Open(Filename));
+			TestEqual(TEXT("Number of the records"), Index.Num(), 6);
+			TestTrue(TEXT("Last record ends at the last line"), Index.Num() == 6 && Index.GetRecordText(5).EndsWith(TEXT("(line: 40 : TUMovementComponent.cpp )")));
+		}
+		IFileManager::Get().Delete(*Filename);
+	});
+}
+
+DEFINE_SPEC(MyLogReplayBenchmark, "MyUtil.Core.Log.MyLogReplayBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogReplayBenchmark::Define()
+{
+	It("should report the indexing and the query time", [this]()
+	{
+		constexpr int32 NUM_LINES = 1000000;
+		constexpr int32 NUM_OBJECTS = 1000;
+		FString Text;
+		Text.Reserve(NUM_LINES * 160);
+		for(int32 LineIndex = 0; LineIndex < NUM_LINES; ++LineIndex)
+		{
+			Text.Append(FString::Printf(TEXT("[%07.2f][%3d]MyLog: Verbose: UTUMovementComponent::TickComponent: Owner: name=\"Actor_%d\" class=\"TUActor\" (line: %d : TUMovementComponent.cpp )\n"), LineIndex * 0.001, LineIndex % 1000, LineIndex % NUM_OBJECTS, LineIndex % 16));
+		}
+
+		FMyLogReplayIndex Index;
+		double const IndexStartSeconds = FPlatformTime::Seconds();
+		Index.OpenText(Text);
+		double const IndexSeconds = FPlatformTime::Seconds() - IndexStartSeconds;
+
+		double const QueryStartSeconds = FPlatformTime::Seconds();
+		TArray<int32> const RecordIndices = QueryObject(Index, TEXT("Actor_7"), 100.0, 200.0);
+		double const QuerySeconds = FPlatformTime::Seconds() - QueryStartSeconds;
+
+		TestEqual(TEXT("Number of the records"), Index.Num(), NUM_LINES);
+		TestEqual(TEXT("Number of the records matched"), RecordIndices.Num(), 100);
+		AddInfo(FString::Printf(TEXT("Replay index: %.1f ns per line, query %.3f ms"), IndexSeconds * 1.0e9 / NUM_LINES, QuerySeconds * 1000.0));
+	});
+}
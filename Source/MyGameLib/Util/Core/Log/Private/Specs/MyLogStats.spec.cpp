@@ -0,0 +1,93 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyLogStats.h"
+#include "Util/Core/Log/MyLogCallSite.h"
+#include "Util/Core/MyDebugMacros.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_SPEC(MyLogStatsSpec, "MyUtil.Core.Log.MyLogStatsSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogStatsSpec::Define()
+{
+	Describe("EMyLogStatsSortKey", [this]()
+	{
+		It("should be parsed from its name in any case", [this]()
+		{
+			EMyLogStatsSortKey Key = EMyLogStatsSortKey::Calls;
+			TestTrue(TEXT("Parse must succeed"), LexTryParseString(Key, TEXT("bytes")));
+			TestTrue(TEXT("Bytes"), Key == EMyLogStatsSortKey::Bytes);
+			TestFalse(TEXT("Parse of the unknown key must fail"), LexTryParseString(Key, TEXT("Unknown")));
+			TestTrue(TEXT("Key must be unchanged"), Key == EMyLogStatsSortKey::Bytes);
+		});
+	});
+
+	Describe("FMyLogStats", [this]()
+	{
+		It("should sum the counters of the call site", [this]()
+		{
+			static FMyLogCallSite const Site { __FUNCTION__, __FILE__, __LINE__ };
+			FMyLogStats::AddCall(Site, MyLog, 100);
+			FMyLogStats::AddCall(Site, MyLog, 200);
+			FMyLogStats::AddBytes(Site, 10);
+			FMyLogStats::AddBytes(Site, 20);
+
+			TArray<FMyLogSiteStatsSummary> const Summaries = FMyLogStats::GetSiteSummaries(EMyLogStatsSortKey::Calls);
+			const FMyLogSiteStatsSummary* const Summary = Summaries.FindByPredicate([](const FMyLogSiteStatsSummary& InSummary) { return InSummary.Site == &Site; });
+			if( ! TestNotNull(TEXT("Summary of the site"), Summary) )
+			{
+				return;
+			}
+			TestTrue(TEXT("Calls"), Summary->NumCalls >= 2);
+			TestTrue(TEXT("Bytes"), Summary->NumBytes >= 30);
+			TestTrue(TEXT("Format time"), Summary->FormatMs > 0.0);
+			TestEqual(TEXT("Category"), Summary->Category, MyLog.GetCategoryName());
+			TestTrue(TEXT("Site in the CSV"), FMyLogStats::ToCsv().Contains(FString::Printf(TEXT("%d,MyLog,"), Site.Line)));
+		});
+
+		It("should sort the sites by the given key", [this]()
+		{
+			static FMyLogCallSite const ManyCallsSite { __FUNCTION__, __FILE__, __LINE__ };
+			static FMyLogCallSite const ManyBytesSite { __FUNCTION__, __FILE__, __LINE__ };
+			FMyLogStats::Reset();
+			for(int32 Index = 0; Index < 10; ++Index)
+			{
+				FMyLogStats::AddCall(ManyCallsSite, MyLog, 1);
+			}
+			FMyLogStats::AddCall(ManyBytesSite, MyLog, 1);
+			FMyLogStats::AddBytes(ManyBytesSite, 1000);
+
+			TArray<FMyLogSiteStatsSummary> const ByCalls = FMyLogStats::GetSiteSummaries(EMyLogStatsSortKey::Calls);
+			TArray<FMyLogSiteStatsSummary> const ByBytes = FMyLogStats::GetSiteSummaries(EMyLogStatsSortKey::Bytes);
+			if( ! TestTrue(TEXT("Both sites"), ByCalls.Num() >= 2 && ByBytes.Num() >= 2) )
+			{
+				return;
+			}
+			TestTrue(TEXT("Most calls first"), ByCalls[0].Site == &ManyCallsSite);
+			TestTrue(TEXT("Most bytes first"), ByBytes[0].Site == &ManyBytesSite);
+
+			TArray<FMyLogCategoryStatsSummary> const Categories = FMyLogStats::GetCategorySummaries(EMyLogStatsSortKey::Calls);
+			const FMyLogCategoryStatsSummary* const MyLogSummary = Categories.FindByPredicate([](const FMyLogCategoryStatsSummary& InSummary) { return InSummary.Category == MyLog.GetCategoryName(); });
+			if(TestNotNull(TEXT("MyLog category"), MyLogSummary))
+			{
+				TestTrue(TEXT("Calls of the category"), MyLogSummary->NumCalls >= 11);
+			}
+			FMyLogStats::Reset();
+		});
+
+		It("should count the lines of M_LOG when enabled", [this]()
+		{
+			IConsoleVariable* const CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("MyLog.Stats"));
+			if( ! TestNotNull(TEXT("MyLog.Stats"), CVar) )
+			{
+				return;
+			}
+			int32 const OldValue = CVar->GetInt();
+			CVar->Set(1);
+			static FMyLogCallSite const Site { __FUNCTION__, __FILE__, __LINE__ };
+			MyLog::Logf(Site, MyLog, ELogVerbosity::Log, TEXT("MyLogStatsSpec: %d"), 1);
+			CVar->Set(OldValue);
+
+			TestTrue(TEXT("Calls"), Site.GetCounters().NumCalls.load() == 1);
+			TestTrue(TEXT("Bytes"), Site.GetCounters().NumBytes.load() > 0);
+		});
+	});
+}
@@ -0,0 +1,132 @@
+#include "AutomationTest.h"
+#include "Util/Core/MyDebugMacros.h"
+#include "Util/Core/Log/MyLogThrottle.h"
+#include "HAL/PlatformTime.h"
+
+namespace
+{
+	/**
+	* Finds the registered throttle by the line of its call site in this file.
+	*/
+	const FMyLogThrottle* FindThrottle(int32 const InLine)
+	{
+		for(const FMyLogThrottle* Throttle = FMyLogThrottle::GetFirst(); Throttle; Throttle = Throttle->GetNext())
+		{
+			if(Throttle->GetLine() == InLine && FCStringAnsi::Strcmp(Throttle->GetFile(), __FILE__) == 0)
+			{
+				return Throttle;
+			}
+		}
+		return nullptr;
+	}
+}
+
+DEFINE_SPEC(MyLogThrottleSpec, "MyUtil.Core.Log.MyLogThrottleSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogThrottleSpec::Define()
+{
+	Describe("ShouldLog", [this]()
+	{
+		It("should pass only the first N hits", [this]()
+		{
+			// The throttle is static per call site, so it's reset for the next runs of the test
+			FMyLogThrottle& Throttle = M_LOG_THROTTLE(EMyLogThrottleMode::FirstN, 3);
+			Throttle.Reset();
+			int32 NumPassed = 0;
+			for(int32 HitIndex = 0; HitIndex < 10; ++HitIndex)
+			{
+				NumPassed += Throttle.ShouldLog() ? 1 : 0;
+			}
+			TestEqual(TEXT("Number of passed hits"), NumPassed, 3);
+		});
+
+		It("should pass every N-th hit starting from the first", [this]()
+		{
+			FMyLogThrottle& Throttle = M_LOG_THROTTLE(EMyLogThrottleMode::EveryNth, 4);
+			Throttle.Reset();
+			TArray<int32> PassedHits;
+			for(int32 HitIndex = 0; HitIndex < 10; ++HitIndex)
+			{
+				if(Throttle.ShouldLog())
+				{
+					PassedHits.Add(HitIndex);
+				}
+			}
+			TestTrue(TEXT("Hits 0, 4 and 8 must pass"), PassedHits == TArray<int32>{ 0, 4, 8 });
+		});
+
+		It("should limit the number of hits per second", [this]()
+		{
+			FMyLogThrottle& Throttle = M_LOG_THROTTLE(EMyLogThrottleMode::PerSecond, 5);
+			Throttle.Reset();
+			int32 NumPassed = 0;
+			for(int32 HitIndex = 0; HitIndex < 100; ++HitIndex)
+			{
+				NumPassed += Throttle.ShouldLog() ? 1 : 0;
+			}
+			// The window may be moved once if the loop crosses the second boundary
+			TestTrue(TEXT("At least the limit must pass"), NumPassed >= 5);
+			TestTrue(TEXT("At most the limit per window must pass"), NumPassed <= 10);
+		});
+	});
+
+	Describe("Registry", [this]()
+	{
+		// The throttles of the macros are static per call site, so the counts of the previous runs are cleared
+		BeforeEach([]()
+		{
+			FMyLogThrottle::ResetAll();
+		});
+
+		It("should count the emitted and the suppressed lines of the call site separately", [this]()
+		{
+			int32 const ThrottleLine = __LINE__ + 3;
+			for(int32 HitIndex = 0; HitIndex < 5; ++HitIndex)
+			{
+				M_LOG_FIRST_N(2, TEXT("Throttled line %d"), HitIndex);
+			}
+			const FMyLogThrottle* const Throttle = FindThrottle(ThrottleLine);
+			if( ! TestNotNull(TEXT("Throttle must be registered"), Throttle) )
+			{
+				return;
+			}
+			TestTrue(TEXT("Mode must be FirstN"), Throttle->GetMode() == EMyLogThrottleMode::FirstN);
+			TestEqual(TEXT("Number of emitted lines"), static_cast<int32>(Throttle->GetNumEmitted()), 2);
+			TestEqual(TEXT("Number of hits"), static_cast<int32>(Throttle->GetNumHits()), 5);
+			TestEqual(TEXT("Number of suppressed lines"), static_cast<int32>(Throttle->GetNumSuppressed()), 3);
+		});
+
+		It("should NOT count the hits of the category suppressed by the verbosity", [this]()
+		{
+			ELogVerbosity::Type const OldVerbosity = MyLog.GetVerbosity();
+			MyLog.SetVerbosity(ELogVerbosity::Error);
+			int32 const ThrottleLine = __LINE__ + 3;
+			for(int32 HitIndex = 0; HitIndex < 5; ++HitIndex)
+			{
+				M_LOG_FIRST_N(2, TEXT("Suppressed throttled line %d"), HitIndex);
+			}
+			MyLog.SetVerbosity(OldVerbosity);
+			const FMyLogThrottle* const Throttle = FindThrottle(ThrottleLine);
+			TestTrue(TEXT("No hits must be counted"), Throttle == nullptr || Throttle->GetNumHits() == 0);
+		});
+	});
+}
+
+DEFINE_SPEC(MyLogThrottleBenchmark, "MyUtil.Core.Log.MyLogThrottleBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogThrottleBenchmark::Define()
+{
+	It("should report ns per throttle check", [this]()
+	{
+		constexpr int32 NUM_HITS = 1000000;
+		int32 NumPassed = 0;
+		double const StartSeconds = FPlatformTime::Seconds();
+		for(int32 HitIndex = 0; HitIndex < NUM_HITS; ++HitIndex)
+		{
+			NumPassed += M_LOG_THROTTLE_PASSED(EMyLogThrottleMode::PerSecond, 10) ? 1 : 0;
+		}
+		double const ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+		TestTrue(TEXT("Some hits must pass"), NumPassed > 0);
+		AddInfo(FString::Printf(TEXT("PerSecond throttle: %.3f ns/hit"), ElapsedSeconds * 1.0e9 / NUM_HITS));
+	});
+}
@@ -0,0 +1,75 @@
+#include "AutomationTest.h"
+#include "Util/Core/MyDebugMacros.h"
+#include "Util/Core/Log/MyLogProfiler.h"
+#include "Util/Core/Log/MyLogTrace.h"
+#include "HAL/PlatformTLS.h"
+
+namespace
+{
+	int32 CountOccurrences(const FString& InText, const TCHAR* const InSubstring)
+	{
+		int32 NumOccurrences = 0;
+		int32 SearchFrom = 0;
+		int32 FoundIndex = INDEX_NONE;
+		while((FoundIndex = InText.Find(InSubstring, ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchFrom)) != INDEX_NONE)
+		{
+			++NumOccurrences;
+			SearchFrom = FoundIndex + 1;
+		}
+		return NumOccurrences;
+	}
+}
+
+DEFINE_SPEC(MyLogTraceSpec, "MyUtil.Core.Log.MyLogTraceSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogTraceSpec::Define()
+{
+	Describe("Capture", [this]()
+	{
+		It("should capture the nested scopes in order on the calling thread", [this]()
+		{
+			FMyLogProfiler::StartCapture();
+			{
+				M_LOGFUNC_IF(false);
+				{
+					M_LOGFUNC_IF(false);
+				}
+			}
+			FMyLogTraceCapture const Capture = FMyLogProfiler::StopCapture();
+			TestFalse(TEXT("Capture must be stopped"), FMyLogProfiler::IsCapturing());
+
+			uint32 const ThreadId = FPlatformTLS::GetCurrentThreadId();
+			TArray<FMyLogTraceEvent> ThreadEvents = Capture.Events.FilterByPredicate([ThreadId](const FMyLogTraceEvent& InEvent)
+			{
+				return InEvent.ThreadId == ThreadId && FCStringAnsi::Strcmp(InEvent.Site->File, __FILE__) == 0;
+			});
+			if( ! TestEqual(TEXT("Number of events of the scopes"), ThreadEvents.Num(), 4) )
+			{
+				return;
+			}
+			TestTrue(TEXT("Outer scope must be entered first"), ThreadEvents[0].bEnter && ThreadEvents[1].bEnter);
+			TestTrue(TEXT("Inner scope must be exited first"), ! ThreadEvents[2].bEnter && ThreadEvents[2].Site == ThreadEvents[1].Site);
+			TestTrue(TEXT("Outer scope must be exited last"), ! ThreadEvents[3].bEnter && ThreadEvents[3].Site == ThreadEvents[0].Site);
+		});
+	});
+
+	Describe("ToChromeTraceJson", [this]()
+	{
+		It("should write balanced begin/end events and skip the exits of the scopes entered before the capture", [this]()
+		{
+			M_DECLARE_LOG_CALL_SITE(Site);
+			FMyLogTraceCapture Capture;
+			Capture.StartCycles = 100;
+			Capture.Events.Add(FMyLogTraceEvent{ &Site, 110, 7, /*bEnter*/false });
+			Capture.Events.Add(FMyLogTraceEvent{ &Site, 120, 7, /*bEnter*/true });
+			Capture.Events.Add(FMyLogTraceEvent{ &Site, 130, 7, /*bEnter*/false });
+
+			FString const Json = MyLogTrace::ToChromeTraceJson(Capture);
+			TestTrue(TEXT("Must be the trace event object"), Json.StartsWith(TEXT("{\"traceEvents\":[")));
+			TestEqual(TEXT("Number of begin events"), CountOccurrences(Json, TEXT("\"ph\":\"B\"")), 1);
+			TestEqual(TEXT("Number of end events"), CountOccurrences(Json, TEXT("\"ph\":\"E\"")), 1);
+			TestEqual(TEXT("Number of thread names"), CountOccurrences(Json, TEXT("\"ph\":\"M\"")), 1);
+			TestTrue(TEXT("Event must be named by the function"), Json.Contains(FString::Printf(TEXT("\"name\":\"%s\""), ANSI_TO_TCHAR(Site.Function))));
+		});
+	});
+}
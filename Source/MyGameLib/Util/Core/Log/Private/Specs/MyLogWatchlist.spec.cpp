@@ -0,0 +1,88 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyLogWatchlist.h"
+#include "UObject/Package.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_SPEC(MyLogWatchlistSpec, "MyUtil.Core.Log.MyLogWatchlistSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogWatchlistSpec::Define()
+{
+	AfterEach([this]()
+	{
+		FMyLogWatchlist::Clear();
+	});
+
+	It("should log everything as before while inactive", [this]()
+	{
+		UObject* const Object = NewObject<UPackage>(GetTransientPackage(), NAME_None, RF_Transient);
+		TestFalse(TEXT("Active"), FMyLogWatchlist::IsActive());
+		TestTrue(TEXT("Should log"), FMyLogWatchlist::ShouldLog(Object));
+		TestFalse(TEXT("Should log if inactive is false"), FMyLogWatchlist::ShouldLog(Object, /*bInShouldLogIfInactive*/false));
+	});
+
+	It("should log only the watched objects and their subobjects", [this]()
+	{
+		UObject* const Watched = NewObject<UPackage>(GetTransientPackage(), NAME_None, RF_Transient);
+		UObject* const Subobject = NewObject<UPackage>(Watched, NAME_None, RF_Transient);
+		UObject* const Other = NewObject<UPackage>(GetTransientPackage(), NAME_None, RF_Transient);
+		TestTrue(TEXT("Add"), FMyLogWatchlist::Add(Watched));
+		TestTrue(TEXT("Active"), FMyLogWatchlist::IsActive());
+		TestTrue(TEXT("Watched"), FMyLogWatchlist::ShouldLog(Watched, /*bInShouldLogIfInactive*/false));
+		TestTrue(TEXT("Subobject of the watched"), FMyLogWatchlist::ShouldLog(Subobject));
+		TestFalse(TEXT("Other"), FMyLogWatchlist::ShouldLog(Other));
+		TestFalse(TEXT("nullptr"), FMyLogWatchlist::ShouldLog(nullptr));
+
+		FMyLogWatchlist::Remove(Watched);
+		TestFalse(TEXT("Active after the remove"), FMyLogWatchlist::IsActive());
+		TestFalse(TEXT("Watched after the remove"), FMyLogWatchlist::IsWatched(Watched));
+	});
+
+	It("should watch the existing and the later created objects by the name wildcard", [this]()
+	{
+		UObject* const Existing = NewObject<UPackage>(GetTransientPackage(), TEXT("MyLogWatchlistSpec_Existing"), RF_Transient);
+		TestEqual(TEXT("Number of the existing objects watched"), FMyLogWatchlist::AddByName(TEXT("MyLogWatchlistSpec_*")), 1);
+		UObject* const Created = NewObject<UPackage>(GetTransientPackage(), TEXT("MyLogWatchlistSpec_Created"), RF_Transient);
+		UObject* const Other = NewObject<UPackage>(GetTransientPackage(), TEXT("MyLogWatchlistSpecOther"), RF_Transient);
+		TestTrue(TEXT("Existing"), FMyLogWatchlist::IsWatched(Existing));
+		TestTrue(TEXT("Created"), FMyLogWatchlist::IsWatched(Created));
+		TestFalse(TEXT("Other"), FMyLogWatchlist::IsWatched(Other));
+
+		TestEqual(TEXT("Number of the objects unwatched"), FMyLogWatchlist::RemoveByName(TEXT("MyLogWatchlistSpec_*")), 2);
+		TestFalse(TEXT("Active after the remove"), FMyLogWatchlist::IsActive());
+	});
+
+	It("should refuse the objects above the limit", [this]()
+	{
+		for(int32 ObjectIndex = 0; ObjectIndex < FMyLogWatchlist::MAX_WATCHED; ++ObjectIndex)
+		{
+			FMyLogWatchlist::Add(NewObject<UPackage>(GetTransientPackage(), NAME_None, RF_Transient));
+		}
+		TestEqual(TEXT("Num"), FMyLogWatchlist::Num(), FMyLogWatchlist::MAX_WATCHED);
+		TestFalse(TEXT("Add above the limit"), FMyLogWatchlist::Add(NewObject<UPackage>(GetTransientPackage(), NAME_None, RF_Transient)));
+	});
+}
+
+DEFINE_SPEC(MyLogWatchlistBenchmark, "MyUtil.Core.Log.MyLogWatchlistBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void MyLogWatchlistBenchmark::Define()
+{
+	It("should report ns per check of the unwatched object", [this]()
+	{
+		constexpr int32 NUM_CHECKS = 1000000;
+		UObject* const Watched = NewObject<UPackage>(GetTransientPackage(), NAME_None, RF_Transient);
+		UObject* const Other = NewObject<UPackage>(GetTransientPackage(), NAME_None, RF_Transient);
+		FMyLogWatchlist::Add(Watched);
+
+		int32 NumShouldLog = 0;
+		double const StartSeconds = FPlatformTime::Seconds();
+		for(int32 CheckIndex = 0; CheckIndex < NUM_CHECKS; ++CheckIndex)
+		{
+			NumShouldLog += FMyLogWatchlist::ShouldLog(Other) ? 1 : 0;
+		}
+		double const Seconds = FPlatformTime::Seconds() - StartSeconds;
+		FMyLogWatchlist::Clear();
+
+		TestEqual(TEXT("Number of the checks passed"), NumShouldLog, 0);
+		AddInfo(FString::Printf(TEXT("Watchlist check: %.1f ns"), Seconds * 1.0e9 / NUM_CHECKS));
+	});
+}
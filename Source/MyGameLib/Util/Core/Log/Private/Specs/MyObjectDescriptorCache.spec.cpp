@@ -0,0 +1,91 @@
+#include "AutomationTest.h"
+#include "Util/Core/Log/MyObjectDescriptorCache.h"
+#include "Util/Core/LogUtilLib.h"
+#include "UObject/Package.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_SPEC(MyObjectDescriptorCacheSpec, "MyUtil.Core.Log.MyObjectDescriptorCacheSpec", EAutomationTestFlags::EngineFilter | EAutomationTestFlags::EditorContext)
+
+void MyObjectDescriptorCacheSpec::Define()
+{
+	It("should return the same string as the uncached path", [this]()
+	{
+		UObject* const Object = NewObject<UPackage>(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UPackage::StaticClass(), TEXT("MyObjectDescriptorCacheSpec_Object")), RF_Transient);
+		FString Expected;
+		ULogUtilLib::AppendNameAndClassUncached(Expected, Object);
+
+		FString First;
+		FMyObjectDescriptorCache::AppendNameAndClass(First, Object);
+		FString Second;
+		FMyObjectDescriptorCache::AppendNameAndClass(Second, Object);
+		TestEqual(TEXT("First (miss)"), First, Expected);
+		TestEqual(TEXT("Second (hit)"), Second, Expected);
+	});
+
+	It("should describe the renamed object again", [this]()
+	{
+		// Unique names: the objects of the previous runs may still exist
+		FName const OldName = MakeUniqueObjectName(GetTransientPackage(), UPackage::StaticClass(), TEXT("MyObjectDescriptorCacheSpec_OldName"));
+		UObject* const Object = NewObject<UPackage>(GetTransientPackage(), OldName, RF_Transient);
+		FString Before;
+		FMyObjectDescriptorCache::AppendNameAndClass(Before, Object);
+		FName const NewName = MakeUniqueObjectName(GetTransientPackage(), UPackage::StaticClass(), TEXT("MyObjectDescriptorCacheSpec_NewName"));
+		Object->Rename(*NewName.ToString(), nullptr, REN_DontCreateRedirectors | REN_NonTransactional | REN_ForceNoResetLoaders);
+		FString After;
+		FMyObjectDescriptorCache::AppendNameAndClass(After, Object);
+		TestTrue(TEXT("Old name"), Before.Contains(OldName.ToString()));
+		TestTrue(TEXT("New name"), After.Contains(NewName.ToString()));
+	});
+
+	It("should rebuild the flags text when the flags change", [this]()
+	{
+		UObject* const Object = NewObject<UPackage>(GetTransientPackage(), NAME_None, RF_Transient);
+		FString Before;
+		FMyObjectDescriptorCache::AppendObjectFlags(Before, Object);
+		Object->SetFlags(RF_Standalone);
+		FString After;
+		FMyObjectDescriptorCache::AppendObjectFlags(After, Object);
+		Object->ClearFlags(RF_Standalone);
+		TestFalse(TEXT("No Standalone before"), Before.Contains(TEXT("Standalone")));
+		TestTrue(TEXT("Standalone after"), After.Contains(TEXT("Standalone")));
+	});
+
+	It("should be empty after the reset", [this]()
+	{
+		FString Text;
+		FMyObjectDescriptorCache::AppendNameAndClass(Text, GetTransientPackage());
+		FMyObjectDescriptorCache::Reset();
+		TestEqual(TEXT("Number of descriptors"), FMyObjectDescriptorCache::Num(), 0);
+	});
+}
+
+DEFINE_SPEC(MyObjectDescriptorCacheBenchmark, "MyUtil.Core.Log.MyObjectDescriptorCacheBenchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags::EditorContext)
+
+void MyObjectDescriptorCacheBenchmark::Define()
+{
+	It("should report ns per name and class string with and without the cache", [this]()
+	{
+		constexpr int32 NUM_CALLS = 100000;
+		UObject* const Object = GetTransientPackage();
+		FString Text;
+		Text.Reserve(ULogUtilLib::APPEND_RESERVED_LEN);
+
+		double const UncachedStartSeconds = FPlatformTime::Seconds();
+		for(int32 CallIndex = 0; CallIndex < NUM_CALLS; ++CallIndex)
+		{
+			Text.Reset();
+			ULogUtilLib::AppendNameAndClassUncached(Text, Object);
+		}
+		double const UncachedSeconds = FPlatformTime::Seconds() - UncachedStartSeconds;
+
+		double const CachedStartSeconds = FPlatformTime::Seconds();
+		for(int32 CallIndex = 0; CallIndex < NUM_CALLS; ++CallIndex)
+		{
+			Text.Reset();
+			FMyObjectDescriptorCache::AppendNameAndClass(Text, Object);
+		}
+		double const CachedSeconds = FPlatformTime::Seconds() - CachedStartSeconds;
+
+		AddInfo(FString::Printf(TEXT("Uncached: %.1f ns, cached: %.1f ns"), UncachedSeconds * 1.0e9 / NUM_CALLS, CachedSeconds * 1.0e9 / NUM_CALLS));
+	});
+}
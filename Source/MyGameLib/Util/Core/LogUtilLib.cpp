@@ -1,4 +1,9 @@
 #include "LogUtilLib.h"
+#include "Log/MyLogKV.h"
+#include "Log/MyLogStats.h"
+#include "Log/MyFloatFormat.h"
+#include "Log/MyObjectDescriptorCache.h"
+#include "Log/MyBitmaskFormatter.h"
 #include "Math/Vector.h"
 #include "Math/Vector2D.h"
 #include "Math/Vector4.h"
@@ -8,60 +13,247 @@
 #include "Math/Transform.h"
 #include "Math/TranslationMatrix.h"
 #include "Math/RotationMatrix.h"
+#include "Async/ParallelFor.h"
 
 DEFINE_LOG_CATEGORY(MyLog);
 
+namespace
+{
+	/** Enough for any number formatted by the Append* functions (%lf of the greatest double included)*/
+	constexpr int32 NUMBER_BUFFER_LEN = 400;
+
+	/**
+	* Builds the string by the Append* function with the capacity reserved (usually the only allocation).
+	*/
+	template<class AppendFuncT>
+	FString BuildString(AppendFuncT InAppend)
+	{
+		FString Result;
+		Result.Reserve(ULogUtilLib::APPEND_RESERVED_LEN);
+		InAppend(Result);
+		return Result;
+	}
+
+	/** Formats the number on the stack and appends it*/
+	template<typename FmtType, typename ValueType>
+	void AppendNumber(FString& InOut, const FmtType& InFormat, ValueType const InValue)
+	{
+		TCHAR Buffer[NUMBER_BUFFER_LEN];
+		int32 const Written = FCString::Snprintf(Buffer, NUMBER_BUFFER_LEN, InFormat, InValue);
+		InOut.Append(Buffer, FMath::Clamp(Written, 0, NUMBER_BUFFER_LEN - 1));
+	}
+
+	/** "Key : "*/
+	void AppendKey(FString& InOut, const TCHAR* const InKey)
+	{
+		InOut.Append(InKey);
+		InOut.Append(TEXT(" : "));
+	}
+
+	const TCHAR* GetYesNoText(bool const bYes)
+	{
+		return TMyLogKVValue<bool>::GetYesNoText(bYes);
+	}
+
+	#define M_OBJECT_FLAG_NAME(Flag) FMyBitName{ static_cast<uint64>(RF_##Flag), TEXT(#Flag) }
+	const FMyBitName OBJECT_FLAG_NAMES[] =
+	{
+		M_OBJECT_FLAG_NAME(Public),
+		M_OBJECT_FLAG_NAME(Standalone),
+		M_OBJECT_FLAG_NAME(MarkAsNative),
+		M_OBJECT_FLAG_NAME(Transactional),
+		M_OBJECT_FLAG_NAME(ClassDefaultObject),
+		M_OBJECT_FLAG_NAME(ArchetypeObject),
+		M_OBJECT_FLAG_NAME(Transient),
+		M_OBJECT_FLAG_NAME(MarkAsRootSet),
+		M_OBJECT_FLAG_NAME(TagGarbageTemp),
+		M_OBJECT_FLAG_NAME(NeedInitialization),
+		M_OBJECT_FLAG_NAME(NeedLoad),
+		M_OBJECT_FLAG_NAME(KeepForCooker),
+		M_OBJECT_FLAG_NAME(NeedPostLoad),
+		M_OBJECT_FLAG_NAME(NeedPostLoadSubobjects),
+		M_OBJECT_FLAG_NAME(NewerVersionExists),
+		M_OBJECT_FLAG_NAME(BeginDestroyed),
+		M_OBJECT_FLAG_NAME(FinishDestroyed),
+		M_OBJECT_FLAG_NAME(BeingRegenerated),
+		M_OBJECT_FLAG_NAME(DefaultSubObject),
+		M_OBJECT_FLAG_NAME(WasLoaded),
+		M_OBJECT_FLAG_NAME(TextExportTransient),
+		M_OBJECT_FLAG_NAME(LoadCompleted),
+		M_OBJECT_FLAG_NAME(InheritableComponentTemplate),
+		M_OBJECT_FLAG_NAME(DuplicateTransient),
+		M_OBJECT_FLAG_NAME(StrongRefOnFrame),
+		M_OBJECT_FLAG_NAME(NonPIEDuplicateTransient),
+		M_OBJECT_FLAG_NAME(Dynamic),
+		M_OBJECT_FLAG_NAME(WillBeLoaded),
+	};
+	#undef M_OBJECT_FLAG_NAME
+
+	#define M_INTERNAL_OBJECT_FLAG_NAME(Flag) FMyBitName{ static_cast<uint64>(EInternalObjectFlags::Flag), TEXT(#Flag) }
+	const FMyBitName INTERNAL_OBJECT_FLAG_NAMES[] =
+	{
+		M_INTERNAL_OBJECT_FLAG_NAME(ReachableInCluster),
+		M_INTERNAL_OBJECT_FLAG_NAME(ClusterRoot),
+		M_INTERNAL_OBJECT_FLAG_NAME(Native),
+		M_INTERNAL_OBJECT_FLAG_NAME(Async),
+		M_INTERNAL_OBJECT_FLAG_NAME(AsyncLoading),
+		M_INTERNAL_OBJECT_FLAG_NAME(Unreachable),
+		M_INTERNAL_OBJECT_FLAG_NAME(PendingKill),
+		M_INTERNAL_OBJECT_FLAG_NAME(RootSet),
+	};
+	#undef M_INTERNAL_OBJECT_FLAG_NAME
+
+	const TMyBitmaskFormatter<EObjectFlags>& GetObjectFlagsFormatter()
+	{
+		static const TMyBitmaskFormatter<EObjectFlags> Formatter { MakeArrayView(OBJECT_FLAG_NAMES) };
+		return Formatter;
+	}
+
+	const TMyBitmaskFormatter<EInternalObjectFlags>& GetInternalObjectFlagsFormatter()
+	{
+		static const TMyBitmaskFormatter<EInternalObjectFlags> Formatter { MakeArrayView(INTERNAL_OBJECT_FLAG_NAMES) };
+		return Formatter;
+	}
+}
+
 ULogUtilLib::ULogUtilLib()
 {
 }
 
 FString ULogUtilLib::GetNameAndClass(const UObject* const InObject)
 {
-	checkf(InObject, TEXT("nullptr is invalid when using  %s, use Safe version instead"), __FUNCTION__);
-	TArray<FStringFormatArg> FormatArgs;
-	FormatArgs.Add(InObject->GetName());
-	FormatArgs.Add(InObject->GetClass()->GetName());
-	return FString::Format(TEXT("name=\"{0}\" class=\"{1}\""), FormatArgs);
+	return BuildString([InObject](FString& OutString) { AppendNameAndClass(OutString, InObject); });
 }
 
 FString ULogUtilLib::GetNameAndClassSafe(const UObject* const InObject)
 {
-	if(nullptr == InObject)
-	{
-		return FString(TEXT("nullptr"));
-	}
-	return GetNameAndClass(InObject);
+	return BuildString([InObject](FString& OutString) { AppendNameAndClassSafe(OutString, InObject); });
 }
 
 FString ULogUtilLib::GetNameAndClassScoped(const UObject* const InObject)
 {
-	FString Result;
-	Result.Append(TEXT("("));
-	if(InObject)
+	return BuildString([InObject](FString& OutString) { AppendNameAndClassScoped(OutString, InObject); });
+}
+
+FString ULogUtilLib::GetKeyedNameAndClass(const FString& InKey, const UObject* const InObject)
+{
+	return GetKeyedNameAndClassC(*InKey, InObject);
+}
+
+FString ULogUtilLib::GetKeyedNameAndClassC(const TCHAR* InKey, const UObject* const InObject)
+{
+	return BuildString([InKey, InObject](FString& OutString) { AppendKeyedNameAndClassC(OutString, InKey, InObject); });
+}
+
+FString& ULogUtilLib::GetScratchString()
+{
+	static thread_local FString ScratchString;
+	ScratchString.Reset();
+	return ScratchString;
+}
+
+void ULogUtilLib::AppendNameAndClass(FString& InOut, const UObject* const InObject)
+{
+	checkf(InObject, TEXT("nullptr is invalid when using  %s, use Safe version instead"), TEXT(__FUNCTION__));
+	if(FMyObjectDescriptorCache::IsEnabled())
 	{
-		Result.Append(GetNameAndClass(InObject));
+		FMyObjectDescriptorCache::AppendNameAndClass(InOut, InObject);
+		return;
 	}
-	else
+	AppendNameAndClassUncached(InOut, InObject);
+}
+
+void ULogUtilLib::AppendNameAndClassUncached(FString& InOut, const UObject* const InObject)
+{
+	checkf(InObject, TEXT("nullptr is invalid when using  %s, use Safe version instead"), TEXT(__FUNCTION__));
+	InOut.Append(TEXT("name=\""));
+	InObject->GetFName().AppendString(InOut);
+	InOut.Append(TEXT("\" class=\""));
+	InObject->GetClass()->GetFName().AppendString(InOut);
+	InOut.AppendChar(TEXT('"'));
+}
+
+void ULogUtilLib::AppendNameAndClassSafe(FString& InOut, const UObject* const InObject)
+{
+	if(nullptr == InObject)
 	{
-		Result.Append(TEXT("nullptr"));
+		InOut.Append(TEXT("nullptr"));
+		return;
 	}
-	Result.Append(TEXT(")"));
-	return Result;
+	AppendNameAndClass(InOut, InObject);
 }
 
-FString ULogUtilLib::GetKeyedNameAndClass(const FString& InKey, const UObject* const InObject)
+void ULogUtilLib::AppendNameAndClassScoped(FString& InOut, const UObject* const InObject)
 {
-	return GetKeyedNameAndClassC(*InKey, InObject);
+	InOut.AppendChar(TEXT('('));
+	AppendNameAndClassSafe(InOut, InObject);
+	InOut.AppendChar(TEXT(')'));
 }
 
-FString ULogUtilLib::GetKeyedNameAndClassC(const TCHAR* InKey, const UObject* const InObject)
+void ULogUtilLib::AppendKeyedNameAndClassC(FString& InOut, const TCHAR* const InKey, const UObject* const InObject)
 {
-	return FString::Printf(TEXT("%s : %s"), InKey, *GetNameAndClassScoped(InObject)); 
+	AppendKey(InOut, InKey);
+	AppendNameAndClassScoped(InOut, InObject);
+}
+
+void ULogUtilLib::AppendYesNo(FString& InOut, bool const bYes)
+{
+	InOut.Append(GetYesNoText(bYes));
+}
+
+void ULogUtilLib::AppendKeyYesNoC(FString& InOut, const TCHAR* const InKey, bool const bInValue)
+{
+	AppendKey(InOut, InKey);
+	AppendYesNo(InOut, bInValue);
+}
+
+void ULogUtilLib::AppendKeyFloatC(FString& InOut, const TCHAR* const InKey, float const InValue)
+{
+	AppendKey(InOut, InKey);
+	AppendNumber(InOut, TEXT("%f"), InValue);
+}
+
+void ULogUtilLib::AppendKeyDoubleC(FString& InOut, const TCHAR* const InKey, double const InValue)
+{
+	AppendKey(InOut, InKey);
+	AppendNumber(InOut, TEXT("%lf"), InValue);
+}
+
+void ULogUtilLib::AppendKeyInt32C(FString& InOut, const TCHAR* const InKey, int32 const InValue)
+{
+	AppendKey(InOut, InKey);
+	AppendNumber(InOut, TEXT("%d"), InValue);
+}
+
+void ULogUtilLib::AppendKeyCStringC(FString& InOut, const TCHAR* const InKey, const TCHAR* const InValue)
+{
+	AppendKey(InOut, InKey);
+	InOut.AppendChar(TEXT('"'));
+	InOut.Append(InValue);
+	InOut.AppendChar(TEXT('"'));
+}
+
+void ULogUtilLib::AppendKeyTextC(FString& InOut, const TCHAR* const InKey, const FText& InValue)
+{
+	AppendKey(InOut, InKey);
+	InOut.AppendChar(TEXT('"'));
+	InOut.Append(InValue.ToString());
+	InOut.AppendChar(TEXT('"'));
+}
+
+void ULogUtilLib::AppendKeyNameC(FString& InOut, const TCHAR* const InKey, const FName& InValue)
+{
+	AppendKey(InOut, InKey);
+	InOut.AppendChar(TEXT('"'));
+	InValue.AppendString(InOut);
+	InOut.AppendChar(TEXT('"'));
 }
 
 void ULogUtilLib::LogNameClassSafe(const UObject* const InObject)
 {
-	M_LOG(TEXT("%s"), *GetNameAndClassSafe(InObject));
+	FString& Line = GetScratchString();
+	AppendNameAndClassSafe(Line, InObject);
+	M_LOG(TEXT("%s"), *Line);
 }
 
 void ULogUtilLib::LogKeyedNameClassSafe(const FString& InKey, const UObject* const InObject)
@@ -71,7 +263,7 @@ void ULogUtilLib::LogKeyedNameClassSafe(const FString& InKey, const UObject* con
 
 void ULogUtilLib::LogKeyedNameClassSafeC(const TCHAR* InKey, const UObject* const InObject)
 {
-	M_LOG(TEXT("%s"), *GetKeyedNameAndClassC(InKey, InObject));
+	M_LOGKV(InKey, InObject);
 }
 
 void ULogUtilLib::LogKeyedNameClassSafeIf(bool const bInShouldLog, const FString& InKey, const UObject* const InObject)
@@ -94,7 +286,7 @@ void ULogUtilLib::LogVector(const FString& InKey, const FVector& InVector)
 
 void ULogUtilLib::LogVectorC(const TCHAR* InKey, const FVector& InVector)
 {
-	LogStringC(InKey, InVector.ToString());
+	M_LOGKV(InKey, InVector);
 }
 
 void ULogUtilLib::LogVectorIf(bool bInShouldLog, const FString& InKey, const FVector& InVector)
@@ -112,7 +304,7 @@ void ULogUtilLib::LogVectorIfC(bool bInShouldLog, const TCHAR* InKey, const FVec
 
 void ULogUtilLib::LogVector2DC(const TCHAR* InKey, const FVector2D& InVector)
 {
-	LogStringC(InKey, InVector.ToString());
+	LogCStringC(InKey, *MyFloatFormat::ToText(InVector));
 }
 
 void ULogUtilLib::LogVector2D(const FString& InKey, const FVector2D& InVector)
@@ -141,7 +333,7 @@ void ULogUtilLib::LogVector4(const FString& InKey, const FVector4& InVector)
 
 void ULogUtilLib::LogVector4C(const TCHAR* InKey, const FVector4& InVector)
 {
-	LogStringC(InKey, InVector.ToString());
+	LogCStringC(InKey, *MyFloatFormat::ToText(InVector));
 }
 
 void ULogUtilLib::LogVector4If(bool bInShouldLog, const FString& InKey, const FVector4& InVector)
@@ -153,7 +345,7 @@ void ULogUtilLib::LogVector4IfC(bool bInShouldLog, const TCHAR* InKey, const FVe
 {
 	if(bInShouldLog)
 	{
-		return;
+		LogVector4C(InKey, InVector);
 	}
 }
 
@@ -164,7 +356,7 @@ void ULogUtilLib::LogRotator(const FString& InKey, const FRotator& InRotator)
 
 void ULogUtilLib::LogRotatorC(const TCHAR* InKey, const FRotator& InRotator)
 {
-	LogStringC(InKey, InRotator.ToString());
+	M_LOGKV(InKey, InRotator);
 }
 
 void ULogUtilLib::LogRotatorIf(bool bInShouldLog, const FString& InKey, const FRotator& InRotator)
@@ -191,15 +383,16 @@ void ULogUtilLib::LogQuatC(const TCHAR* InKey, const FQuat& InQuat)
 	float Angle;
 	InQuat.ToAxisAndAngle(Axis, Angle);
 
-	TArray<FStringFormatArg> const FormatArgs
-	{
-		InQuat.ToString(),
-		Axis.ToString(),
-		Angle,
-		InQuat.Rotator().ToString()
-	};
-
-	LogStringC(InKey, FString::Format(TEXT("{0} [Axis={1} Angle={2}] { {3} }"), FormatArgs));
+	// "Quat [Axis=Axis Angle=Angle] { Rotator }"
+	FMyMathText Text = MyFloatFormat::ToText(InQuat);
+	Text.Append(TEXT(" [Axis="));
+	Text.Append(*MyFloatFormat::ToText(Axis));
+	Text.Append(TEXT(" Angle="));
+	Text.AppendFloat(Angle, MyFloatFormat::ROTATOR_PRECISION);
+	Text.Append(TEXT("] { "));
+	Text.Append(*MyFloatFormat::ToText(InQuat.Rotator()));
+	Text.Append(TEXT(" }"));
+	LogCStringC(InKey, *Text);
 }
 
 void ULogUtilLib::LogQuatIf(bool bInShouldLog, const FString& InKey, const FQuat& InQuat)
@@ -247,7 +440,7 @@ void ULogUtilLib::LogPlane(const FString& InKey, const FPlane& InPlane)
 
 void ULogUtilLib::LogPlaneC(const TCHAR* InKey, const FPlane& InPlane)
 {
-	LogStringC(InKey, InPlane.ToString());
+	LogCStringC(InKey, *MyFloatFormat::ToText(InPlane));
 }
 
 void ULogUtilLib::LogPlaneIf(bool bInShouldLog, const FString& InKey, const FPlane& InPlane)
@@ -263,9 +456,55 @@ void ULogUtilLib::LogPlaneIfC(bool bInShouldLog, const TCHAR* InKey, const FPlan
 	}
 }
 
+void ULogUtilLib::LogTranslationMatrix(const FString& InKey, const FTranslationMatrix& InMatrix)
+{
+	LogTranslationMatrixC(*InKey, InMatrix);
+}
+
+void ULogUtilLib::LogTranslationMatrixC(const TCHAR* InKey, const FTranslationMatrix& InMatrix)
+{
+	LogCStringC(InKey, *MyFloatFormat::ToText(InMatrix));
+}
+
+void ULogUtilLib::LogTranslationMatrixIf(bool bInShouldLog, const FString& InKey, const FTranslationMatrix& InMatrix)
+{
+	LogTranslationMatrixIfC(bInShouldLog, *InKey, InMatrix);
+}
+
+void ULogUtilLib::LogTranslationMatrixIfC(bool bInShouldLog, const TCHAR* InKey, const FTranslationMatrix& InMatrix)
+{
+	if(bInShouldLog)
+	{
+		LogTranslationMatrixC(InKey, InMatrix);
+	}
+}
+
+void ULogUtilLib::LogRotationMatrix(const FString& InKey, const FRotationMatrix& InMatrix)
+{
+	LogRotationMatrixC(*InKey, InMatrix);
+}
+
+void ULogUtilLib::LogRotationMatrixC(const TCHAR* InKey, const FRotationMatrix& InMatrix)
+{
+	LogCStringC(InKey, *MyFloatFormat::ToText(InMatrix));
+}
+
+void ULogUtilLib::LogRotationMatrixIf(bool bInShouldLog, const FString& InKey, const FRotationMatrix& InMatrix)
+{
+	LogRotationMatrixIfC(bInShouldLog, *InKey, InMatrix);
+}
+
+void ULogUtilLib::LogRotationMatrixIfC(bool bInShouldLog, const TCHAR* InKey, const FRotationMatrix& InMatrix)
+{
+	if(bInShouldLog)
+	{
+		LogRotationMatrixC(InKey, InMatrix);
+	}
+}
+
 FString ULogUtilLib::GetYesNo(bool const bYes)
 {
-	return bYes ? FString(TEXT("YES")) : FString(TEXT("no"));
+	return FString(GetYesNoText(bYes));
 }
 
 FString ULogUtilLib::GetKeyYesNo(const FString& InKey, bool const bInValue)
@@ -275,7 +514,7 @@ FString ULogUtilLib::GetKeyYesNo(const FString& InKey, bool const bInValue)
 
 FString ULogUtilLib::GetKeyYesNoC(const TCHAR* const InKey, bool const bInValue)
 {
-	return FString::Printf(TEXT("%s : %s"), InKey, *GetYesNo(bInValue));
+	return BuildString([InKey, bInValue](FString& OutString) { AppendKeyYesNoC(OutString, InKey, bInValue); });
 }
 
 void ULogUtilLib::LogYesNo(const FString& InKey, bool const bInValue)
@@ -285,7 +524,7 @@ void ULogUtilLib::LogYesNo(const FString& InKey, bool const bInValue)
 
 void ULogUtilLib::LogYesNoC(const TCHAR* const InKey, bool const bInValue)
 {
-	M_LOG(TEXT("%s : %s"), InKey, *GetYesNo(bInValue));
+	M_LOGKV(InKey, bInValue);
 }
 
 void ULogUtilLib::LogYesNoIf(bool const bInShouldLog, const FString& InKey, bool const bInValue)
@@ -295,7 +534,7 @@ void ULogUtilLib::LogYesNoIf(bool const bInShouldLog, const FString& InKey, bool
 
 void ULogUtilLib::LogYesNoIfC(bool const bInShouldLog, const TCHAR* const InKey, bool const bInValue)
 {
-	M_LOG_IF(bInShouldLog, TEXT("%s : %s"), InKey, *GetYesNo(bInValue));
+	M_LOGKV_IF(bInShouldLog, InKey, bInValue);
 }
 
 void ULogUtilLib::LogYesNoIfFlags(ELogFlags const InLogFlags, const FString& InKey, bool const bInValue)
@@ -305,7 +544,7 @@ void ULogUtilLib::LogYesNoIfFlags(ELogFlags const InLogFlags, const FString& InK
 
 void ULogUtilLib::LogYesNoIfFlagsC(ELogFlags const InLogFlags, const TCHAR* const InKey, bool const bInValue)
 {
-	M_LOG_IF_FLAGS(InLogFlags, TEXT("%s : %s"), InKey, *GetYesNo(bInValue));
+	M_LOGKV_IF_FLAGS(InLogFlags, InKey, bInValue);
 }
 
 void ULogUtilLib::LogFloat(const FString& InKey, float const InValue)
@@ -315,12 +554,12 @@ void ULogUtilLib::LogFloat(const FString& InKey, float const InValue)
 
 void ULogUtilLib::LogFloatC(const TCHAR* const InKey, float const InValue)
 {
-	M_LOG(TEXT("%s : %f"), InKey, InValue);
+	M_LOGKV(InKey, InValue);
 }
 
 void ULogUtilLib::LogFloatIfC(bool const bInShouldLog, const TCHAR* const InKey, float const InValue)
 {
-	M_LOG_IF(bInShouldLog, TEXT("%s : %f"), InKey, InValue);
+	M_LOGKV_IF(bInShouldLog, InKey, InValue);
 }
 
 void ULogUtilLib::LogFloatIf(bool const bInShouldLog, const FString& InKey, float const InValue)
@@ -330,7 +569,7 @@ void ULogUtilLib::LogFloatIf(bool const bInShouldLog, const FString& InKey, floa
 
 void ULogUtilLib::LogFloatIfFlagsC(ELogFlags const InFlags, const TCHAR* const InKey, float const InValue)
 {
-	M_LOG_IF_FLAGS(InFlags, TEXT("%s : %f"), InKey, InValue);
+	M_LOGKV_IF_FLAGS(InFlags, InKey, InValue);
 }
 
 void ULogUtilLib::LogFloatIfFlags(ELogFlags const InFlags, const FString& InKey, float const InValue)
@@ -345,7 +584,7 @@ FString ULogUtilLib::GetKeyFloat(const FString& InKey, float const InValue)
 
 FString ULogUtilLib::GetKeyFloatC(const TCHAR* const InKey, float const InValue)
 {
-	return FString::Printf(TEXT("%s : %f"), InKey, InValue);
+	return BuildString([InKey, InValue](FString& OutString) { AppendKeyFloatC(OutString, InKey, InValue); });
 }
 void ULogUtilLib::LogDouble(const FString& InKey, double const InValue)
 {
@@ -354,7 +593,7 @@ void ULogUtilLib::LogDouble(const FString& InKey, double const InValue)
 
 void ULogUtilLib::LogDoubleC(const TCHAR* const InKey, double const InValue)
 {
-	M_LOG(TEXT("%s : %lf"), InKey, InValue);
+	M_LOGKV(InKey, InValue);
 }
 
 void ULogUtilLib::LogDoubleIf(bool const bInShouldLog, const FString& InKey, double const InValue)
@@ -364,7 +603,7 @@ void ULogUtilLib::LogDoubleIf(bool const bInShouldLog, const FString& InKey, dou
 
 void ULogUtilLib::LogDoubleIfC(bool const bInShouldLog, const TCHAR* const InKey, double const InValue)
 {
-	M_LOG_IF(bInShouldLog, TEXT("%s : %lf"), InKey, InValue);
+	M_LOGKV_IF(bInShouldLog, InKey, InValue);
 }
 
 void ULogUtilLib::LogDoubleIfFlags(ELogFlags const InFlags, const FString& InKey, double const InValue)
@@ -374,7 +613,7 @@ void ULogUtilLib::LogDoubleIfFlags(ELogFlags const InFlags, const FString& InKey
 
 void ULogUtilLib::LogDoubleIfFlagsC(ELogFlags const InFlags, const TCHAR* const InKey, double const InValue)
 {
-	M_LOG_IF_FLAGS(InFlags, TEXT("%s : %lf"), InKey, InValue);
+	M_LOGKV_IF_FLAGS(InFlags, InKey, InValue);
 }
 
 FString ULogUtilLib::GetKeyDouble(const FString& InKey, double const InValue)
@@ -384,7 +623,7 @@ FString ULogUtilLib::GetKeyDouble(const FString& InKey, double const InValue)
 
 FString ULogUtilLib::GetKeyDoubleC(const TCHAR* const InKey, double const InValue)
 {
-	return FString::Printf(TEXT("%s : %lf"), InKey, InValue);
+	return BuildString([InKey, InValue](FString& OutString) { AppendKeyDoubleC(OutString, InKey, InValue); });
 }
 
 void ULogUtilLib::LogInt32(const FString& InKey, int32 const InValue)
@@ -394,7 +633,7 @@ void ULogUtilLib::LogInt32(const FString& InKey, int32 const InValue)
 
 void ULogUtilLib::LogInt32C(const TCHAR* const InKey, int32 const InValue)
 {
-	M_LOG(TEXT("%s : %d"), InKey, InValue);
+	M_LOGKV(InKey, InValue);
 }
 
 void ULogUtilLib::LogInt32If(bool const bInShouldLog, const FString& InKey, int32 const InValue)
@@ -404,7 +643,7 @@ void ULogUtilLib::LogInt32If(bool const bInShouldLog, const FString& InKey, int3
 
 void ULogUtilLib::LogInt32IfC(bool const bInShouldLog, const TCHAR* InKey, int32 const InValue)
 {
-	M_LOG_IF(bInShouldLog, TEXT("%s : %d"), InKey, InValue);
+	M_LOGKV_IF(bInShouldLog, InKey, InValue);
 }
 
 void ULogUtilLib::LogInt32IfFlags(ELogFlags const InLogFlags, const FString& InKey, int32 const InValue)
@@ -414,7 +653,7 @@ void ULogUtilLib::LogInt32IfFlags(ELogFlags const InLogFlags, const FString& InK
 
 void ULogUtilLib::LogInt32IfFlagsC(ELogFlags const InLogFlags, const TCHAR* const InKey, int32 const InValue)
 {
-	M_LOG_IF_FLAGS(InLogFlags, TEXT("%s : %d"), InKey, InValue);
+	M_LOGKV_IF_FLAGS(InLogFlags, InKey, InValue);
 }
 
 FString ULogUtilLib::GetKeyInt32(const FString& InKey, int32 InValue)
@@ -424,7 +663,7 @@ FString ULogUtilLib::GetKeyInt32(const FString& InKey, int32 InValue)
 
 FString ULogUtilLib::GetKeyInt32C(const TCHAR* const InKey, int32 InValue)
 {
-	return FString::Printf(TEXT("%s : %d"), InKey, InValue);
+	return BuildString([InKey, InValue](FString& OutString) { AppendKeyInt32C(OutString, InKey, InValue); });
 }
 
 void ULogUtilLib::LogString(const FString& InKey, const FString& InValue)
@@ -460,8 +699,7 @@ void ULogUtilLib::LogCString(const FString& InKey, const TCHAR* InValue)
 
 void ULogUtilLib::LogCStringC(const TCHAR* const InKey, const TCHAR* InValue)
 {
-	M_LOG(TEXT("%s : \"%s\""), InKey, InValue);
-
+	M_LOGKV(InKey, InValue);
 }
 void ULogUtilLib::LogCStringIf(bool bInShouldLog, const FString& InKey, const TCHAR* const InValue)
 {
@@ -470,7 +708,7 @@ void ULogUtilLib::LogCStringIf(bool bInShouldLog, const FString& InKey, const TC
 
 void ULogUtilLib::LogCStringIfC(bool bInShouldLog, const TCHAR* const InKey, const TCHAR* const InValue)
 {
-	M_LOG_IF(bInShouldLog, TEXT("%s : \"%s\""), InKey, InValue);
+	M_LOGKV_IF(bInShouldLog, InKey, InValue);
 }
 void ULogUtilLib::LogCStringIfFlags(ELogFlags InLogFlags, const FString& InKey, const TCHAR* const InValue)
 {
@@ -479,7 +717,7 @@ void ULogUtilLib::LogCStringIfFlags(ELogFlags InLogFlags, const FString& InKey,
 
 void ULogUtilLib::LogCStringIfFlagsC(ELogFlags InLogFlags, const TCHAR* const InKey, const TCHAR* const InValue)
 {
-	M_LOG_IF_FLAGS(InLogFlags, TEXT("%s : \"%s\""), InKey, InValue);
+	M_LOGKV_IF_FLAGS(InLogFlags, InKey, InValue);
 }
 
 FString ULogUtilLib::GetKeyCString(const FString& InKey, const TCHAR* const InValue)
@@ -489,7 +727,7 @@ FString ULogUtilLib::GetKeyCString(const FString& InKey, const TCHAR* const InVa
 
 FString ULogUtilLib::GetKeyCStringC(const TCHAR* const InKey, const TCHAR* const InValue)
 {
-	return FString::Printf(TEXT("%s : \"%s\""), InKey, InValue);
+	return BuildString([InKey, InValue](FString& OutString) { AppendKeyCStringC(OutString, InKey, InValue); });
 }
 FString ULogUtilLib::GetKeyString(const FString& InKey, const FString& InValue)
 {
@@ -508,7 +746,7 @@ void ULogUtilLib::LogText(const FString& InKey, const FText& InValue)
 
 void ULogUtilLib::LogTextC(const TCHAR* const InKey, const FText& InValue)
 {
-	M_LOG(TEXT("%s : \"%s\""), InKey, *InValue.ToString());
+	M_LOGKV(InKey, InValue);
 }
 
 void ULogUtilLib::LogTextIf(bool const bInShouldLog, const FString& InKey, const FText& InValue)
@@ -518,7 +756,7 @@ void ULogUtilLib::LogTextIf(bool const bInShouldLog, const FString& InKey, const
 
 void ULogUtilLib::LogTextIfC(bool const bInShouldLog, const TCHAR* const InKey, const FText& InValue)
 {
-	M_LOG_IF(bInShouldLog, TEXT("%s : \"%s\""), InKey, *InValue.ToString());
+	M_LOGKV_IF(bInShouldLog, InKey, InValue);
 }
 
 void ULogUtilLib::LogTextIfFlags(ELogFlags const InLogFlags, const FString& InKey, const FText& InValue)
@@ -528,7 +766,7 @@ void ULogUtilLib::LogTextIfFlags(ELogFlags const InLogFlags, const FString& InKe
  
 void ULogUtilLib::LogTextIfFlagsC(ELogFlags const InLogFlags, const TCHAR* const InKey, const FText& InValue)
 {
-	M_LOG_IF_FLAGS(InLogFlags, TEXT("%s : \"%s\""), InKey, *InValue.ToString());
+	M_LOGKV_IF_FLAGS(InLogFlags, InKey, InValue);
 }
 
 FString ULogUtilLib::GetKeyText(const FString& InKey, const FText& InValue)
@@ -538,7 +776,7 @@ FString ULogUtilLib::GetKeyText(const FString& InKey, const FText& InValue)
 
 FString ULogUtilLib::GetKeyTextC(const TCHAR* const InKey, const FText& InValue)
 {
-	return FString::Printf(TEXT("%s : \"%s\""), InKey, *InValue.ToString());
+	return BuildString([InKey, &InValue](FString& OutString) { AppendKeyTextC(OutString, InKey, InValue); });
 }
 
 void ULogUtilLib::LogName(const FString& InKey, const FName& InValue)
@@ -548,7 +786,7 @@ void ULogUtilLib::LogName(const FString& InKey, const FName& InValue)
 
 void ULogUtilLib::LogNameC(const TCHAR* const InKey, const FName& InValue)
 {
-	M_LOG(TEXT("%s : \"%s\""), InKey, *InValue.ToString());
+	M_LOGKV(InKey, InValue);
 }
 
 void ULogUtilLib::LogNameIf(bool const bInShouldLog, const FString& InKey, const FName& InValue)
@@ -558,7 +796,7 @@ void ULogUtilLib::LogNameIf(bool const bInShouldLog, const FString& InKey, const
 
 void ULogUtilLib::LogNameIfC(bool const bInShouldLog, const TCHAR* const InKey, const FName& InValue)
 {
-	M_LOG_IF(bInShouldLog, TEXT("%s : \"%s\""), InKey, *InValue.ToString());
+	M_LOGKV_IF(bInShouldLog, InKey, InValue);
 }
 
 void ULogUtilLib::LogNameIfFlags(ELogFlags const InLogFlags, const FString& InKey, const FName& InValue)
@@ -568,7 +806,7 @@ void ULogUtilLib::LogNameIfFlags(ELogFlags const InLogFlags, const FString& InKe
 
 void ULogUtilLib::LogNameIfFlagsC(ELogFlags const InLogFlags, const TCHAR* const InKey, const FName& InValue)
 {
-	M_LOG_IF_FLAGS(InLogFlags, TEXT("%s : \"%s\""), InKey, *InValue.ToString());
+	M_LOGKV_IF_FLAGS(InLogFlags, InKey, InValue);
 }
 
 FString ULogUtilLib::GetKeyName(const FString& InKey, const FName& InValue)
@@ -578,7 +816,7 @@ FString ULogUtilLib::GetKeyName(const FString& InKey, const FName& InValue)
 
 FString ULogUtilLib::GetKeyNameC(const TCHAR* const InKey, const FName& InValue)
 {
-	return FString::Printf(TEXT("%s : \"%s\""), InKey, *InValue.ToString());
+	return BuildString([InKey, &InValue](FString& OutString) { AppendKeyNameC(OutString, InKey, InValue); });
 }
 
 void ULogUtilLib::LogObjectSafe(const UObject* const InObject, EMyLogObjectFlags const InFlags)
@@ -635,182 +873,181 @@ void ULogUtilLib::LogObjectSafeIfFlags(ELogFlags InLogFlags, const UObject* InOb
 	LogObjectSafeIf(bShouldLog, InObject, InFlags);
 }
 
-FString ULogUtilLib::GetInternalObjectFlagsStringScoped(EInternalObjectFlags const InFlags)
+int32 ULogUtilLib::LogObjectRangeParallel(TArrayView<const UObject* const> const InObjects, ELogRangeFlags const InFlags, EMyLogObjectFlags const InLogObjectFlags)
 {
-	return FString::Printf(TEXT("{%s}"), *GetInternalObjectFlagsString(InFlags));
-}
+	int32 const NumObjects = InObjects.Num();
+	M_DECLARE_LOG_CALL_SITE_LEVEL(Site, Log);
+	if( ! M_LOG_IS_ACTIVE(MyLog, Log) || ! Site.IsEnabled() )
+	{
+		return NumObjects;
+	}
 
-FString ULogUtilLib::GetInternalObjectFlagsString(EInternalObjectFlags const InFlags)
-{
-	FString S;
-	if(InFlags == EInternalObjectFlags::None)
+	// The parallel formatting is accounted to the first line, packing of each line to the line itself
+	bool const bStats = FMyLogStats::IsEnabled();
+	uint64 StartCycles = bStats ? FPlatformTime::Cycles64() : 0;
+
+	// The summary is the last text, so it's packed on the line of the last elements by OneLine
+	bool const bShouldLogSummary = (InFlags & ELogRangeFlags::LogSummary) != ELogRangeFlags::None;
+	TArray<FString> Texts;
+	Texts.SetNum(NumObjects + (bShouldLogSummary ? 1 : 0));
+	if(bShouldLogSummary)
 	{
-		return FString(TEXT("None"));
+		Texts.Last() = FString::Printf(TEXT("Total %d objects logged"), NumObjects);
 	}
-	else
+
+	// Each element is written only to its own string, so the formatting needs no synchronization
+	ParallelFor(NumObjects, [&Texts, InObjects, InFlags, InLogObjectFlags](int32 const InIndex)
 	{
-		if((InFlags & EInternalObjectFlags::ReachableInCluster) != EInternalObjectFlags::None)
-		{
-			S.Append(TEXT("ReachableInCluster | "));
-		}
-		if((InFlags & EInternalObjectFlags::ClusterRoot)  != EInternalObjectFlags::None)
-		{
-			S.Append(TEXT("ClusterRoot | "));
-		}
-		if((InFlags & EInternalObjectFlags::Native) != EInternalObjectFlags::None)
-		{
-			S.Append(TEXT("Native | "));
-		}
-		if((InFlags & EInternalObjectFlags::Async) != EInternalObjectFlags::None)
-		{
-			S.Append(TEXT("Async | "));
-		}
-		if((InFlags & EInternalObjectFlags::AsyncLoading) != EInternalObjectFlags::None)
-		{
-			S.Append(TEXT("AsyncLoading | "));
-		}
-		if((InFlags & EInternalObjectFlags::Unreachable) != EInternalObjectFlags::None)
+		FString& Text = Texts[InIndex];
+		Text.Reserve(APPEND_RESERVED_LEN);
+		AppendRangeElement(Text, InObjects[InIndex], InIndex, InFlags, InLogObjectFlags);
+	}, /*bForceSingleThread*/NumObjects < PARALLEL_RANGE_MIN_NUM);
+
+	bool const bOneLine = (InFlags & ELogRangeFlags::OneLine) != ELogRangeFlags::None;
+	const TCHAR* const Separator = TEXT(", ");
+	int32 const SeparatorLen = FCString::Strlen(Separator);
+	int32 const MaxTextLen = FMyLogLine::CAPACITY - 1 - Site.Postfix.Len();
+	int32 TextIndex = 0;
+	while(TextIndex < Texts.Num())
+	{
+		FMyLogLine Line;
+		Line.Append(Site.Prefix);
+		int32 const LineStartLen = Line.Len();
+		// At least one text per line (truncated if it does NOT fit)
+		do
 		{
-			S.Append(TEXT("Unreachable | "));
+			if(Line.Len() > LineStartLen)
+			{
+				Line.Append(Separator, SeparatorLen);
+			}
+			const FString& Text = Texts[TextIndex++];
+			Line.Append(*Text, FMath::Max(0, FMath::Min(Text.Len(), MaxTextLen - Line.Len())));
 		}
-		if((InFlags & EInternalObjectFlags::PendingKill) != EInternalObjectFlags::None)
+		while(bOneLine && TextIndex < Texts.Num() && Line.Len() + SeparatorLen + Texts[TextIndex].Len() <= MaxTextLen);
+		Line.Append(Site.Postfix);
+		if(bStats)
 		{
-			S.Append(TEXT("PendingKill | "));
+			FMyLogStats::AddCall(Site, MyLog, FPlatformTime::Cycles64() - StartCycles);
 		}
-		if((InFlags & EInternalObjectFlags::RootSet) != EInternalObjectFlags::None)
+		MyLog::Emit(Site, MyLog, ELogVerbosity::Log, Line.GetData());
+		if(bStats)
 		{
-			S.Append(TEXT("RootSet | "));
+			StartCycles = FPlatformTime::Cycles64();
 		}
 	}
-	return S;
+	return NumObjects;
+}
+
+FString ULogUtilLib::GetInternalObjectFlagsStringScoped(EInternalObjectFlags const InFlags)
+{
+	return BuildString([InFlags](FString& OutString)
+	{
+		OutString.AppendChar(TEXT('{'));
+		AppendInternalObjectFlagsString(OutString, InFlags);
+		OutString.AppendChar(TEXT('}'));
+	});
+}
+
+FString ULogUtilLib::GetInternalObjectFlagsString(EInternalObjectFlags const InFlags)
+{
+	return BuildString([InFlags](FString& OutString) { AppendInternalObjectFlagsString(OutString, InFlags); });
+}
+
+void ULogUtilLib::AppendInternalObjectFlagsString(FString& InOut, EInternalObjectFlags const InFlags)
+{
+	GetInternalObjectFlagsFormatter().Append(InOut, InFlags);
 }
 
 FString ULogUtilLib::GetObjectFlagsStringScoped(EObjectFlags const InFlags)
 {
-	return FString::Printf(TEXT("{%s}"), *GetObjectFlagsString(InFlags));
+	return BuildString([InFlags](FString& OutString)
+	{
+		OutString.AppendChar(TEXT('{'));
+		AppendObjectFlagsString(OutString, InFlags);
+		OutString.AppendChar(TEXT('}'));
+	});
 }
 
 FString ULogUtilLib::GetObjectFlagsString(EObjectFlags const InFlags)
 {
-	FString S;
-	if(InFlags == EObjectFlags::RF_NoFlags)
+	return BuildString([InFlags](FString& OutString) { AppendObjectFlagsString(OutString, InFlags); });
+}
+
+void ULogUtilLib::AppendFlagsOfObject(FString& InOut, const UObject* const InObject)
+{
+	checkf(InObject, TEXT("nullptr is invalid in %s"), TEXT(__FUNCTION__));
+	if(FMyObjectDescriptorCache::IsEnabled())
 	{
-		return FString(TEXT("None"));
+		FMyObjectDescriptorCache::AppendObjectFlags(InOut, InObject);
+		return;
 	}
-	else
+	AppendObjectFlagsString(InOut, InObject->GetFlags());
+}
+
+void ULogUtilLib::AppendObjectSafeDetails(FString& InOut, const UObject* const InObject, EMyLogObjectFlags const InFlags)
+{
+	checkf(InObject, TEXT("nullptr is invalid in %s"), TEXT(__FUNCTION__));
+	if( (InFlags & EMyLogObjectFlags::SuppressNameAndClass) == EMyLogObjectFlags::None )
 	{
-		if((InFlags & EObjectFlags::RF_Public) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("Public | "));
-		}
-		if((InFlags & EObjectFlags::RF_Standalone) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("Standalone | "));
-		}
-		if((InFlags & EObjectFlags::RF_MarkAsNative) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("MarkAsNative | "));
-		}
-		if((InFlags & EObjectFlags::RF_Transactional) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("Transactional | "));
-		}
-		if((InFlags & EObjectFlags::RF_ClassDefaultObject) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("ClassDefaultObject | "));
-		}
-		if((InFlags & EObjectFlags::RF_ArchetypeObject) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("ArchetypeObject | "));
-		}
-		if((InFlags & EObjectFlags::RF_Transient) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("Transient | "));
-		}
-		if((InFlags & EObjectFlags::RF_MarkAsRootSet) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("MarkAsRootSet | "));
-		}
-		if((InFlags & EObjectFlags::RF_TagGarbageTemp) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("TagGarbageTemp | "));
-		}
-		if((InFlags & EObjectFlags::RF_NeedInitialization) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("NeedInitialization | "));
-		}
-		if((InFlags & EObjectFlags::RF_NeedLoad) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("NeedLoad | "));
-		}
-		if((InFlags & EObjectFlags::RF_KeepForCooker) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("KeepForCooker | "));
-		}
-		if((InFlags & EObjectFlags::RF_NeedPostLoad) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("NeedPostLoad | "));
-		}
-		if((InFlags & EObjectFlags::RF_NeedPostLoadSubobjects) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("NeedPostLoadSubobjects | "));
-		}
-		if((InFlags & EObjectFlags::RF_NewerVersionExists) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("NewerVersionExists | "));
-		}
-		if((InFlags & EObjectFlags::RF_BeginDestroyed) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("BeginDestroyed | "));
-		}
-		if((InFlags & EObjectFlags::RF_FinishDestroyed) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("FinishDestroyed | "));
-		}
-		if((InFlags & EObjectFlags::RF_BeingRegenerated) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("BeingRegenerated | "));
-		}
-		if((InFlags & EObjectFlags::RF_DefaultSubObject) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("DefaultSubObject | "));
-		}
-		if((InFlags & EObjectFlags::RF_WasLoaded) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("WasLoaded | "));
-		}
-		if((InFlags & EObjectFlags::RF_TextExportTransient) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("TextExportTransient | "));
-		}
-		if((InFlags & EObjectFlags::RF_LoadCompleted) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("LoadCompleted | "));
-		}
-		if((InFlags & EObjectFlags::RF_InheritableComponentTemplate) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("InheritableComponentTemplate | "));
-		}
-		if((InFlags & EObjectFlags::RF_DuplicateTransient) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("DuplicateTransient | "));
-		}
-		if((InFlags & EObjectFlags::RF_StrongRefOnFrame) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("StrongRefOnFrame | "));
-		}
-		if((InFlags & EObjectFlags::RF_NonPIEDuplicateTransient) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("NonPIEDuplicateTransient | "));
-		}
-		if((InFlags & EObjectFlags::RF_Dynamic) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("Dynamic | "));
-		}
-		if((InFlags & EObjectFlags::RF_WillBeLoaded) != EObjectFlags::RF_NoFlags)
-		{
-			S.Append(TEXT("WillBeLoaded | "));
-		}
-		return S;
+		InOut.Append(TEXT(" FullName: {"));
+		InOut.Append(InObject->GetFullName());
+		InOut.AppendChar(TEXT('}'));
+	}
+	if(false == InObject->IsValidLowLevelFast(false))
+	{
+		InOut.Append(TEXT(" Object is invalid Low-level NON_RECURSIVE"));
+	}
+	if(false == InObject->IsValidLowLevelFast(true))
+	{
+		InOut.Append(TEXT(" Object is invalid Low-level RECURSIVE"));
 	}
+	if( (InFlags & EMyLogObjectFlags::FullGroupName) != EMyLogObjectFlags::None )
+	{
+		InOut.Append(TEXT(" FullGroupName: {"));
+		InOut.Append(InObject->GetFullGroupName(/*bStartWithOuter*/true));
+		InOut.AppendChar(TEXT('}'));
+	}
+	if( (InFlags & EMyLogObjectFlags::Outer) != EMyLogObjectFlags::None )
+	{
+		InOut.Append(TEXT(" Outer: {"));
+		AppendNameAndClassSafe(InOut, InObject->GetOuter());
+		InOut.AppendChar(TEXT('}'));
+	}
+	if( (InFlags & EMyLogObjectFlags::ObjectFlags) != EMyLogObjectFlags::None )
+	{
+		InOut.Append(TEXT(" Flags: {"));
+		AppendFlagsOfObject(InOut, InObject);
+		InOut.AppendChar(TEXT('}'));
+	}
+	if( (InFlags & EMyLogObjectFlags::InternalObjectFlags) != EMyLogObjectFlags::None )
+	{
+		InOut.Append(TEXT(" Internal Flags: {"));
+		AppendInternalObjectFlagsString(InOut, InObject->GetInternalFlags());
+		InOut.AppendChar(TEXT('}'));
+	}
+}
+
+void ULogUtilLib::AppendRangeElement(FString& InOut, const UObject* const InObject, int32 const InIndex, ELogRangeFlags const InFlags, EMyLogObjectFlags const InLogObjectFlags)
+{
+	if( (InFlags & ELogRangeFlags::LogIndex) != ELogRangeFlags::None )
+	{
+		AppendNumber(InOut, TEXT("%d: "), InIndex);
+	}
+	if(InObject == nullptr)
+	{
+		InOut.Append(TEXT("nullptr"));
+		return;
+	}
+	InOut.AppendChar(TEXT('{'));
+	AppendNameAndClassSafe(InOut, InObject);
+	InOut.AppendChar(TEXT('}'));
+	if( (InFlags & ELogRangeFlags::ExtObjectLog) != ELogRangeFlags::None )
+	{
+		AppendObjectSafeDetails(InOut, InObject, InLogObjectFlags);
+	}
+}
+
+void ULogUtilLib::AppendObjectFlagsString(FString& InOut, EObjectFlags const InFlags)
+{
+	GetObjectFlagsFormatter().Append(InOut, InFlags);
 }
@@ -2,10 +2,23 @@
 
 #include "MyDebugMacros.h"
 #include "Log/MyLoggingTypes.h"
+#include "Log/MyLogKV.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "TextProperty.h"
 #include "LogUtilLib.generated.h"
 
+/**
+* Logs the key and the value as the ULogUtilLib::Log*C functions do, but at the call site of the caller
+* (so the line prefix, the MyLog.Sites rules and MyLog.Stats refer to the caller, not to LogUtilLib.cpp).
+* ValueType is the value parameter type of the function: FVector, FRotator, FString, const TCHAR*, float, int32, bool, FName, FText or const UObject*
+* (the value is converted to it, so the same arguments are accepted).
+*
+* Example: M_LOG_VALUE(FVector, TEXT("Location"), Location);
+*/
+#define M_LOG_VALUE(ValueType, Key, Value) M_LOGKV(Key, static_cast<ValueType>(Value))
+#define M_LOG_VALUE_IF(ShouldLog, ValueType, Key, Value) M_LOGKV_IF(ShouldLog, Key, static_cast<ValueType>(Value))
+#define M_LOG_VALUE_IF_FLAGS(LogFlags, ValueType, Key, Value) M_LOGKV_IF_FLAGS(LogFlags, Key, static_cast<ValueType>(Value))
+
 /**
 * @TODO Array utils:
 * 1. Should take UObject-derived classes also!
@@ -49,6 +62,12 @@ enum class ELogRangeFlags : uint8
 	*/
 	OneLine                    = 1 << 3       UMETA(DisplayName="One line"),
 
+	/**
+	* If set, the strings of the elements are formatted in parallel (@see LogObjectRangeParallel),
+	* and the extended object log is written on the line of the element.
+	*/
+	Parallel                   = 1 << 4       UMETA(DisplayName="Parallel"),
+
 	Default                    = LogSummary | LogIndex            UMETA(DisplayName="Default")
 };
 ENUM_CLASS_FLAGS(ELogRangeFlags);
@@ -101,8 +120,13 @@ public:
 		T* const Obj = InObject.GetEvenIfUnreachable();
 		checkf(Obj, TEXT("Returned object ptr for weak object must be valid (because we already tested it earlier in the function)"));
 
-		FString const FlagsString = GetObjectFlagsString(Obj->GetFlags());
-		return FString::Printf(TEXT("%s [%s]"), *GetNameAndClassSafe(Obj), *FlagsString);
+		FString Result;
+		Result.Reserve(APPEND_RESERVED_LEN);
+		AppendNameAndClassSafe(Result, Obj);
+		Result.Append(TEXT(" ["));
+		AppendFlagsOfObject(Result, Obj);
+		Result.AppendChar(TEXT(']'));
+		return Result;
 	}
 
 	/**
@@ -115,6 +139,70 @@ public:
 	static FString GetKeyedNameAndClass(const FString& InKey, const UObject* InObject);
 	static FString GetKeyedNameAndClassC(const TCHAR* InKey, const UObject* InObject);
 
+	// ~Append API Begin (@note: the Get* functions returning FString are wrappers of these)
+	/** Number of characters reserved by the Get* wrappers, so composite strings are usually built with one allocation*/
+	static constexpr int32 APPEND_RESERVED_LEN = 128;
+
+	/**
+	* Returns the empty string of the calling thread (its capacity is kept between the calls),
+	* so lines composed by the Append* functions do NOT allocate once the capacity is reached.
+	* @warning: only valid until the next call of GetScratchString on the same thread.
+	*/
+	static FString& GetScratchString();
+
+	/**
+	* @see GetNameAndClass
+	* @note: the string of the object is cached if enabled (@see FMyObjectDescriptorCache).
+	*/
+	static void AppendNameAndClass(FString& InOut, const UObject* InObject);
+
+	/** AppendNameAndClass bypassing the cache*/
+	static void AppendNameAndClassUncached(FString& InOut, const UObject* InObject);
+
+	/** @see GetNameAndClassSafe*/
+	static void AppendNameAndClassSafe(FString& InOut, const UObject* InObject);
+
+	/** @see GetNameAndClassScoped*/
+	static void AppendNameAndClassScoped(FString& InOut, const UObject* InObject);
+
+	/** @see GetKeyedNameAndClass*/
+	static void AppendKeyedNameAndClassC(FString& InOut, const TCHAR* InKey, const UObject* InObject);
+
+	/** @see GetYesNo*/
+	static void AppendYesNo(FString& InOut, bool bYes);
+
+	static void AppendKeyYesNoC(FString& InOut, const TCHAR* InKey, bool bInValue);
+	static void AppendKeyFloatC(FString& InOut, const TCHAR* InKey, float InValue);
+	static void AppendKeyDoubleC(FString& InOut, const TCHAR* InKey, double InValue);
+	static void AppendKeyInt32C(FString& InOut, const TCHAR* InKey, int32 InValue);
+	static void AppendKeyCStringC(FString& InOut, const TCHAR* InKey, const TCHAR* InValue);
+	static void AppendKeyTextC(FString& InOut, const TCHAR* InKey, const FText& InValue);
+	static void AppendKeyNameC(FString& InOut, const TCHAR* InKey, const FName& InValue);
+
+	/** @see GetInternalObjectFlagsString*/
+	static void AppendInternalObjectFlagsString(FString& InOut, EInternalObjectFlags InFlags);
+
+	/** @see GetObjectFlagsString*/
+	static void AppendObjectFlagsString(FString& InOut, EObjectFlags InFlags);
+
+	/**
+	* Appends the current flags of the object (the string is cached the same way as by AppendNameAndClass).
+	*/
+	static void AppendFlagsOfObject(FString& InOut, const UObject* InObject);
+
+	/**
+	* Appends the extended object log (@see LogObjectSafe) as the single line: FullName: {...} Outer: {...} Flags: {...}
+	* @note: safe to call on any thread while the garbage collection is NOT running.
+	*/
+	static void AppendObjectSafeDetails(FString& InOut, const UObject* InObject, EMyLogObjectFlags InFlags = EMyLogObjectFlags::Default);
+
+	/**
+	* Appends the line of the element of the logged range: "Index: {Name and class}" followed by the extended object log if ExtObjectLog.
+	* @note: safe to call on any thread while the garbage collection is NOT running.
+	*/
+	static void AppendRangeElement(FString& InOut, const UObject* InObject, int32 InIndex, ELogRangeFlags InFlags, EMyLogObjectFlags InLogObjectFlags = EMyLogObjectFlags::Default);
+	// ~Append API End
+
 
 	// ~Range logging Begin
 	/**
@@ -209,6 +297,17 @@ public:
 	)
 	{
 		M_LOGFUNC()
+		if((InFlags & ELogRangeFlags::Parallel) != ELogRangeFlags::None)
+		{
+			TArray<const UObject*> Objects;
+			ReserveForRange(Objects, InRange, 0);
+			for(const UObject* const Obj : InRange)
+			{
+				Objects.Add(Obj);
+			}
+			return LogObjectRangeParallel(Objects, InFlags, InLogObjectFlags);
+		}
+
 		int32 Index = 0;
 		bool const bShouldLogSummary = (InFlags & ELogRangeFlags::LogSummary) != ELogRangeFlags::None;
 		bool const bLogIndex = (InFlags & ELogRangeFlags::LogIndex) != ELogRangeFlags::None;
@@ -241,7 +340,7 @@ public:
 					}
 					else
 					{
-						M_LOG(TEXT("{%s}"), Index, *GetNameAndClassSafe(Obj));
+						M_LOG(TEXT("{%s}"), *GetNameAndClassSafe(Obj));
 					}
 				}
 			}
@@ -255,9 +354,41 @@ public:
 
 		return Index;
 	}
+
+	/**
+	* Logs the objects with the element strings formatted in parallel into the preallocated array
+	* (ranges shorter than PARALLEL_RANGE_MIN_NUM are formatted on the calling thread).
+	* The lines are emitted after the formatting in the order of the range, one after another;
+	* with OneLine the elements (and the summary) are packed into as few lines as fit FMyLogLine.
+	*
+	* @returns: count of objects in the range.
+	*/
+	static int32 LogObjectRangeParallel
+	(
+		TArrayView<const UObject* const> InObjects,
+		ELogRangeFlags InFlags = ELogRangeFlags::Default | ELogRangeFlags::Parallel,
+		EMyLogObjectFlags InLogObjectFlags = EMyLogObjectFlags::Default
+	);
+
+	/** Ranges shorter than this are formatted on the calling thread by LogObjectRangeParallel*/
+	static constexpr int32 PARALLEL_RANGE_MIN_NUM = 64;
+
+	/** Reserves the objects for the range that knows its size (Num)*/
+	template<class TRange>
+	static auto ReserveForRange(TArray<const UObject*>& OutObjects, const TRange& InRange, int32) -> decltype(InRange.Num(), void())
+	{
+		OutObjects.Reserve(InRange.Num());
+	}
+
+	/** Range without Num: the objects grow while added*/
+	template<class TRange>
+	static void ReserveForRange(TArray<const UObject*>&, const TRange&, ...)
+	{
+	}
 	// ~Range logging End
 	
 	// ~Math value logging Begin
+	// @note: MyLog.Stats accounts the lines of these functions to LogUtilLib.cpp, NOT to the callers: use M_LOG_VALUE from C++ (@see FMyLogStats)
 	UFUNCTION(BlueprintCallable, Category = "Log|Transform|Math")
 	static void LogVector(const FString& InKey, const FVector& InVector);
 	static void LogVectorC(const TCHAR* InKey, const FVector& InVector);
@@ -2,21 +2,84 @@
 
 #include "Logging/LogMacros.h"
 #include "Log/MyLoggingTypes.h"
+#include "Log/MyLogCallSite.h"
+#include "Log/MyLogProfiler.h"
 
 /**
 * General log: Use this category when you do NOT know what category to use;
 */
 DECLARE_LOG_CATEGORY_EXTERN(MyLog, Log, All);
 
-// ~String debug macros Begin
+// ~String debug macros Begin (@note: allocate strings each time, M_LOG* macros use FMyLogCallSite instead)
 #define M_DEBUG_LOG_POSTFIX (FString(TEXT(" (line: ")) + FString::FromInt(__LINE__) + FString(TEXT(" : ")) + FString(__FILE__) + FString(TEXT(" )")))
 #define M_DEBUG_LOG_PREFIX (FString(__FUNCTION__) + FString(TEXT(": "))) 
 // ~String debug macros End
 
+// ~Compile-time verbosity Begin
+/**
+* Most verbose level of the M_LOG* macros compiled in (the name of the ELogVerbosity value).
+* Set by the MyGameLib.Build.cs definitions: the macros of the more verbose levels
+* (including the scoped helpers M_LOGFUNC*, M_LOGBLOCK* of the Log level) compile to nothing.
+*/
+#ifndef MY_LOG_COMPILED_IN_VERBOSITY
+	#define MY_LOG_COMPILED_IN_VERBOSITY VeryVerbose
+#endif // MY_LOG_COMPILED_IN_VERBOSITY
+
+// Values of ELogVerbosity for the preprocessor
+#define M_LOG_VERBOSITY_Fatal 1
+#define M_LOG_VERBOSITY_Error 2
+#define M_LOG_VERBOSITY_Warning 3
+#define M_LOG_VERBOSITY_Display 4
+#define M_LOG_VERBOSITY_Log 5
+#define M_LOG_VERBOSITY_Verbose 6
+#define M_LOG_VERBOSITY_VeryVerbose 7
+#define M_LOG_VERBOSITY_VALUE_IMPL(LogLevel) M_LOG_VERBOSITY_##LogLevel
+#define M_LOG_VERBOSITY_VALUE(LogLevel) M_LOG_VERBOSITY_VALUE_IMPL(LogLevel)
+
+static_assert(M_LOG_VERBOSITY_VALUE(MY_LOG_COMPILED_IN_VERBOSITY) == ELogVerbosity::MY_LOG_COMPILED_IN_VERBOSITY, "MY_LOG_COMPILED_IN_VERBOSITY: name of the ELogVerbosity value expected");
+
+#if M_LOG_VERBOSITY_VALUE(MY_LOG_COMPILED_IN_VERBOSITY) >= M_LOG_VERBOSITY_Log && !NO_LOGGING
+	#define M_LOG_SCOPES_COMPILED_IN 1
+#else
+	#define M_LOG_SCOPES_COMPILED_IN 0
+#endif
+
+/**
+* Is the given verbosity compiled in (compile-time constant, so the code of the stripped levels is eliminated).
+*/
+#define M_LOG_IS_COMPILED_IN(LogLevel)\
+	( ((ELogVerbosity::LogLevel & ELogVerbosity::VerbosityMask) <= ELogVerbosity::COMPILED_IN_MINIMUM_VERBOSITY)\
+	&& ((ELogVerbosity::LogLevel & ELogVerbosity::VerbosityMask) <= ELogVerbosity::MY_LOG_COMPILED_IN_VERBOSITY) )
+// ~Compile-time verbosity End
+
 // ~Logging macros Begin
+/**
+* Is the given verbosity of the category compiled in and NOT suppressed at runtime (the same checks as UE_LOG does).
+*/
+#define M_LOG_IS_ACTIVE(LogCategory, LogLevel)\
+	( M_LOG_IS_COMPILED_IN(LogLevel)\
+	&& ((ELogVerbosity::LogLevel & ELogVerbosity::VerbosityMask) <= FLogCategory##LogCategory::CompileTimeVerbosity)\
+	&& ( ! LogCategory.IsSuppressed(ELogVerbosity::LogLevel) ) )
+
+/**
+* Declares the static call site (built and registered once) in the current block.
+*/
+#define M_DECLARE_LOG_CALL_SITE(SiteName) static const FMyLogCallSite SiteName { __FUNCTION__, __FILE__, __LINE__ }
+#define M_DECLARE_LOG_CALL_SITE_LEVEL(SiteName, LogLevel) static const FMyLogCallSite SiteName { __FUNCTION__, __FILE__, __LINE__, ELogVerbosity::LogLevel }
+
+/**
+* @note: line is formatted on the stack only when the verbosity is active and the call site is enabled (NO heap allocations).
+*/
 #define M_LOG_CUSTOM_TO(LogCategory, LogLevel, FormatString, ...)\
 {\
-	UE_LOG(LogCategory, LogLevel, TEXT("%s%s%s"),  *M_DEBUG_LOG_PREFIX, *FString::Printf(FormatString, ##__VA_ARGS__), *M_DEBUG_LOG_POSTFIX);\
+	if(M_LOG_IS_ACTIVE(LogCategory, LogLevel))\
+	{\
+		M_DECLARE_LOG_CALL_SITE_LEVEL(MyLogCallSite, LogLevel);\
+		if(MyLogCallSite.IsEnabled())\
+		{\
+			MyLog::Logf(MyLogCallSite, LogCategory, ELogVerbosity::LogLevel, FormatString, ##__VA_ARGS__);\
+		}\
+	}\
 }
 
 #define M_LOG_CUSTOM_TO_IF(ShouldLog, LogCategory, LogLevel, FormatString, ...)\
@@ -27,9 +90,12 @@ DECLARE_LOG_CATEGORY_EXTERN(MyLog, Log, All);
 	}\
 }
 
+/**
+* @note: flags are NOT evaluated when the verbosity is NOT compiled in.
+*/
 #define M_LOG_CUSTOM_TO_IF_FLAGS(LogFlags, LogCategory, LogLevel, FormatString, ...)\
 {\
-	if(UMyLoggingTypes::ShouldLogVerbosity(LogFlags, ELogVerbosity::Type::LogLevel))\
+	if(M_LOG_IS_COMPILED_IN(LogLevel) && UMyLoggingTypes::ShouldLogVerbosity(LogFlags, ELogVerbosity::Type::LogLevel))\
 	{\
 		M_LOG_CUSTOM_TO(LogCategory, LogLevel, FormatString, ##__VA_ARGS__);\
 	}\
@@ -337,29 +403,50 @@ DECLARE_LOG_CATEGORY_EXTERN(MyLog, Log, All);
 
 /**
 * Declares scoped helper class.
+*
+* @note: the call site is static, message is only formatted when logging (on the stack, @see FMyLogLine).
+* @note: when profiling is enabled (@see FMyLogProfiler), the scope is timed even if it's NOT logged.
 */
 #define M_DECLARE_CUSTOM_SCOPED_LOG_HELPER_CLASS_IF(ClassNamePrefix, LogCategory, LogLevel)\
 	class M_CUSTOM_SCOPED_LOG_HELPER_CLASS_NAME(ClassNamePrefix)\
 	{\
 	public:\
-		M_CUSTOM_SCOPED_LOG_HELPER_CLASS_NAME(ClassNamePrefix)(bool bInShouldLog, const FString& InPrefixString)\
-	:		bShouldLog(bInShouldLog), PrefixString(InPrefixString)\
+		M_CUSTOM_SCOPED_LOG_HELPER_CLASS_NAME(ClassNamePrefix)(bool bInShouldLog, const FMyLogCallSite& InSite)\
+	:		bShouldLog(bInShouldLog), bProfiling(FMyLogProfiler::IsEnabled()), Site(InSite)\
+		{\
+		}\
+		bool ShouldLog() const { return bShouldLog; }\
+		void AppendMessage(const TCHAR* InString) { Message.Append(InString); }\
+		void AppendMessage(const FString& InString) { Message.Append(InString); }\
+		template<typename FmtType, typename... Types>\
+		void AppendMessagef(const FmtType& InFormat, Types... InArgs) { Message.Appendf(0, InFormat, InArgs...); }\
+		void Enter()\
 		{\
 			if(bShouldLog)\
 			{\
-				UE_LOG(LogCategory, LogLevel, TEXT("%s : Block entered"), *PrefixString);\
+				MyLog::EmitScopeLine(Site, LogCategory, ELogVerbosity::LogLevel, Message, TEXT(" : Block entered"));\
+			}\
+			if(bProfiling)\
+			{\
+				FMyLogProfiler::Enter(Site);\
 			}\
 		}\
 		~M_CUSTOM_SCOPED_LOG_HELPER_CLASS_NAME(ClassNamePrefix)()\
 		{\
+			if(bProfiling)\
+			{\
+				FMyLogProfiler::Exit(Site);\
+			}\
 			if(bShouldLog)\
 			{\
-				UE_LOG(LogCategory, LogLevel, TEXT("%s : Exiting block"), *PrefixString);\
+				MyLog::EmitScopeLine(Site, LogCategory, ELogVerbosity::LogLevel, Message, TEXT(" : Exiting block"));\
 			}\
 		}\
 	private:\
 		bool bShouldLog;\
-		FString PrefixString;\
+		bool bProfiling;\
+		const FMyLogCallSite& Site;\
+		FMyLogLine Message;\
 	};
 
 /**
@@ -367,9 +454,28 @@ DECLARE_LOG_CATEGORY_EXTERN(MyLog, Log, All);
 */
 #define M_SCOPED_LOG_HELPER_CLASS_IF_TO(ClassNamePrefix, LogCategory) M_DECLARE_CUSTOM_SCOPED_LOG_HELPER_CLASS_IF(ClassNamePrefix, LogCategory, Log);
 
-#define M_LOGFUNC_NAMED_STRING_IF_TO(InName, ShouldLog, LogCategory, InString)\
+/**
+* @note: compiles to nothing (NO helper object, NO call site, NO profiling) when the Log level is NOT compiled in (@see M_LOG_SCOPES_COMPILED_IN).
+* @note: the message is NOT evaluated (NO formatting, NO allocation) unless the scope is logged:
+* the category, the verbosity and the call site are checked first.
+*
+* @param AppendFunction: AppendMessage (string) or AppendMessagef (format string and arguments) of the helper.
+*/
+#if M_LOG_SCOPES_COMPILED_IN
+#define M_LOGFUNC_NAMED_IF_TO(InName, ShouldLog, LogCategory, AppendFunction, ...)\
 	M_SCOPED_LOG_HELPER_CLASS_IF_TO(InName, LogCategory);\
-	M_CUSTOM_SCOPED_LOG_HELPER_CLASS_NAME(InName) Autogenerated_##InName##_ScopedLogHelper {ShouldLog, M_DEBUG_LOG_PREFIX + InString + M_DEBUG_LOG_POSTFIX};
+	M_DECLARE_LOG_CALL_SITE(Autogenerated_##InName##_LogCallSite);\
+	M_CUSTOM_SCOPED_LOG_HELPER_CLASS_NAME(InName) Autogenerated_##InName##_ScopedLogHelper {(ShouldLog) && M_LOG_IS_ACTIVE(LogCategory, Log) && Autogenerated_##InName##_LogCallSite.IsEnabled(), Autogenerated_##InName##_LogCallSite};\
+	if(Autogenerated_##InName##_ScopedLogHelper.ShouldLog())\
+	{\
+		Autogenerated_##InName##_ScopedLogHelper.AppendFunction(__VA_ARGS__);\
+	}\
+	Autogenerated_##InName##_ScopedLogHelper.Enter();
+#else
+#define M_LOGFUNC_NAMED_IF_TO(InName, ShouldLog, LogCategory, AppendFunction, ...)
+#endif // M_LOG_SCOPES_COMPILED_IN
+
+#define M_LOGFUNC_NAMED_STRING_IF_TO(InName, ShouldLog, LogCategory, InString) M_LOGFUNC_NAMED_IF_TO(InName, ShouldLog, LogCategory, AppendMessage, InString)
 
 /**
 * @note: we disable warning of shadowing local variable, because we often used unnamed log helpers in blocks, and the autogenerated name is the same.
@@ -380,8 +486,12 @@ DECLARE_LOG_CATEGORY_EXTERN(MyLog, Log, All);
 	M_LOGFUNC_NAMED_STRING_IF_TO(Unnamed, ShouldLog, LogCategory, InString);\
 	__pragma(warning(pop))
 
-#define M_LOGFUNC_IF_TO(ShouldLog, LogCategory) M_LOGFUNC_STRING_IF_TO(ShouldLog, LogCategory, FString(TEXT("")));
-#define M_LOGFUNC_MSG_IF_TO(ShouldLog, LogCategory, FormatString, ...) M_LOGFUNC_STRING_IF_TO(ShouldLog, LogCategory, *FString::Printf(FormatString, ##__VA_ARGS__));
+#define M_LOGFUNC_IF_TO(ShouldLog, LogCategory) M_LOGFUNC_STRING_IF_TO(ShouldLog, LogCategory, TEXT(""));
+#define M_LOGFUNC_MSG_IF_TO(ShouldLog, LogCategory, FormatString, ...)\
+	__pragma(warning(push))\
+	__pragma(warning(disable:4456))\
+	M_LOGFUNC_NAMED_IF_TO(Unnamed, ShouldLog, LogCategory, AppendMessagef, FormatString, ##__VA_ARGS__);\
+	__pragma(warning(pop))
 #define M_LOGBLOCK_IF_TO(ShouldLog, LogCategory, FormatString, ...) M_LOGFUNC_MSG_IF_TO(ShouldLog, LogCategory, FormatString, ##__VA_ARGS__);
 
 #define M_LOGFUNC_STRING_IF_FLAGS_TO(LogFlags, LogCategory, InString) M_LOGFUNC_STRING_IF_TO(UMyLoggingTypes::ShouldLogVerbosity(LogFlags, ELogVerbosity::Type::Log), LogCategory, InString);
@@ -15,33 +15,33 @@ void UPhysUtilLib::LogHitResult(const FHitResult& InHitResult, ELogHitFlags cons
 	const bool bExtOwner = ((InFlags & ELogHitFlags::LeanAndMeanOwner) == ELogHitFlags::None);
 	const bool bExtLocation = ((InFlags & ELogHitFlags::LeanAndMeanLocation) == ELogHitFlags::None);
 
-	ULogUtilLib::LogYesNoC(TEXT("bBlockingHit"), InHitResult.bBlockingHit);
+	M_LOG_VALUE(bool, TEXT("bBlockingHit"), InHitResult.bBlockingHit);
 
-	ULogUtilLib::LogYesNoC(TEXT("bStartPenetrating"), InHitResult.bStartPenetrating);
-	ULogUtilLib::LogInt32C(TEXT("FaceIndex"), InHitResult.FaceIndex);
+	M_LOG_VALUE(bool, TEXT("bStartPenetrating"), InHitResult.bStartPenetrating);
+	M_LOG_VALUE(int32, TEXT("FaceIndex"), InHitResult.FaceIndex);
 
-	ULogUtilLib::LogFloatC(TEXT("Time (0.0F to 1.0F)"), InHitResult.Time);
-	ULogUtilLib::LogFloatC(TEXT("Distance"), InHitResult.Distance);
+	M_LOG_VALUE(float, TEXT("Time (0.0F to 1.0F)"), InHitResult.Time);
+	M_LOG_VALUE(float, TEXT("Distance"), InHitResult.Distance);
 
-	ULogUtilLib::LogStringC(TEXT("Location"), InHitResult.Location.ToString());
-	ULogUtilLib::LogStringC(TEXT("ImpactPoint"), InHitResult.ImpactPoint.ToString());
-	ULogUtilLib::LogStringC(TEXT("Normal"), InHitResult.Normal.ToString());
+	M_LOG_VALUE(FString, TEXT("Location"), InHitResult.Location.ToString());
+	M_LOG_VALUE(FString, TEXT("ImpactPoint"), InHitResult.ImpactPoint.ToString());
+	M_LOG_VALUE(FString, TEXT("Normal"), InHitResult.Normal.ToString());
 
-	ULogUtilLib::LogStringC(TEXT("ImpactNormal"), InHitResult.ImpactNormal.ToString());
+	M_LOG_VALUE(FString, TEXT("ImpactNormal"), InHitResult.ImpactNormal.ToString());
 
-	ULogUtilLib::LogStringC(TEXT("TraceStart"), InHitResult.TraceStart.ToString());
-	ULogUtilLib::LogStringC(TEXT("TraceEnd"), InHitResult.TraceEnd.ToString());
+	M_LOG_VALUE(FString, TEXT("TraceStart"), InHitResult.TraceStart.ToString());
+	M_LOG_VALUE(FString, TEXT("TraceEnd"), InHitResult.TraceEnd.ToString());
 
-	ULogUtilLib::LogFloatC(TEXT("PenetrationDepth"), InHitResult.PenetrationDepth);
+	M_LOG_VALUE(float, TEXT("PenetrationDepth"), InHitResult.PenetrationDepth);
 
-	ULogUtilLib::LogInt32C(TEXT("Item"), InHitResult.Item);
+	M_LOG_VALUE(int32, TEXT("Item"), InHitResult.Item);
 
 	ULogUtilLib::LogWeakKeyedNameClassSafeIfC(bExtOwner, TEXT("PhysMaterial"), InHitResult.PhysMaterial);
 	ULogUtilLib::LogWeakKeyedNameClassSafeC(TEXT("Actor"), InHitResult.Actor);
 	ULogUtilLib::LogWeakKeyedNameClassSafeC(TEXT("Component"), InHitResult.Component);
 
-	ULogUtilLib::LogNameIfC(bExtLocation, TEXT("BoneName"), InHitResult.BoneName);
-	ULogUtilLib::LogNameIfC(bExtLocation, TEXT("MyBoneName"), InHitResult.MyBoneName);
+	M_LOG_VALUE_IF(bExtLocation, FName, TEXT("BoneName"), InHitResult.BoneName);
+	M_LOG_VALUE_IF(bExtLocation, FName, TEXT("MyBoneName"), InHitResult.MyBoneName);
 }
 
 void UPhysUtilLib::LogHitResultIf(bool const bInShouldLog, const FHitResult& InHitResult, ELogHitFlags const InFlags)
@@ -53,17 +53,17 @@ void UPhysUtilLib::LogHitResultIf(bool const bInShouldLog, const FHitResult& InH
 }
 void UPhysUtilLib::LogCollisionQueryParams(const FCollisionQueryParams& InParams)
 {
-	ULogUtilLib::LogYesNoC(TEXT("bFindInitialOverlaps"), InParams.bFindInitialOverlaps);
-	ULogUtilLib::LogYesNoC(TEXT("bIgnoreBlocks"), InParams.bIgnoreBlocks);
-	ULogUtilLib::LogYesNoC(TEXT("bIgnoreTouches"), InParams.bIgnoreTouches);
-	ULogUtilLib::LogYesNoC(TEXT("bReturnFaceIndex"), InParams.bReturnFaceIndex);
-	ULogUtilLib::LogYesNoC(TEXT("bReturnPhysicalMaterial"), InParams.bReturnPhysicalMaterial);
-	ULogUtilLib::LogYesNoC(TEXT("bTraceComplex"), InParams.bTraceComplex);
-	ULogUtilLib::LogInt32C(TEXT("IgnoreMask"), InParams.IgnoreMask);
+	M_LOG_VALUE(bool, TEXT("bFindInitialOverlaps"), InParams.bFindInitialOverlaps);
+	M_LOG_VALUE(bool, TEXT("bIgnoreBlocks"), InParams.bIgnoreBlocks);
+	M_LOG_VALUE(bool, TEXT("bIgnoreTouches"), InParams.bIgnoreTouches);
+	M_LOG_VALUE(bool, TEXT("bReturnFaceIndex"), InParams.bReturnFaceIndex);
+	M_LOG_VALUE(bool, TEXT("bReturnPhysicalMaterial"), InParams.bReturnPhysicalMaterial);
+	M_LOG_VALUE(bool, TEXT("bTraceComplex"), InParams.bTraceComplex);
+	M_LOG_VALUE(int32, TEXT("IgnoreMask"), InParams.IgnoreMask);
 	LogQueryMobilityTypeC(TEXT("MobilityType"), InParams.MobilityType);
-	ULogUtilLib::LogNameC(TEXT("OwnerTag"), InParams.OwnerTag);
+	M_LOG_VALUE(FName, TEXT("OwnerTag"), InParams.OwnerTag);
 	M_TO_BE_IMPL(TEXT("Log StatId"));
-	ULogUtilLib::LogNameC(TEXT("TraceTag"), InParams.TraceTag);
+	M_LOG_VALUE(FName, TEXT("TraceTag"), InParams.TraceTag);
 }
 
 void UPhysUtilLib::LogCollisionQueryParamsIf(bool const bInShouldLog, const FCollisionQueryParams& InParams)
@@ -91,7 +91,7 @@ void UPhysUtilLib::LogComponentQueryParamsIf(bool const bInShouldLog, const FCom
 
 void UPhysUtilLib::LogQueryMobilityTypeC(const TCHAR* const InKey, EQueryMobilityType const InType)
 {
-	ULogUtilLib::LogStringC(InKey, *GetQueryMobilityTypeString(InType));
+	M_LOG_VALUE(FString, InKey, *GetQueryMobilityTypeString(InType));
 }
 
 void UPhysUtilLib::LogQueryMobilityTypeIfC(bool const bInShouldLog, const TCHAR* const InKey, EQueryMobilityType const InType)
@@ -105,7 +105,7 @@ void UPhysUtilLib::LogQueryMobilityTypeIfC(bool const bInShouldLog, const TCHAR*
 
 void UPhysUtilLib::LogPlaneConstraintAxisSettingC(const TCHAR* const InKey, EPlaneConstraintAxisSetting const InValue)
 {
-	ULogUtilLib::LogStringC(InKey, GetPlaneConstraintAxisSettingString(InValue));
+	M_LOG_VALUE(FString, InKey, GetPlaneConstraintAxisSettingString(InValue));
 }
 
 void UPhysUtilLib::LogPlaneConstraintAxisSettingIfC(bool const bInShouldLog, const TCHAR* const InKey, EPlaneConstraintAxisSetting const InValue)
@@ -118,7 +118,7 @@ void UPhysUtilLib::LogPlaneConstraintAxisSettingIfC(bool const bInShouldLog, con
 
 void UPhysUtilLib::LogRadialImpulseFalloffC(const TCHAR* InKey, ERadialImpulseFalloff const InValue)
 {
-	ULogUtilLib::LogStringC(InKey, GetRadialImpulseFalloffString(InValue));
+	M_LOG_VALUE(FString, InKey, GetRadialImpulseFalloffString(InValue));
 }
 
 void UPhysUtilLib::LogRadialImpulseFalloffIfC(bool const bInShouldLog, const TCHAR* const InKey, ERadialImpulseFalloff const InValue)
@@ -136,7 +136,7 @@ void UPhysUtilLib::LogCollisionResponseParams(const FCollisionResponseParams& In
 
 void UPhysUtilLib::LogCollisionChannelC(const TCHAR* const InKey, const ECollisionChannel InValue)
 {
-	ULogUtilLib::LogStringC(InKey, *GetCollisionChannelString(InValue));
+	M_LOG_VALUE(FString, InKey, *GetCollisionChannelString(InValue));
 }
 
 void UPhysUtilLib::LogCollisionShape(const TCHAR* const InKey, const FCollisionShape& InValue)
@@ -145,18 +145,18 @@ void UPhysUtilLib::LogCollisionShape(const TCHAR* const InKey, const FCollisionS
 	switch(InValue.ShapeType)
 	{
 	case ECollisionShape::Box:
-		ULogUtilLib::LogFloatC(*FString::Printf(TEXT("%s.Box.HalfExtentX"), InKey), InValue.Box.HalfExtentX);
-		ULogUtilLib::LogFloatC(*FString::Printf(TEXT("%s.Box.HalfExtentY"), InKey), InValue.Box.HalfExtentY);
-		ULogUtilLib::LogFloatC(*FString::Printf(TEXT("%s.Box.HalfExtentZ"), InKey), InValue.Box.HalfExtentZ);
+		M_LOG_VALUE(float, *FString::Printf(TEXT("%s.Box.HalfExtentX"), InKey), InValue.Box.HalfExtentX);
+		M_LOG_VALUE(float, *FString::Printf(TEXT("%s.Box.HalfExtentY"), InKey), InValue.Box.HalfExtentY);
+		M_LOG_VALUE(float, *FString::Printf(TEXT("%s.Box.HalfExtentZ"), InKey), InValue.Box.HalfExtentZ);
 		break;
 
 	case ECollisionShape::Sphere:
-		ULogUtilLib::LogFloatC(*FString::Printf(TEXT("%s.Sphere.Radius"), InKey), InValue.Sphere.Radius);
+		M_LOG_VALUE(float, *FString::Printf(TEXT("%s.Sphere.Radius"), InKey), InValue.Sphere.Radius);
 		break;
 
 	case ECollisionShape::Capsule:
-		ULogUtilLib::LogFloatC(*FString::Printf(TEXT("%s.Capsule.Radius"), InKey), InValue.Capsule.Radius);
-		ULogUtilLib::LogFloatC(*FString::Printf(TEXT("%s.Capsule.HalfHeight"), InKey), InValue.Capsule.HalfHeight);
+		M_LOG_VALUE(float, *FString::Printf(TEXT("%s.Capsule.Radius"), InKey), InValue.Capsule.Radius);
+		M_LOG_VALUE(float, *FString::Printf(TEXT("%s.Capsule.HalfHeight"), InKey), InValue.Capsule.HalfHeight);
 		break;
 	}
 }
@@ -164,7 +164,7 @@ void UPhysUtilLib::LogCollisionShape(const TCHAR* const InKey, const FCollisionS
 
 void UPhysUtilLib::LogCollisionShapeTypeC(const TCHAR* InKey, ECollisionShape::Type const InType)
 {
-	ULogUtilLib::LogStringC(InKey, GetCollisionShapeTypeString(InType));
+	M_LOG_VALUE(FString, InKey, GetCollisionShapeTypeString(InType));
 }
 
 void UPhysUtilLib::LogCollisionShapeTypeIfC(bool bInShouldLog, const TCHAR* InKey, ECollisionShape::Type const InType)
@@ -13,8 +13,8 @@ UWorld* UWorldUtilLib::NewWorldAndContext
 )
 {
 	M_LOGFUNC_IF_FLAGS(InLogFlags);
-	ULogUtilLib::LogStringIfFlagsC(InLogFlags, TEXT("WorldType"), GetWorldTypeString(InWorldType));
-	ULogUtilLib::LogNameIfFlagsC(InLogFlags, TEXT("WorldName"), InWorldName);
+	M_LOG_VALUE_IF_FLAGS(InLogFlags, FString, TEXT("WorldType"), GetWorldTypeString(InWorldType));
+	M_LOG_VALUE_IF_FLAGS(InLogFlags, FName, TEXT("WorldName"), InWorldName);
 
 	if( GEngine == nullptr )
 	{
@@ -109,8 +109,8 @@ void UWorldUtilLib::K2DestroyWorldSafe(UWorld* const InWorld, bool const bInform
 	FString const WorldString = GetWorldStringSafe(InWorld);
 
 	M_LOGFUNC_MSG_IF_FLAGS(InLogFlags, TEXT("DestroyWorld {%s}"), *WorldString);
-	ULogUtilLib::LogStringIfFlagsC(InLogFlags, TEXT("NewWorld"), GetWorldStringSafe(InNewWorld));
-	ULogUtilLib::LogYesNoIfFlagsC(InLogFlags, TEXT("bInformEngineOrWorld"), bInformEngineOrWorld);
+	M_LOG_VALUE_IF_FLAGS(InLogFlags, FString, TEXT("NewWorld"), GetWorldStringSafe(InNewWorld));
+	M_LOG_VALUE_IF_FLAGS(InLogFlags, bool, TEXT("bInformEngineOrWorld"), bInformEngineOrWorld);
 
 	if(InWorld)
 	{
@@ -283,20 +283,20 @@ AActor* UWorldUtilLib::Spawn
 	{ // Logging actor info
 		bool const bFullActorLog = (InFlags & EMySpawnFlags::FullActorLog) != EMySpawnFlags::None;
 
-		ULogUtilLib::LogNameIfFlagsC(InLogFlags, TEXT("Name"), InSpawnParameters.Name);
+		M_LOG_VALUE_IF_FLAGS(InLogFlags, FName, TEXT("Name"), InSpawnParameters.Name);
 
-		ULogUtilLib::LogStringIfFlagsC(InLogFlags, TEXT("Class"), InClass->GetName());
-		ULogUtilLib::LogStringIfFlagsC(InLogFlags, TEXT("Location"), InTransform.GetLocation().ToString());
-		ULogUtilLib::LogStringIfFlagsC(InLogFlags, TEXT("Rotation"), InTransform.GetRotation().ToString());
+		M_LOG_VALUE_IF_FLAGS(InLogFlags, FString, TEXT("Class"), InClass->GetName());
+		M_LOG_VALUE_IF_FLAGS(InLogFlags, FString, TEXT("Location"), InTransform.GetLocation().ToString());
+		M_LOG_VALUE_IF_FLAGS(InLogFlags, FString, TEXT("Rotation"), InTransform.GetRotation().ToString());
 
-		ULogUtilLib::LogStringIfFlagsC(InLogFlags, TEXT("ObjectFlags"), ULogUtilLib::GetObjectFlagsStringScoped(InSpawnParameters.ObjectFlags));
-		ULogUtilLib::LogYesNoIfFlagsC(InLogFlags, TEXT("bNoFail"), InSpawnParameters.bNoFail);
+		M_LOG_VALUE_IF_FLAGS(InLogFlags, FString, TEXT("ObjectFlags"), ULogUtilLib::GetObjectFlagsStringScoped(InSpawnParameters.ObjectFlags));
+		M_LOG_VALUE_IF_FLAGS(InLogFlags, bool, TEXT("bNoFail"), InSpawnParameters.bNoFail);
 
 		if(bFullActorLog)
 		{
-			ULogUtilLib::LogKeyedNameClassSafeC(TEXT("Template"), InSpawnParameters.Template);
-			ULogUtilLib::LogKeyedNameClassSafeC(TEXT("Owner"), InSpawnParameters.Owner);
-			ULogUtilLib::LogKeyedNameClassSafeC(TEXT("Instigator"), InSpawnParameters.Instigator);
+			M_LOG_VALUE(const UObject*, TEXT("Template"), InSpawnParameters.Template);
+			M_LOG_VALUE(const UObject*, TEXT("Owner"), InSpawnParameters.Owner);
+			M_LOG_VALUE(const UObject*, TEXT("Instigator"), InSpawnParameters.Instigator);
 		}
 	} // Logging actor info
 
@@ -1,7 +1,26 @@
 #include "XprUtilLib.h"
+#include "Log/MyLogCategoryRegistry.h"
 #include "Logging/LogMacros.h"
 
 void UXprUtilLib::LogByCategory(const FLogCategoryBase& InLogCategory, ELogVerbosity::Type InVerbosity, const FString& InString)
 {
-	//UE_LOG(InLogCategory, Log, TEXT("Test"));
-}
\ No newline at end of file
+	if( ! InLogCategory.IsSuppressed(InVerbosity) )
+	{
+		static FMyLogCallSite const Site { __FUNCTION__, __FILE__, __LINE__ };
+		MyLog::Emit(Site, InLogCategory, InVerbosity, *InString);
+	}
+}
+
+void UXprUtilLib::LogByCategory(const FMyLogDynamicCategory& InLogCategory, ELogVerbosity::Type InVerbosity, const FString& InString)
+{
+	if(InLogCategory.IsActive(InVerbosity))
+	{
+		static FMyLogCallSite const Site { __FUNCTION__, __FILE__, __LINE__ };
+		InLogCategory.Log(Site, InVerbosity, *InString);
+	}
+}
+
+FMyLogDynamicCategory& UXprUtilLib::GetDynamicLogCategory(FName InName, ELogVerbosity::Type InDefaultVerbosity)
+{
+	return FMyLogCategoryRegistry::FindOrAdd(InName, InDefaultVerbosity);
+}
@@ -4,6 +4,8 @@
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "XprUtilLib.generated.h"
 
+class FMyLogDynamicCategory;
+
 UCLASS()
 class UXprUtilLib : public UBlueprintFunctionLibrary
 {
@@ -12,6 +14,18 @@ class UXprUtilLib : public UBlueprintFunctionLibrary
 public:
 	/**
 	* Logs FString into the given log category.
+	* The line is written only if NOT suppressed by the category (@see MyLog::Emit).
 	*/
 	static void LogByCategory(const FLogCategoryBase& InLogCategory, ELogVerbosity::Type InVerbosity, const FString& InString);
-};
\ No newline at end of file
+
+	/**
+	* Logs FString into the given category created at runtime (@see FMyLogDynamicCategory).
+	*/
+	static void LogByCategory(const FMyLogDynamicCategory& InLogCategory, ELogVerbosity::Type InVerbosity, const FString& InString);
+
+	/**
+	* Returns the log category of the given name created at runtime (@see FMyLogCategoryRegistry::FindOrAdd).
+	* @note: the lookup takes the lock, keep the returned reference.
+	*/
+	static FMyLogDynamicCategory& GetDynamicLogCategory(FName InName, ELogVerbosity::Type InDefaultVerbosity = ELogVerbosity::Log);
+};
@@ -22,10 +22,10 @@ void UPropertyLogLib::LogPropertyChangedEvent(const FPropertyChangedEvent& InEve
 {
 	M_LOGFUNC();
 
-	ULogUtilLib::LogStringC(TEXT("ChangeType"), GetPropertyChangeTypeString(InEvent.ChangeType));
-	ULogUtilLib::LogStringC(TEXT("MemberProperty"), *GetFieldString(InEvent.MemberProperty));
-	ULogUtilLib::LogInt32C(TEXT("ObjectIteratorIndex"), InEvent.ObjectIteratorIndex);
-	ULogUtilLib::LogStringC(TEXT("Property"), *GetFieldString(InEvent.Property));
+	M_LOG_VALUE(FString, TEXT("ChangeType"), GetPropertyChangeTypeString(InEvent.ChangeType));
+	M_LOG_VALUE(FString, TEXT("MemberProperty"), *GetFieldString(InEvent.MemberProperty));
+	M_LOG_VALUE(int32, TEXT("ObjectIteratorIndex"), InEvent.ObjectIteratorIndex);
+	M_LOG_VALUE(FString, TEXT("Property"), *GetFieldString(InEvent.Property));
 }
 
 FString UPropertyLogLib::GetFieldString(const UField* const InField, EFieldStringFlags const InFlags)
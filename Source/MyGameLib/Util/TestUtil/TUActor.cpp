@@ -1,73 +1,84 @@
 #include "TUActor.h"
 #include "TUTypesLib.h"
 #include "Util/Core/LogUtilLib.h"
+#include "Util/Core/Log/MyLogWatchlist.h"
 
 ATUActor::ATUActor()
 {
-	M_LOGFUNC();
-	LogThis();
+	bool const bShouldLog = FMyLogWatchlist::ShouldLog(this);
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 }
 
 void ATUActor::PostLoad()
 {	
-	M_LOGFUNC_IF(HasAnyTUFlags(ETUFlags::ExtLog));
-	LogThisIf(HasAnyTUFlags(ETUFlags::ExtLog));
+	bool const bShouldLog = ShouldLogLifecycle();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 	Super::PostLoad();
 }
 
 void ATUActor::BeginPlay()
 {
-	M_LOGFUNC_IF(HasAnyTUFlags(ETUFlags::ExtLog));
-	LogThisIf(HasAnyTUFlags(ETUFlags::ExtLog));
+	bool const bShouldLog = ShouldLogLifecycle();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 	Super::BeginPlay();
 }
 
 void ATUActor::EndPlay(EEndPlayReason::Type const InReason)
 {
-	M_LOGFUNC_IF(HasAnyTUFlags(ETUFlags::ExtLog));
-	LogThisIf(HasAnyTUFlags(ETUFlags::ExtLog));
+	bool const bShouldLog = ShouldLogLifecycle();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 	Super::EndPlay(InReason);
 }
 
 void ATUActor::PreRegisterAllComponents()
 {
-	M_LOGFUNC_IF(HasAnyTUFlags(ETUFlags::ExtLog));
-	LogThisIf(HasAnyTUFlags(ETUFlags::ExtLog));
+	bool const bShouldLog = ShouldLogLifecycle();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 	Super::PreRegisterAllComponents();
 }
 
 void ATUActor::PostRegisterAllComponents()
 {
-	M_LOGFUNC_IF(HasAnyTUFlags(ETUFlags::ExtLog));
-	LogThisIf(HasAnyTUFlags(ETUFlags::ExtLog));
+	bool const bShouldLog = ShouldLogLifecycle();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 	Super::PostRegisterAllComponents();
 }
 
 void ATUActor::PostActorCreated()
 {
-	M_LOGFUNC_IF(HasAnyTUFlags(ETUFlags::ExtLog));
-	LogThisIf(HasAnyTUFlags(ETUFlags::ExtLog));
+	bool const bShouldLog = ShouldLogLifecycle();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 	Super::PostActorCreated();
 }
 
 void ATUActor::PreInitializeComponents()
 {
-	M_LOGFUNC_IF(HasAnyTUFlags(ETUFlags::ExtLog));
-	LogThisIf(HasAnyTUFlags(ETUFlags::ExtLog));
+	bool const bShouldLog = ShouldLogLifecycle();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 	Super::PreInitializeComponents();
 }
 
 void ATUActor::PostInitializeComponents()
 {
-	M_LOGFUNC_IF(HasAnyTUFlags(ETUFlags::ExtLog));
-	LogThisIf(HasAnyTUFlags(ETUFlags::ExtLog));
+	bool const bShouldLog = ShouldLogLifecycle();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 	Super::PostInitializeComponents();
 }
 
 void ATUActor::OnConstruction(const FTransform& Transform)
 {
-	M_LOGFUNC_IF(HasAnyTUFlags(ETUFlags::ExtLog));
-	LogThisIf(HasAnyTUFlags(ETUFlags::ExtLog));
+	bool const bShouldLog = ShouldLogLifecycle();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 	Super::OnConstruction(Transform);
 }
 
@@ -96,7 +107,12 @@ void ATUActor::LogTUFlags()
 }
 void ATUActor::LogThis()
 {
-	ULogUtilLib::LogKeyedNameClassSafeC(TEXT("This"), this);
+	M_LOG_VALUE(const UObject*, TEXT("This"), this);
+}
+
+bool ATUActor::ShouldLogLifecycle() const
+{
+	return FMyLogWatchlist::ShouldLog(this, HasAnyTUFlags(ETUFlags::ExtLog));
 }
 
 void ATUActor::LogThisIf(bool const bInShouldLog)
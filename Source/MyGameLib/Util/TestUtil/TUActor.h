@@ -66,6 +66,9 @@ public:
 
 	UFUNCTION(BlueprintCallable)
 	void LogThisIf(bool bInShouldLog);
+
+	/** Should the lifecycle overrides log: the ExtLog flag, narrowed by the log watchlist when active (@see FMyLogWatchlist)*/
+	bool ShouldLogLifecycle() const;
 	// ~Log End
 
 private:
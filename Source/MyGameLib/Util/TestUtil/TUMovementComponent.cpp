@@ -2,84 +2,106 @@
 #include "TUTypesLib.h"
 #include "Util/Core/Phys/PhysUtilLib.h"
 #include "Util/Core/LogUtilLib.h"
+#include "Util/Core/Log/MyLogThrottle.h"
+#include "Util/Core/Log/MyLogWatchlist.h"
 #include "GameFramework/Actor.h"
 
+namespace
+{
+	/** Limit of the log lines per second for the functions called every tick*/
+	constexpr int32 TU_MOVEMENT_TICK_LOGS_PER_SECOND = 4;
+}
+
 UTUMovementComponent::UTUMovementComponent()
 {
 }
 void UTUMovementComponent::OnRegister()
 {
-	M_LOGFUNC();
-	LogThis();
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 
 	Super::OnRegister();
 }
 
 void UTUMovementComponent::StopMovementImmediately()
 {
-	M_LOGFUNC();
-	LogThis();
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 
 	Super::StopMovementImmediately();
 }
 
 void UTUMovementComponent::PhysicsVolumeChanged(class APhysicsVolume* const NewVolume)
 {
-	M_LOGFUNC();
-	LogThis();
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 
 	Super::PhysicsVolumeChanged(NewVolume);
 }
 
 void UTUMovementComponent::HandleImpact(const FHitResult& Hit, float const TimeSlice, const FVector& MoveDelta)
 {
-	M_LOGFUNC();
-	LogThis();
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	LogThisIf(bShouldLog);
 
 	Super::HandleImpact(Hit, TimeSlice, MoveDelta);
-	UPhysUtilLib::LogHitResult(Hit);
-	ULogUtilLib::LogFloatC(TEXT("TimeSlice"), TimeSlice);
-	ULogUtilLib::LogVectorC(TEXT("MoveDelta"), MoveDelta);
+	UPhysUtilLib::LogHitResultIf(bShouldLog, Hit);
+	M_LOG_VALUE_IF(bShouldLog, float, TEXT("TimeSlice"), TimeSlice);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("MoveDelta"), MoveDelta);
 }
 void UTUMovementComponent::UpdateComponentVelocity()
 {
-	M_LOGFUNC();
+	M_LOGFUNC_IF(ShouldLogMovement() && M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Log, EMyLogThrottleMode::PerSecond, TU_MOVEMENT_TICK_LOGS_PER_SECOND));
 	Super::UpdateComponentVelocity();
 }
 
 void UTUMovementComponent::InitCollisionParams(FCollisionQueryParams &OutParams, FCollisionResponseParams& OutResponseParam) const
 {
-	M_LOGFUNC();
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
 	Super::InitCollisionParams(OutParams, OutResponseParam);
-	UPhysUtilLib::LogCollisionQueryParams(OutParams);
-	UPhysUtilLib::LogCollisionResponseParams(OutResponseParam);
+	UPhysUtilLib::LogCollisionQueryParamsIf(bShouldLog, OutParams);
+	if(bShouldLog)
+	{
+		UPhysUtilLib::LogCollisionResponseParams(OutResponseParam);
+	}
 }
 bool UTUMovementComponent::OverlapTest(const FVector& Location, const FQuat& RotationQuat, const ECollisionChannel CollisionChannel, const FCollisionShape& CollisionShape, const AActor* IgnoreActor) const
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogVectorC(TEXT("Location"), Location);
-	ULogUtilLib::LogQuatC(TEXT("RotationQuat"), RotationQuat);
-	UPhysUtilLib::LogCollisionChannelC(TEXT("CollisionChannel"), CollisionChannel);
-	UPhysUtilLib::LogCollisionShape(TEXT("CollisionShape"), CollisionShape);
-	ULogUtilLib::LogKeyedNameClassSafeC(TEXT("IgnoreActor"), IgnoreActor);
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Location"), Location);
+	ULogUtilLib::LogQuatIfC(bShouldLog, TEXT("RotationQuat"), RotationQuat);
+	if(bShouldLog)
+	{
+		UPhysUtilLib::LogCollisionChannelC(TEXT("CollisionChannel"), CollisionChannel);
+		UPhysUtilLib::LogCollisionShape(TEXT("CollisionShape"), CollisionShape);
+	}
+	M_LOG_VALUE_IF(bShouldLog, const UObject*, TEXT("IgnoreActor"), IgnoreActor);
 	bool const bOverlaps = Super::OverlapTest(Location, RotationQuat, CollisionChannel, CollisionShape, IgnoreActor);
 	return bOverlaps;
 }
 
 FVector UTUMovementComponent::GetPenetrationAdjustment(const FHitResult& Hit) const
 {
-	M_LOGFUNC();
-	UPhysUtilLib::LogHitResult(Hit);
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	UPhysUtilLib::LogHitResultIf(bShouldLog, Hit);
 	FVector const Adjustment = Super::GetPenetrationAdjustment(Hit);
 	return Adjustment;
 }
 
 bool UTUMovementComponent::ResolvePenetrationImpl(const FVector& Adjustment, const FHitResult& Hit, const FQuat& NewRotation)
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogVectorC(TEXT("Adjustment"), Adjustment);
-	ULogUtilLib::LogQuatC(TEXT("NewRotation"), NewRotation);
-	UPhysUtilLib::LogHitResult(Hit);
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Adjustment"), Adjustment);
+	ULogUtilLib::LogQuatIfC(bShouldLog, TEXT("NewRotation"), NewRotation);
+	UPhysUtilLib::LogHitResultIf(bShouldLog, Hit);
 	bool const bAdjustmentSuccessful = Super::ResolvePenetrationImpl(Adjustment, Hit, NewRotation);
 	return bAdjustmentSuccessful;
 }
@@ -87,54 +109,59 @@ bool UTUMovementComponent::ResolvePenetrationImpl(const FVector& Adjustment, con
 
 FVector UTUMovementComponent::ComputeSlideVector(const FVector& Delta, const float Time, const FVector& Normal, const FHitResult& Hit) const
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogVectorC(TEXT("Delta"), Delta);
-	ULogUtilLib::LogFloatC(TEXT("Time"), Time);
-	ULogUtilLib::LogVectorC(TEXT("Normal"), Normal);
-	UPhysUtilLib::LogHitResult(Hit);
+	bool const bShouldLog = ShouldLogMovement() && M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Log, EMyLogThrottleMode::PerSecond, TU_MOVEMENT_TICK_LOGS_PER_SECOND);
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Delta"), Delta);
+	M_LOG_VALUE_IF(bShouldLog, float, TEXT("Time"), Time);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Normal"), Normal);
+	UPhysUtilLib::LogHitResultIf(bShouldLog, Hit);
 	FVector const SlideVector = Super::ComputeSlideVector(Delta, Time, Normal, Hit);
 	return SlideVector;
 }
 
 float UTUMovementComponent::SlideAlongSurface(const FVector& Delta, float const Time, const FVector& Normal, FHitResult &Hit, bool const bHandleImpact)
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogVectorC(TEXT("Delta"), Delta);
-	ULogUtilLib::LogFloatC(TEXT("Time"), Time);
-	ULogUtilLib::LogVectorC(TEXT("Normal"), Normal);
-	ULogUtilLib::LogYesNoC(TEXT("bHandleImpact"), bHandleImpact);
+	bool const bShouldLog = ShouldLogMovement() && M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Log, EMyLogThrottleMode::PerSecond, TU_MOVEMENT_TICK_LOGS_PER_SECOND);
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Delta"), Delta);
+	M_LOG_VALUE_IF(bShouldLog, float, TEXT("Time"), Time);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Normal"), Normal);
+	M_LOG_VALUE_IF(bShouldLog, bool, TEXT("bHandleImpact"), bHandleImpact);
 	float const DeltaOnPercentApplied = Super::SlideAlongSurface(Delta, Time, Normal, Hit, bHandleImpact);
-	UPhysUtilLib::LogHitResult(Hit);
+	UPhysUtilLib::LogHitResultIf(bShouldLog, Hit);
 	return DeltaOnPercentApplied;
 }
 
 void UTUMovementComponent::TwoWallAdjust(FVector &Delta, const FHitResult& Hit, const FVector &OldHitNormal) const
 {
-	M_LOGFUNC();
-	UPhysUtilLib::LogHitResult(Hit);
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	UPhysUtilLib::LogHitResultIf(bShouldLog, Hit);
 	Super::TwoWallAdjust(Delta, Hit, OldHitNormal);
-	ULogUtilLib::LogVectorC(TEXT("Delta"), Delta);
-	ULogUtilLib::LogVectorC(TEXT("OldHitNormal"),OldHitNormal);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Delta"), Delta);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("OldHitNormal"), OldHitNormal);
 }
 
 void UTUMovementComponent::AddRadialForce(const FVector& Origin, float const Radius, float const Strength, ERadialImpulseFalloff const Falloff)
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogVectorC(TEXT("Origin"), Origin);
-	ULogUtilLib::LogFloatC(TEXT("Radius"), Radius);
-	ULogUtilLib::LogFloatC(TEXT("Strength"), Strength);
-	UPhysUtilLib::LogRadialImpulseFalloffC(TEXT("Falloff"), Falloff);
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Origin"), Origin);
+	M_LOG_VALUE_IF(bShouldLog, float, TEXT("Radius"), Radius);
+	M_LOG_VALUE_IF(bShouldLog, float, TEXT("Strength"), Strength);
+	UPhysUtilLib::LogRadialImpulseFalloffIfC(bShouldLog, TEXT("Falloff"), Falloff);
 	Super::AddRadialForce(Origin, Radius, Strength, Falloff);
 }
 
 void UTUMovementComponent::AddRadialImpulse(const FVector& Origin, float const Radius, float const Strength, ERadialImpulseFalloff const Falloff, bool const bVelChange)
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogVectorC(TEXT("Origin"), Origin);
-	ULogUtilLib::LogFloatC(TEXT("Radius"), Radius);
-	ULogUtilLib::LogFloatC(TEXT("Strength"), Strength);
-	UPhysUtilLib::LogRadialImpulseFalloffC(TEXT("Falloff"), Falloff);
-	ULogUtilLib::LogYesNoC(TEXT("bVelChange"), bVelChange);
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Origin"), Origin);
+	M_LOG_VALUE_IF(bShouldLog, float, TEXT("Radius"), Radius);
+	M_LOG_VALUE_IF(bShouldLog, float, TEXT("Strength"), Strength);
+	UPhysUtilLib::LogRadialImpulseFalloffIfC(bShouldLog, TEXT("Falloff"), Falloff);
+	M_LOG_VALUE_IF(bShouldLog, bool, TEXT("bVelChange"), bVelChange);
 	Super::AddRadialImpulse(Origin, Radius, Strength, Falloff, bVelChange);
 }
 
@@ -146,8 +173,9 @@ void UTUMovementComponent::AddRadialImpulse(const FVector& Origin, float const R
 */
 void UTUMovementComponent::SetPlaneConstraintAxisSetting(EPlaneConstraintAxisSetting const NewAxisSetting)
 {
-	M_LOGFUNC();
-	UPhysUtilLib::LogPlaneConstraintAxisSettingC(TEXT("NewAxisSetting"), NewAxisSetting);
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	UPhysUtilLib::LogPlaneConstraintAxisSettingIfC(bShouldLog, TEXT("NewAxisSetting"), NewAxisSetting);
 	Super::SetPlaneConstraintAxisSetting(NewAxisSetting);
 }
 
@@ -159,8 +187,9 @@ void UTUMovementComponent::SetPlaneConstraintAxisSetting(EPlaneConstraintAxisSet
 */
 void UTUMovementComponent::SetPlaneConstraintNormal(FVector const PlaneNormal)
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogVectorC(TEXT("PlaneNormal"), PlaneNormal);
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("PlaneNormal"), PlaneNormal);
 	Super::SetPlaneConstraintNormal(PlaneNormal);
 }
 
@@ -168,9 +197,10 @@ void UTUMovementComponent::SetPlaneConstraintNormal(FVector const PlaneNormal)
 /** Uses the Forward and Up vectors to compute the plane that constrains movement, enforced if the plane constraint is enabled. */
 void UTUMovementComponent::SetPlaneConstraintFromVectors(FVector const Forward, FVector const Up)
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogVectorC(TEXT("Forward"), Forward);
-	ULogUtilLib::LogVectorC(TEXT("Up"), Up);
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Forward"), Forward);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Up"), Up);
 	Super::SetPlaneConstraintFromVectors(Forward, Up);
 }
 
@@ -178,8 +208,9 @@ void UTUMovementComponent::SetPlaneConstraintFromVectors(FVector const Forward,
 /** Sets the origin of the plane that constrains movement, enforced if the plane constraint is enabled. */
 void UTUMovementComponent::SetPlaneConstraintOrigin(FVector const PlaneOrigin)
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogVectorC(TEXT("PlaneOrigin"), PlaneOrigin);
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("PlaneOrigin"), PlaneOrigin);
 	Super::SetPlaneConstraintOrigin(PlaneOrigin);
 }
 
@@ -187,8 +218,9 @@ void UTUMovementComponent::SetPlaneConstraintOrigin(FVector const PlaneOrigin)
 /** Sets whether or not the plane constraint is enabled. */
 void UTUMovementComponent::SetPlaneConstraintEnabled(bool const bEnabled)
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogYesNoC(TEXT("bEnabled"), bEnabled);
+	bool const bShouldLog = ShouldLogMovement();
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, bool, TEXT("bEnabled"), bEnabled);
 	Super::SetPlaneConstraintEnabled(bEnabled);
 }
 
@@ -199,8 +231,9 @@ void UTUMovementComponent::SetPlaneConstraintEnabled(bool const bEnabled)
 */
 FVector UTUMovementComponent::ConstrainDirectionToPlane(FVector const Direction) const
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogVectorC(TEXT("Direction"), Direction);
+	bool const bShouldLog = ShouldLogMovement() && M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Log, EMyLogThrottleMode::PerSecond, TU_MOVEMENT_TICK_LOGS_PER_SECOND);
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Direction"), Direction);
 	FVector const ConstraintedDirection = Super::ConstrainDirectionToPlane(Direction);
 	return ConstraintedDirection;
 }
@@ -209,8 +242,9 @@ FVector UTUMovementComponent::ConstrainDirectionToPlane(FVector const Direction)
 /** Constrain a position vector to the plane constraint, if enabled. */
 FVector UTUMovementComponent::ConstrainLocationToPlane(FVector const Location) const
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogVectorC(TEXT("Location"), Location);
+	bool const bShouldLog = ShouldLogMovement() && M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Log, EMyLogThrottleMode::PerSecond, TU_MOVEMENT_TICK_LOGS_PER_SECOND);
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Location"), Location);
 	FVector const ConstraintedLocation = Super::ConstrainLocationToPlane(Location);
 	return ConstraintedLocation;
 }
@@ -219,8 +253,9 @@ FVector UTUMovementComponent::ConstrainLocationToPlane(FVector const Location) c
 /** Constrain a normal vector (of unit length) to the plane constraint, if enabled. */
 FVector UTUMovementComponent::ConstrainNormalToPlane(FVector const Normal) const
 {
-	M_LOGFUNC();
-	ULogUtilLib::LogVectorC(TEXT("Normal"), Normal);
+	bool const bShouldLog = ShouldLogMovement() && M_LOG_THROTTLE_PASSED_IF_ACTIVE(MyLog, Log, EMyLogThrottleMode::PerSecond, TU_MOVEMENT_TICK_LOGS_PER_SECOND);
+	M_LOGFUNC_IF(bShouldLog);
+	M_LOG_VALUE_IF(bShouldLog, FVector, TEXT("Normal"), Normal);
 	FVector const ConstraintedNormal = Super::ConstrainNormalToPlane(Normal);
 	return ConstraintedNormal;
 }
@@ -229,7 +264,7 @@ FVector UTUMovementComponent::ConstrainNormalToPlane(FVector const Normal) const
 /** Snap the updated component to the plane constraint, if enabled. */
 void UTUMovementComponent::SnapUpdatedComponentToPlane()
 {
-	M_LOGFUNC();
+	M_LOGFUNC_IF(ShouldLogMovement());
 	Super::SnapUpdatedComponentToPlane();
 }
 
@@ -237,7 +272,7 @@ void UTUMovementComponent::SnapUpdatedComponentToPlane()
 /** Called by owning Actor upon successful teleport from AActor::TeleportTo(). */
 void UTUMovementComponent::OnTeleported()
 {
-	M_LOGFUNC();
+	M_LOGFUNC_IF(ShouldLogMovement());
 	Super::OnTeleported();
 }
 
@@ -266,9 +301,9 @@ void UTUMovementComponent::LogTUFlags()
 }
 void UTUMovementComponent::LogThis()
 {
-	ULogUtilLib::LogKeyedNameClassSafeC(TEXT("This"), this);
-	ULogUtilLib::LogKeyedNameClassSafeC(TEXT("UpdatedComponent"), UpdatedComponent);
-	ULogUtilLib::LogKeyedNameClassSafeC(TEXT("Owner actor"), UpdatedComponent ? UpdatedComponent->GetOwner() : nullptr);
+	M_LOG_VALUE(const UObject*, TEXT("This"), this);
+	M_LOG_VALUE(const UObject*, TEXT("UpdatedComponent"), UpdatedComponent);
+	M_LOG_VALUE(const UObject*, TEXT("Owner actor"), UpdatedComponent ? UpdatedComponent->GetOwner() : nullptr);
 }
 
 void UTUMovementComponent::LogThisIf(bool const bInShouldLog)
@@ -278,3 +313,9 @@ void UTUMovementComponent::LogThisIf(bool const bInShouldLog)
 		LogThis();
 	}
 }
+
+bool UTUMovementComponent::ShouldLogMovement() const
+{
+	// The outer of the component is the owner actor
+	return FMyLogWatchlist::ShouldLog(this);
+}
@@ -175,6 +175,9 @@ public:
 
 	UFUNCTION(BlueprintCallable)
 	void LogThisIf(bool bInShouldLog);
+
+	/** Should the movement overrides log: narrowed to the watched components and owner actors when the log watchlist is active (@see FMyLogWatchlist)*/
+	bool ShouldLogMovement() const;
 	// ~Log End
 
 private:
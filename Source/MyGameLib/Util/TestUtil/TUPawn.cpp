@@ -2,6 +2,7 @@
 #include "TUPawn.h"
 #include "VisibleActorConfig.h"
 #include "Util/Core/LogUtilLib.h"
+#include "Util/Core/Log/MyLogWatchlist.h"
 
 #include "GameFramework/PlayerController.h"
 #include "I/ITUController.h"
@@ -30,7 +31,7 @@ ATUPawn::ATUPawn()
 
 void ATUPawn::BeginPlay()
 {
-	M_LOGFUNC();
+	M_LOGFUNC_WATCHED(this);
 
 	Super::BeginPlay();
 
@@ -40,12 +41,12 @@ void ATUPawn::BeginPlay()
 
 void ATUPawn::MyBeginPlay_Implementation()
 {
-	M_LOGFUNC();
+	M_LOGFUNC_WATCHED(this);
 }
 
 void ATUPawn::BeginPlayFinished()
 {
-	M_LOGFUNC();
+	M_LOGFUNC_WATCHED(this);
 	if( TScriptInterface<ITUController> const C = K2GetTUControllerLogged() )
 	{
 		ITUController::Execute_PawnBeginPlayEnded(C.GetObject());
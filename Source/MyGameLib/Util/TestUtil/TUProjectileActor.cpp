@@ -74,7 +74,7 @@ void ATUProjectileActor::ActorHit(AActor* SelfActor, AActor* OtherActor, FVector
 void ATUProjectileActor::MakeDamage(AActor* const ActorToDamage, const FHitResult& InHitInfo)
 {
 	M_LOGFUNC();
-	ULogUtilLib::LogKeyedNameClassSafeC(TEXT("ActorToDamage"), ActorToDamage);
+	M_LOG_VALUE(const UObject*, TEXT("ActorToDamage"), ActorToDamage);
 	UPhysUtilLib::LogHitResult(InHitInfo);
 
 	if(bPointDamage)
@@ -1,24 +1,14 @@
 #include "TUTypesLib.h"
 #include "Util\Core\LogUtilLib.h"
+#include "Util\Core\Log\MyBitmaskFormatter.h"
 
 FString UTUTypesLib::GetTUFlagsString(ETUFlags InFlags)
 {
-	if(InFlags == ETUFlags::None)
-	{
-		return FString(TEXT("None"));
-	}
-
-	FString S;
-	if((InFlags & ETUFlags::ExtLog) != ETUFlags::None)
-	{
-		S.Append(TEXT("ExtLog|"));
-	}
-
-	checkNoEntry();
-	return FString(TEXT("{ShouldNotGetHere}"));
+	static const TMyBitmaskFormatter<ETUFlags> Formatter { StaticEnum<ETUFlags>(), TEXT("|") };
+	return Formatter.ToString(InFlags);
 }
 
 void UTUTypesLib::LogTUFlags(ETUFlags InFlags)
 {
-	ULogUtilLib::LogStringC(TEXT("TUFlag"), GetTUFlagsString(InFlags));
-}
\ No newline at end of file
+	M_LOG_VALUE(FString, TEXT("TUFlag"), GetTUFlagsString(InFlags));
+}
@@ -42,9 +42,9 @@ void MyProjectileDemoPawnType::MyBeginPlay_Implementation()
 
 void MyProjectileDemoPawnType::LogDirection()
 {
-	ULogUtilLib::LogRotatorC(TEXT("ActorRotation"), GetActorRotation());
-	ULogUtilLib::LogVectorC(TEXT("ActorRotation.Vector()"), GetActorRotation().Vector());
-	ULogUtilLib::LogRotatorC(TEXT("ControlRotation"), GetControlRotation());
+	M_LOG_VALUE(FRotator, TEXT("ActorRotation"), GetActorRotation());
+	M_LOG_VALUE(FVector, TEXT("ActorRotation.Vector()"), GetActorRotation().Vector());
+	M_LOG_VALUE(FRotator, TEXT("ControlRotation"), GetControlRotation());
 }
 
 ATUProjectileActor* MyProjectileDemoPawnType::LaunchProjectile()
@@ -76,8 +76,8 @@ FTransform MyProjectileDemoPawnType::GetProjectileLaunchTransform() const
 	FRotator const LaunchRotation = EyeRotation;
 	FVector const LaunchLocation = EyeLocation + LaunchRotation.Vector() * ProjectileSettings.LaunchShift; 
 	
-	ULogUtilLib::LogRotatorC(TEXT("LaunchRotation"), LaunchRotation);
-	ULogUtilLib::LogVectorC(TEXT("LaunchLocation"), LaunchLocation);
+	M_LOG_VALUE(FRotator, TEXT("LaunchRotation"), LaunchRotation);
+	M_LOG_VALUE(FVector, TEXT("LaunchLocation"), LaunchLocation);
 
 	return FTransform{ LaunchRotation, LaunchLocation, FVector::OneVector };
 }